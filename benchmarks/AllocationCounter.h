@@ -0,0 +1,62 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+
+using namespace std;
+
+/**
+ * @brief Cuenta asignaciones, liberaciones y bytes vivos del heap reemplazando el
+ * operator new global
+ *
+ * Incluir en un único archivo por ejecutable (los benchmarks tienen uno).
+ * Cada bloque lleva un encabezado con su tamaño para descontarlo al liberar.
+ */
+namespace allocation {
+
+inline atomic<size_t> count(0);
+inline atomic<size_t> releases(0);
+inline atomic<size_t> liveBytes(0);
+
+struct Snapshot {
+    size_t count;
+    size_t releases;
+    size_t liveBytes;
+};
+
+inline Snapshot now() {
+    return {count.load(), releases.load(), liveBytes.load()};
+}
+
+} // namespace allocation
+
+namespace {
+const size_t ALLOCATION_HEADER = alignof(max_align_t);
+}
+
+void* operator new(size_t size) {
+    void* block = malloc(size + ALLOCATION_HEADER);
+    if (!block) throw bad_alloc();
+    *static_cast<size_t*>(block) = size;
+    allocation::count.fetch_add(1, memory_order_relaxed);
+    allocation::liveBytes.fetch_add(size, memory_order_relaxed);
+    return static_cast<char*>(block) + ALLOCATION_HEADER;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    void* block = static_cast<char*>(pointer) - ALLOCATION_HEADER;
+    allocation::releases.fetch_add(1, memory_order_relaxed);
+    allocation::liveBytes.fetch_sub(*static_cast<size_t*>(block), memory_order_relaxed);
+    free(block);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* pointer) noexcept { operator delete(pointer); }
+void operator delete(void* pointer, size_t) noexcept { operator delete(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { operator delete(pointer); }
+
+#endif // ALLOCATION_COUNTER_H
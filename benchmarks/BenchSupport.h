@@ -0,0 +1,96 @@
+#ifndef BENCH_SUPPORT_H
+#define BENCH_SUPPORT_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Soporte mínimo para los benchmarks
+ *
+ * Con --quick cada benchmark reduce sus tamaños para correr en segundos;
+ * así ctest los ejecuta como prueba de humo sin medir nada serio.
+ */
+namespace bench {
+
+inline bool isQuick(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--quick") == 0) return true;
+    }
+    return false;
+}
+
+// Valor entero de una opción "--nombre N", o el valor por defecto
+inline long long intOption(int argc, char** argv, const char* name, long long fallback) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (strcmp(argv[i], name) == 0) return atoll(argv[i + 1]);
+    }
+    return fallback;
+}
+
+// Mejor tiempo de varias repeticiones, en milisegundos
+template <typename Fn>
+double bestOf(int repetitions, Fn fn) {
+    double best = 0.0;
+    for (int i = 0; i < repetitions; ++i) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (i == 0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+// Duración de cada llamada a frame(i), en milisegundos
+template <typename Fn>
+vector<double> measureFrames(int count, Fn frame) {
+    vector<double> frames;
+    for (int i = 0; i < count; ++i) {
+        auto start = chrono::steady_clock::now();
+        frame(i);
+        frames.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    return frames;
+}
+
+inline void report(const string& name, double value, const string& unit = "ms",
+                   const string& extra = "") {
+    cout << left << setw(44) << name << right << setw(12) << fixed << setprecision(3)
+         << value << " " << unit;
+    if (!extra.empty()) cout << "  " << extra;
+    cout << endl;
+}
+
+// p50 y p95 de una serie de frames, con el máximo
+inline void reportFrames(const string& name, vector<double> frames) {
+    if (frames.empty()) return;
+    sort(frames.begin(), frames.end());
+    auto at = [&frames](double quantile) {
+        return frames[min(frames.size() - 1, static_cast<size_t>(quantile * frames.size()))];
+    };
+    report(name + " p50", at(0.50));
+    report(name + " p95", at(0.95), "ms", "máx " + to_string(frames.back()).substr(0, 6));
+}
+
+// Evita que el optimizador descarte un resultado: la barrera obliga a que
+// el valor exista en memoria
+template <typename T>
+void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+} // namespace bench
+
+#endif // BENCH_SUPPORT_H
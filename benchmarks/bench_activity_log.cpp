@@ -0,0 +1,56 @@
+#include "BenchSupport.h"
+#include "models/ActivityLog.h"
+#include <cstdio>
+#include <filesystem>
+
+using namespace std;
+
+// Inserciones sostenidas en un registro lleno (1000 entradas): el buffer
+// circular frente al vector con erase(begin()) que reemplazó, y con el
+// archivo en disco activado
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    const int capacity = 1000;
+    int appends = quick ? 20000 : 2000000;
+
+    ActivityEntry entry("ana", ActivityEntry::Action::MOVED, "estado", "Pendiente", "En Progreso");
+    cout << appends << " inserciones, capacidad " << capacity << endl;
+
+    // El vector desplaza todo el registro en cada inserción: con una décima
+    // parte de las inserciones alcanza para medirlo
+    double ms = bench::bestOf(3, [&]() {
+        vector<ActivityEntry> entries;
+        for (int i = 0; i < appends / 10; ++i) {
+            if (entries.size() >= static_cast<size_t>(capacity)) {
+                entries.erase(entries.begin());
+            }
+            entries.push_back(entry);
+        }
+        bench::keep(entries.size());
+    });
+    bench::report("vector + erase(begin)", ms * 1e6 / (appends / 10), "ns/inserción");
+
+    ms = bench::bestOf(3, [&]() {
+        ActivityLog log(capacity);
+        for (int i = 0; i < appends; ++i) {
+            log.addEntry(entry);
+        }
+        bench::keep(log.getSize());
+    });
+    bench::report("ActivityLog (buffer circular)", ms * 1e6 / appends, "ns/inserción");
+
+    string path = (filesystem::temp_directory_path() / "bench_activity_log.log").string();
+    ms = bench::bestOf(3, [&]() {
+        remove(path.c_str());
+        ActivityLog log(capacity);
+        log.setArchivePath(path);
+        for (int i = 0; i < appends; ++i) {
+            log.addEntry(entry);
+        }
+        log.flushArchive();
+        bench::keep(log.getArchivedCount());
+    });
+    bench::report("ActivityLog + archivo en disco", ms * 1e6 / appends, "ns/inserción");
+    remove(path.c_str());
+    return 0;
+}
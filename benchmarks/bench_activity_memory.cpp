@@ -0,0 +1,74 @@
+#include "BenchSupport.h"
+#include "AllocationCounter.h"
+#include "models/ActivityLog.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+// La entrada anterior: marca de tiempo y seis strings
+struct LegacyEntry {
+    chrono::system_clock::time_point timestamp;
+    string userName;
+    string actionType;
+    string fieldModified;
+    string oldValue;
+    string newValue;
+    string description;
+};
+
+template <typename Fill>
+size_t measureBytes(Fill fill) {
+    auto before = allocation::now();
+    auto holder = fill();
+    size_t bytes = allocation::now().liveBytes - before.liveBytes;
+    bench::keep(holder);
+    return bytes;
+}
+
+} // namespace
+
+// Memoria de los registros de actividad de muchas tareas llenas (1000
+// movimientos cada una), con la entrada de strings anterior frente a la
+// compacta
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    int taskCount = quick ? 20 : 1000;
+    const int entriesPerTask = 1000;
+    const char* users[] = {"ana.garcia", "luis.fernandez", "maria.lopez", "sistema"};
+    const char* states[] = {"Pendiente", "En Progreso", "Terminado"};
+
+    size_t legacyBytes = measureBytes([&]() {
+        auto logs = make_unique<vector<vector<LegacyEntry>>>(taskCount);
+        for (auto& log : *logs) {
+            log.reserve(entriesPerTask);
+            for (int i = 0; i < entriesPerTask; ++i) {
+                const string from = states[i % 3];
+                const string to = states[(i + 1) % 3];
+                log.push_back({chrono::system_clock::now(), users[i % 4], "moved",
+                               "estado", from, to, "Movió de " + from + " a " + to});
+            }
+        }
+        return logs;
+    });
+
+    size_t compactBytes = measureBytes([&]() {
+        auto logs = make_unique<vector<unique_ptr<ActivityLog>>>();
+        logs->reserve(taskCount);
+        for (int t = 0; t < taskCount; ++t) {
+            logs->push_back(make_unique<ActivityLog>(entriesPerTask));
+            for (int i = 0; i < entriesPerTask; ++i) {
+                logs->back()->logMove(users[i % 4], states[i % 3], states[(i + 1) % 3]);
+            }
+        }
+        return logs;
+    });
+
+    double entries = static_cast<double>(taskCount) * entriesPerTask;
+    cout << taskCount << " tareas x " << entriesPerTask << " entradas" << endl;
+    bench::report("entrada anterior (strings)", legacyBytes / entries, "bytes/entrada");
+    bench::report("ActivityEntry compacta", compactBytes / entries, "bytes/entrada");
+    bench::report("reducción", static_cast<double>(legacyBytes) / compactBytes, "x");
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "BenchSupport.h"
+#include "ui/BoardWidget.h"
+#include <QApplication>
+#include <QImage>
+#include <QPainter>
+#include <QPixmapCache>
+#include <QScrollArea>
+#include <climits>
+#include <random>
+
+using namespace std;
+
+// Frames de un tablero con 2k tarjetas visibles (TaskCard con CardRenderer),
+// con y sin caché de pixmaps. Corre con QT_QPA_PLATFORM=offscreen; cada
+// frame pinta el contenido completo del tablero en una imagen.
+int main(int argc, char** argv) {
+    QApplication app(argc, argv);
+    bool quick = bench::isQuick(argc, argv);
+    int cardCount = quick ? 200 : 2000;
+    int frameCount = quick ? 5 : 60;
+    const char* states[] = {"Pendiente", "En Progreso", "Terminado"};
+
+    auto board = make_shared<Board>(1, "Frames");
+    mt19937 rng(48);
+    for (int i = 0; i < cardCount; ++i) {
+        auto task = board->createTask("Tarea " + to_string(i), "", states[rng() % 3]);
+        task->setPriority(static_cast<int>(rng() % 5));
+        if (rng() % 2) task->addTag("etiqueta");
+    }
+
+    BoardWidget boardWidget(board, "bench");
+    boardWidget.setVirtualizationThreshold(INT_MAX);  // Todas como TaskCard
+    boardWidget.refresh();
+    QApplication::processEvents();
+
+    // El contenido entero, no solo lo que entra en la ventana
+    QScrollArea* scrollArea = boardWidget.findChild<QScrollArea*>(QString(),
+                                                                  Qt::FindDirectChildrenOnly);
+    QWidget* content = scrollArea->widget();
+    content->resize(content->sizeHint());
+    QImage image(content->size(), QImage::Format_ARGB32_Premultiplied);
+    cout << cardCount << " tarjetas, " << content->width() << "x" << content->height()
+         << " px" << endl;
+
+    auto paintBoard = [&](int) {
+        QPainter painter(&image);
+        content->render(&painter);
+    };
+
+    int cacheLimit = QPixmapCache::cacheLimit();
+    QPixmapCache::setCacheLimit(0);
+    bench::reportFrames("tablero sin caché", bench::measureFrames(frameCount, paintBoard));
+
+    QPixmapCache::setCacheLimit(cacheLimit);
+    QPixmapCache::clear();
+    bench::reportFrames("tablero, primer frame", bench::measureFrames(1, paintBoard));
+    bench::reportFrames("tablero con caché", bench::measureFrames(frameCount, paintBoard));
+
+    // Una tarea editada por frame: solo esa tarjeta se vuelve a dibujar
+    auto tasks = board->getAllTasks();
+    bench::reportFrames("tablero, 1 edición/frame", bench::measureFrames(frameCount, [&](int i) {
+        tasks[rng() % tasks.size()]->setPriority(i % 5);
+        paintBoard(i);
+    }));
+    return 0;
+}
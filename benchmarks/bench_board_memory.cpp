@@ -0,0 +1,68 @@
+#include "BenchSupport.h"
+#include "AllocationCounter.h"
+#include "models/Board.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+struct Phase {
+    double ms;
+    size_t allocations;
+    size_t releases;
+};
+
+// Carga un tablero con tareas y subtareas, lo vacía y mide ambas fases.
+// Con usePool las tareas y subtareas salen del pool del tablero; sin él,
+// cada una es un make_shared independiente como antes
+void loadAndUnload(int taskCount, int subtasksPerTask, bool usePool,
+                   Phase& load, Phase& unload) {
+    Board board(1, "Carga");
+
+    auto before = allocation::now();
+    auto start = chrono::steady_clock::now();
+    for (int id = 1; id <= taskCount; ++id) {
+        auto task = usePool ? board.allocateTask(id, "Tarea")
+                            : make_shared<Task>(id, "Tarea");
+        for (int s = 0; s < subtasksPerTask; ++s) {
+            task->addSubtask(task->allocateSubtask("Subtarea"));
+        }
+        board.addTask(task, "Pendiente");
+    }
+    load.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    load.allocations = allocation::now().count - before.count;
+    load.releases = allocation::now().releases - before.releases;
+
+    before = allocation::now();
+    start = chrono::steady_clock::now();
+    board.clearAllTasks();
+    unload.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    unload.allocations = allocation::now().count - before.count;
+    unload.releases = allocation::now().releases - before.releases;
+}
+
+} // namespace
+
+// Carga y vaciado de un tablero grande: asignaciones del heap y tiempo con
+// el pool por tablero frente a un make_shared por objeto
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    int taskCount = quick ? 2000 : 200000;
+    const int subtasksPerTask = 4;
+
+    cout << taskCount << " tareas con " << subtasksPerTask << " subtareas cada una" << endl;
+
+    for (bool usePool : {false, true}) {
+        Phase load{}, unload{};
+        loadAndUnload(taskCount, subtasksPerTask, usePool, load, unload);
+
+        string label = usePool ? "pool del tablero" : "make_shared";
+        bench::report("carga, " + label, load.ms, "ms",
+                      to_string(load.allocations) + " new / " + to_string(load.releases) + " delete");
+        bench::report("vaciado, " + label, unload.ms, "ms",
+                      to_string(unload.allocations) + " new / " + to_string(unload.releases) +
+                      " delete");
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "BenchSupport.h"
+#include "ui/ColumnWidget.h"
+#include <QApplication>
+#include <QImage>
+#include <QListView>
+#include <QPainter>
+#include <QScrollBar>
+
+using namespace std;
+
+// Scroll de una columna virtualizada de 100k tareas: un frame por paso,
+// pintando la columna entera en una imagen. Corre con
+// QT_QPA_PLATFORM=offscreen.
+int main(int argc, char** argv) {
+    QApplication app(argc, argv);
+    bool quick = bench::isQuick(argc, argv);
+    int taskCount = quick ? 5000 : 100000;
+    int frameCount = quick ? 20 : 240;
+
+    vector<shared_ptr<Task>> tasks;
+    for (int i = 0; i < taskCount; ++i) {
+        tasks.push_back(make_shared<Task>(i + 1, "Tarea " + to_string(i)));
+    }
+
+    ColumnWidget column("Pendiente");
+    column.setVirtualized(true);
+    double ms = bench::bestOf(1, [&]() {
+        column.getTaskModel()->setTasks(tasks);
+    });
+    column.resize(320, 1000);
+    column.show();
+    QApplication::processEvents();
+
+    cout << taskCount << " tareas en una columna" << endl;
+    bench::report("setTasks", ms);
+
+    QListView* view = column.findChild<QListView*>();
+    QScrollBar* scrollBar = view->verticalScrollBar();
+    QImage image(column.size(), QImage::Format_ARGB32_Premultiplied);
+    auto paintColumn = [&]() {
+        QPainter painter(&image);
+        column.render(&painter);
+    };
+
+    // De arriba abajo en saltos parejos y luego de a una rueda del mouse
+    bench::reportFrames("scroll por saltos", bench::measureFrames(frameCount, [&](int i) {
+        scrollBar->setValue(static_cast<int>(static_cast<long long>(scrollBar->maximum()) * i /
+                                             frameCount));
+        paintColumn();
+    }));
+    scrollBar->setValue(scrollBar->maximum() / 2);
+    bench::reportFrames("scroll de a una rueda", bench::measureFrames(frameCount, [&](int) {
+        scrollBar->setValue(scrollBar->value() + scrollBar->singleStep() * 3);
+        paintColumn();
+    }));
+    return 0;
+}
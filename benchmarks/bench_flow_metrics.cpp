@@ -0,0 +1,45 @@
+#include "BenchSupport.h"
+#include "managers/FlowMetricsManager.h"
+#include <memory>
+#include <thread>
+
+using namespace std;
+
+// Reconstrucción histórica de un tablero grande con 1..N hilos y el costo
+// de un movimiento incremental con las series ya calculadas
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    int taskCount = quick ? 2000 : 200000;
+
+    auto board = make_shared<Board>(1, "Flujo");
+    for (int i = 0; i < taskCount; ++i) {
+        auto task = board->createTask("Tarea", "");
+        if (i % 2 == 1) board->moveTask(task->getId(), "En Progreso", "bench");
+        if (i % 4 == 1) board->moveTask(task->getId(), "Terminado", "bench");
+    }
+
+    cout << taskCount << " tareas" << endl;
+
+    unsigned int maxThreads = max(1u, thread::hardware_concurrency());
+    for (unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+        FlowMetricsManager flow;
+        double ms = bench::bestOf(quick ? 1 : 3, [&]() {
+            flow.rebuild(board, threads);
+            bench::keep(flow.getSeries(1).remaining.back());
+        });
+        bench::report("rebuild, " + to_string(threads) + " hilos", ms);
+    }
+
+    FlowMetricsManager flow;
+    flow.rebuild(board);
+    flow.getSeries(1);
+    int moves = quick ? 1000 : 100000;
+    double ms = bench::bestOf(1, [&]() {
+        for (int i = 0; i < moves; ++i) {
+            flow.recordMove(1, "Pendiente", "En Progreso", chrono::system_clock::now());
+            bench::keep(flow.getSeries(1).remaining.back());
+        }
+    });
+    bench::report("recordMove + getSeries (x" + to_string(moves) + ")", ms);
+    return 0;
+}
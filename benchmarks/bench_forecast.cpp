@@ -0,0 +1,49 @@
+#include "BenchSupport.h"
+#include "managers/ForecastManager.h"
+#include <memory>
+#include <random>
+#include <thread>
+
+using namespace std;
+
+// Escalado del pronóstico Monte Carlo con el número de hilos: 200 tareas
+// con dependencias dispersas y 30 días de historial.
+// Uso: bench_forecast [--threads N] (por defecto, los núcleos disponibles)
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    size_t trials = quick ? 2000 : 200000;
+
+    vector<shared_ptr<Task>> tasks;
+    mt19937 rng(17);
+    for (int i = 1; i <= 200; ++i) {
+        auto task = make_shared<Task>(i, "Tarea");
+        if (i > 20 && rng() % 3 == 0) {
+            task->addDependency(1 + static_cast<int>(rng() % (i - 1)));
+        }
+        tasks.push_back(task);
+    }
+
+    vector<int> history;
+    for (int day = 0; day < 30; ++day) {
+        history.push_back(static_cast<int>(rng() % 8));
+    }
+
+    unsigned int maxThreads = static_cast<unsigned int>(
+        bench::intOption(argc, argv, "--threads", max(1u, thread::hardware_concurrency())));
+    cout << trials << " simulaciones, " << tasks.size() << " tareas, hasta "
+         << maxThreads << " hilos" << endl;
+
+    double serialMs = 0.0;
+    for (unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+        ForecastManager forecaster(threads);
+        ForecastResult result;
+        double ms = bench::bestOf(quick ? 1 : 3, [&]() {
+            result = forecaster.forecast(tasks, history, trials, 42);
+        });
+        if (threads == 1) serialMs = ms;
+        bench::report("forecast, " + to_string(threads) + " hilos", ms, "ms",
+                      "x" + to_string(serialMs / ms).substr(0, 4) +
+                      "  p85=" + to_string(result.p85Days) + " días");
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "BenchSupport.h"
+#include "models/Board.h"
+#include <random>
+
+using namespace std;
+
+// Recorrido de vencidas sobre los objetos Task (como antes) frente al
+// mismo filtro sobre las columnas de la tabla caliente, en tareas/ns
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    int taskCount = quick ? 5000 : 500000;
+    const char* states[] = {"Pendiente", "En Progreso", "Terminado"};
+
+    Board board(1, "Recorrido");
+    mt19937 rng(1);
+    auto now = chrono::system_clock::now();
+    for (int i = 0; i < taskCount; ++i) {
+        auto task = board.createTask("Tarea", "", states[rng() % 3]);
+        task->setPriority(static_cast<int>(rng() % 5));
+        task->setDueDate(now + chrono::hours(static_cast<int>(rng() % 400) - 200));
+    }
+
+    auto tasks = board.getAllTasks();
+    int rounds = quick ? 2 : 20;
+    cout << taskCount << " tareas" << endl;
+
+    size_t overdue = 0;
+    double ms = bench::bestOf(rounds, [&]() {
+        overdue = 0;
+        for (const auto& task : tasks) {
+            if (task->getDueDate() < now && task->getState() != "Terminado") {
+                ++overdue;
+            }
+        }
+    });
+    bench::report("objetos Task", taskCount / (ms * 1e6), "tareas/ns",
+                  to_string(overdue) + " vencidas");
+
+    const TaskHotTable& table = board.getHotTable();
+    uint32_t doneId = TaskHotTable::stateIdOf("Terminado");
+    int64_t nowTicks = TaskHotTable::toTicks(now);
+    ms = bench::bestOf(rounds, [&]() {
+        overdue = table.selectOverdue(doneId, nowTicks).size();
+    });
+    bench::report("tabla caliente (selectOverdue)", taskCount / (ms * 1e6), "tareas/ns",
+                  to_string(overdue) + " vencidas");
+
+    ms = bench::bestOf(rounds, [&]() {
+        overdue = table.countByState(doneId);
+    });
+    bench::report("tabla caliente (countByState)", taskCount / (ms * 1e6), "tareas/ns");
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "BenchSupport.h"
+#include "utils/SelectionKernels.h"
+#include <random>
+
+using namespace std;
+
+// Predicado completo (vencimiento, prioridad, estado y tres asignados)
+// con cada implementación sobre 1M y 10M filas.
+// Uso: bench_selection_kernels [--rows N] (solo ese tamaño)
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    vector<size_t> sizes = {1000000, 10000000};
+    int rowsOption = bench::intOption(argc, argv, "--rows", 0);
+    if (quick) {
+        sizes = {100000};
+    } else if (rowsOption > 0) {
+        sizes = {static_cast<size_t>(rowsOption)};
+    }
+
+    SelectionKernels::Predicate predicate;
+    predicate.dueFrom = -100;
+    predicate.dueTo = 100;
+    predicate.minPriority = 2;
+    predicate.excludeState = true;
+    predicate.excludedStateId = 2;
+    predicate.assignees = {1, 3, 5};
+
+    const SelectionKernels::Isa isas[] = {
+        SelectionKernels::Isa::SCALAR, SelectionKernels::Isa::SSE42, SelectionKernels::Isa::AVX2
+    };
+
+    for (size_t rows : sizes) {
+        vector<uint32_t> stateIds(rows);
+        vector<int32_t> priorities(rows), assigneeIds(rows);
+        vector<int64_t> dueTicks(rows);
+        mt19937 rng(40);
+        for (size_t i = 0; i < rows; ++i) {
+            stateIds[i] = rng() % 3;
+            priorities[i] = static_cast<int32_t>(rng() % 5);
+            assigneeIds[i] = static_cast<int32_t>(rng() % 8) - 1;
+            dueTicks[i] = static_cast<int64_t>(rng() % 1000) - 500;
+        }
+
+        SelectionKernels::Columns columns;
+        columns.stateIds = stateIds.data();
+        columns.priorities = priorities.data();
+        columns.assigneeIds = assigneeIds.data();
+        columns.dueTicks = dueTicks.data();
+        columns.count = rows;
+
+        cout << rows << " filas" << endl;
+        vector<uint64_t> bitmap;
+        double scalarMs = 0.0;
+        for (auto isa : isas) {
+            if (!SelectionKernels::isSupported(isa)) {
+                cout << "  " << SelectionKernels::isaName(isa) << ": no disponible" << endl;
+                continue;
+            }
+            double ms = bench::bestOf(quick ? 2 : 10, [&]() {
+                SelectionKernels::select(columns, predicate, bitmap, isa);
+            });
+            if (isa == SelectionKernels::Isa::SCALAR) scalarMs = ms;
+            bench::report(string("  ") + SelectionKernels::isaName(isa), ms, "ms",
+                          "x" + to_string(scalarMs / ms).substr(0, 4) + "  " +
+                          to_string(SelectionKernels::countBits(bitmap)) + " filas");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "BenchSupport.h"
+#include "AllocationCounter.h"
+#include "models/TaskHistory.h"
+#include <deque>
+#include <memory>
+#include <random>
+
+using namespace std;
+
+namespace {
+
+// La instantánea anterior: todos los campos copiados en cada versión
+struct LegacyMemento {
+    string title;
+    string description;
+    string state;
+    int assignedUserId;
+    chrono::system_clock::time_point timestamp;
+    string modifiedBy;
+};
+
+} // namespace
+
+// Memoria del historial de versiones de muchas tareas con descripciones
+// largas (50 versiones, una edición pequeña por versión) y tiempo de
+// reconstrucción de cada versión
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    int taskCount = quick ? 20 : 500;
+    const int versions = 50;
+    const size_t descriptionSize = 8 * 1024;
+
+    // Una secuencia de descripciones editadas compartida por todas las tareas
+    mt19937 rng(3);
+    vector<string> descriptions;
+    string description(descriptionSize, 'x');
+    for (int v = 0; v < versions; ++v) {
+        description.insert(rng() % description.size(), "edición breve ");
+        descriptions.push_back(description);
+    }
+
+    auto before = allocation::now();
+    auto legacy = make_unique<vector<deque<LegacyMemento>>>(taskCount);
+    for (auto& history : *legacy) {
+        for (int v = 0; v < versions; ++v) {
+            history.push_back({"Título de la tarea", descriptions[v], "En Progreso", 3,
+                               chrono::system_clock::now(), "ana.garcia"});
+        }
+    }
+    size_t legacyBytes = allocation::now().liveBytes - before.liveBytes;
+    legacy.reset();
+
+    before = allocation::now();
+    auto histories = make_unique<vector<TaskHistory>>(taskCount);
+    for (auto& history : *histories) {
+        for (int v = 0; v < versions; ++v) {
+            history.record("Título de la tarea", descriptions[v], "En Progreso", 3, "ana.garcia");
+        }
+    }
+    size_t historyBytes = allocation::now().liveBytes - before.liveBytes;
+
+    cout << taskCount << " tareas x " << versions << " versiones de ~"
+         << descriptionSize / 1024 << " KB" << endl;
+    bench::report("instantáneas completas", legacyBytes / 1024.0 / taskCount, "KB/tarea");
+    bench::report("TaskHistory", historyBytes / 1024.0 / taskCount, "KB/tarea");
+    bench::report("reducción", static_cast<double>(legacyBytes) / historyBytes, "x");
+
+    // Reconstrucción: la versión k aplica como mucho keyframeInterval diferencias
+    const TaskHistory& history = histories->front();
+    int rounds = quick ? 10 : 1000;
+    double ms = bench::bestOf(3, [&]() {
+        for (int r = 0; r < rounds; ++r) {
+            for (size_t k = 0; k < history.size(); ++k) {
+                bench::keep(history.getVersion(k));
+            }
+        }
+    });
+    bench::report("getVersion(k)", ms * 1e6 / (rounds * history.size()), "ns/versión");
+    return 0;
+}
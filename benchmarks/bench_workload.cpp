@@ -0,0 +1,52 @@
+#include "BenchSupport.h"
+#include "managers/WorkloadManager.h"
+#include <random>
+
+using namespace std;
+
+// Reporte de carga con sugerencias sobre 10k usuarios y 1M tareas
+// (100 tableros), 10% sin asignar.
+// Uso: bench_workload [--users N] [--tasks N]
+int main(int argc, char** argv) {
+    bool quick = bench::isQuick(argc, argv);
+    int userCount = static_cast<int>(bench::intOption(argc, argv, "--users", quick ? 100 : 10000));
+    int taskCount = static_cast<int>(bench::intOption(argc, argv, "--tasks", quick ? 10000 : 1000000));
+    const int boardCount = 100;
+    const char* states[] = {"Pendiente", "En Progreso", "Terminado"};
+
+    auto project = make_shared<Project>(1, "Carga");
+    vector<int> userIds;
+    for (int i = 0; i < userCount; ++i) {
+        userIds.push_back(project->createUser("Usuario", "u@x", "dev")->getId());
+    }
+
+    vector<shared_ptr<Board>> boards;
+    for (int i = 0; i < boardCount; ++i) {
+        boards.push_back(project->createBoard("Tablero"));
+    }
+
+    mt19937 rng(29);
+    for (int i = 0; i < taskCount; ++i) {
+        auto task = boards[i % boardCount]->createTask("Tarea", "", states[rng() % 3]);
+        task->setPriority(1 + static_cast<int>(rng() % 5));
+        if (rng() % 10 != 0) {
+            task->setAssignedUserId(userIds[rng() % userIds.size()], "bench");
+        }
+    }
+    cout << userCount << " usuarios, " << taskCount << " tareas" << endl;
+
+    WorkloadManager manager;
+    WorkloadReport report;
+    int rounds = quick ? 2 : 5;
+    double ms = bench::bestOf(rounds, [&]() {
+        report = manager.buildReport(project, false);
+    });
+    bench::report("carga por usuario", ms);
+
+    ms = bench::bestOf(rounds, [&]() {
+        report = manager.buildReport(project);
+    });
+    bench::report("carga + sugerencias (LPT)", ms, "ms",
+                  to_string(report.suggestions.size()) + " sugerencias");
+    return 0;
+}
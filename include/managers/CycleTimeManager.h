@@ -0,0 +1,92 @@
+#ifndef CYCLE_TIME_MANAGER_H
+#define CYCLE_TIME_MANAGER_H
+
+#include <string>
+#include <map>
+#include <memory>
+#include <chrono>
+#include "models/Board.h"
+#include "utils/QuantileSketch.h"
+
+using namespace std;
+
+/**
+ * @brief Percentiles de una distribución de tiempos (en horas)
+ */
+struct PercentileSummary {
+    double p50Hours;
+    double p85Hours;
+    double p95Hours;
+    uint64_t count;
+
+    PercentileSummary();
+};
+
+/**
+ * @brief Analítica de lead time y cycle time para SLAs
+ *
+ * Lead time: desde la creación de la tarea hasta que entra al estado
+ * terminado. Cycle time: tiempo que una tarea permanece en cada columna.
+ * Las distribuciones se mantienen como sketches de cuantiles por tablero,
+ * estado y usuario asignado, así que cada transición cuesta O(log n) y las
+ * consultas no vuelven a recorrer el historial.
+ *
+ * El historial se recorre una sola vez por tablero (rebuild, al cargar el
+ * proyecto); después attach() sigue los movimientos por el bus de eventos.
+ */
+class CycleTimeManager {
+private:
+    struct TaskProgress {
+        string state;
+        chrono::system_clock::time_point enteredAt;
+    };
+
+    struct BoardStats {
+        QuantileSketch leadTime;
+        map<string, QuantileSketch> cycleTimeByState;
+        map<int, QuantileSketch> leadTimeByAssignee;
+        map<int, TaskProgress> progressByTask;
+    };
+
+    string doneState;
+    map<int, BoardStats> boards;
+    EventSubscriptions subscriptions;
+
+    void rebuild(const Board& board);
+    void applyTransition(BoardStats& stats, const Task& task,
+                         const string& fromState, const string& toState,
+                         const chrono::system_clock::time_point& when);
+    static PercentileSummary summarize(const QuantileSketch& sketch);
+
+public:
+    // Constructor
+    CycleTimeManager(const string& doneState = "Terminado");
+
+    // Destructor
+    ~CycleTimeManager();
+
+    // Reconstrucción desde el registro de actividad
+    void rebuild(shared_ptr<Board> board);
+
+    // Actualización incremental
+    void attach(shared_ptr<EventBus> bus);  // Reemplaza la suscripción anterior
+    void detach();
+    void recordTransition(int boardId, const Task& task,
+                          const string& fromState, const string& toState,
+                          const chrono::system_clock::time_point& when);
+    void recordTaskAdded(int boardId, const Task& task);
+    void recordTaskRemoved(int boardId, int taskId);
+
+    // Consultas
+    PercentileSummary getLeadTime(int boardId) const;
+    PercentileSummary getCycleTime(int boardId, const string& state) const;
+    PercentileSummary getLeadTimeByAssignee(int boardId, int userId) const;
+    double getLeadTimePercentile(int boardId, double quantile) const;
+    bool isTracking(int boardId) const;
+
+    // Métodos de utilidad
+    void forgetBoard(int boardId);
+    void clear();
+};
+
+#endif // CYCLE_TIME_MANAGER_H
@@ -0,0 +1,108 @@
+#ifndef DUE_DATE_SCHEDULER_H
+#define DUE_DATE_SCHEDULER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include "models/Board.h"
+
+using namespace std;
+
+/**
+ * @brief Programa los avisos de vencimiento de las tareas en un min-heap
+ * ordenado por el instante en que corresponde cada aviso
+ *
+ * Se suscribe al bus de eventos de los tableros vigilados (altas, bajas,
+ * movimientos y cambios de fecha límite). Cada cambio cuesta O(log n) y
+ * deja obsoletos los avisos
+ * anteriores de esa tarea, que se descartan al salir del heap (número de
+ * generación). No hay recorridos periódicos: quien lo usa pide los avisos
+ * vencidos cuando llega getNextDeadline().
+ *
+ * Una tarea sin fecha límite (time_point por omisión) no genera avisos.
+ */
+class DueDateScheduler {
+public:
+    enum class Alert {
+        DUE_SOON,  // Faltan dueSoonLead o menos para el vencimiento
+        OVERDUE    // Pasó la fecha límite sin terminar
+    };
+    
+    struct DueAlert {
+        Alert alert;
+        int boardId;
+        shared_ptr<Task> task;
+    };
+
+private:
+    struct TaskSchedule {
+        int64_t dueTicks = 0;
+        bool done = false;
+        uint64_t generation = 0;
+        bool dueSoonFired = false;
+        bool overdueFired = false;
+    };
+    
+    struct HeapEntry {
+        int64_t fireTicks;
+        uint64_t generation;
+        int boardId;
+        int taskId;
+        Alert alert;
+        
+        bool operator>(const HeapEntry& other) const { return fireTicks > other.fireTicks; }
+    };
+    
+    chrono::system_clock::duration dueSoonLead;
+    string doneState;
+    uint32_t doneStateId;
+    
+    map<int, weak_ptr<Board>> boards;
+    vector<EventSubscriptions> subscriptions;  // Una entrada por bus
+    map<pair<int, int>, TaskSchedule> schedules;  // (tablero, tarea)
+    vector<HeapEntry> heap;  // Min-heap (push_heap/pop_heap con greater)
+    uint64_t nextGeneration;
+    
+    function<void(const chrono::system_clock::time_point&)> deadlineCallback;
+    
+    void subscribeTo(shared_ptr<EventBus> bus);
+    void updateTask(int boardId, int taskId, bool done, int64_t dueTicks);
+    void forgetTask(int boardId, int taskId);
+    void forgetBoardTasks(int boardId);
+    void schedule(int boardId, int taskId, TaskSchedule& entry);
+    void pushEntry(const HeapEntry& entry);
+    void popEntry();
+    bool isStale(const HeapEntry& entry) const;
+    void discardStale();
+    void compactIfNeeded();
+
+public:
+    // Constructor
+    DueDateScheduler(chrono::system_clock::duration dueSoonLead = chrono::hours(48),
+                     const string& doneState = "Terminado");
+    
+    // Destructor: cancela las suscripciones
+    ~DueDateScheduler();
+    
+    DueDateScheduler(const DueDateScheduler&) = delete;
+    DueDateScheduler& operator=(const DueDateScheduler&) = delete;
+    
+    // Tableros vigilados (se usa el bus que tenga el tablero al llamar)
+    void watchBoard(shared_ptr<Board> board);
+    void unwatchBoard(int boardId);
+    void clear();
+    
+    // Avisos
+    vector<DueAlert> collectDue(const chrono::system_clock::time_point& now);
+    bool hasPending();
+    chrono::system_clock::time_point getNextDeadline();
+    size_t getScheduledTaskCount() const;
+    
+    // Se llama cuando el próximo aviso pasa a ser anterior al programado
+    void setDeadlineCallback(function<void(const chrono::system_clock::time_point&)> callback);
+};
+
+#endif // DUE_DATE_SCHEDULER_H
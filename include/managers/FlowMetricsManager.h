@@ -0,0 +1,100 @@
+#ifndef FLOW_METRICS_MANAGER_H
+#define FLOW_METRICS_MANAGER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <string_view>
+#include "models/Board.h"
+
+using namespace std;
+
+/**
+ * @brief Series temporales de un tablero listas para graficar
+ * Todos los vectores tienen un valor por intervalo (día o semana)
+ */
+struct FlowSeries {
+    vector<chrono::system_clock::time_point> bucketStarts;
+    vector<string> states;
+    vector<vector<int>> cumulativeByState;  // [estado][intervalo] tareas en cada estado
+    vector<int> remaining;                  // Burndown: tareas no terminadas
+    vector<int> throughput;                 // Tareas terminadas en el intervalo
+
+    size_t getBucketCount() const { return bucketStarts.size(); }
+};
+
+/**
+ * @brief Calcula flujo acumulado, burndown y throughput a partir del
+ * registro de actividad de cada tarea
+ *
+ * Cada tablero guarda deltas por intervalo (+1 al entrar a un estado,
+ * -1 al salir), de modo que un movimiento nuevo solo toca dos celdas y
+ * las series se reconstruyen con sumas prefijas desde el primer intervalo
+ * modificado.
+ *
+ * Con attach() los movimientos, altas y bajas llegan por el bus de eventos
+ * del proyecto; solo se actualizan los tableros ya reconstruidos.
+ */
+class FlowMetricsManager {
+public:
+    enum class Granularity {
+        DAY,
+        WEEK
+    };
+
+private:
+    struct BoardFlow {
+        vector<string> states;
+        map<string, size_t, less<>> stateIndex;  // Búsqueda con string_view
+        chrono::system_clock::time_point origin;
+        vector<vector<int>> deltas;   // [estado][intervalo]
+        vector<int> completions;      // [intervalo]
+        size_t dirtyFrom = 0;         // Primer intervalo con series desactualizadas
+        FlowSeries series;
+    };
+
+    Granularity granularity;
+    string doneState;
+    map<int, BoardFlow> boards;
+    EventSubscriptions subscriptions;
+
+    chrono::system_clock::duration getBucketLength() const;
+    chrono::system_clock::time_point alignToBucket(
+        const chrono::system_clock::time_point& tp) const;
+    size_t ensureBucket(BoardFlow& flow, const chrono::system_clock::time_point& tp);
+    void applyTaskHistory(BoardFlow& flow, const Task& task, int sign);
+    void recomputeSeries(BoardFlow& flow);
+
+public:
+    // Constructor
+    FlowMetricsManager(Granularity granularity = Granularity::DAY,
+                       const string& doneState = "Terminado");
+
+    // Destructor
+    ~FlowMetricsManager();
+
+    // Reconstrucción histórica (en paralelo entre tareas)
+    void rebuild(shared_ptr<Board> board, unsigned int threadCount = 0);
+
+    // Actualizaciones incrementales
+    void attach(shared_ptr<EventBus> bus);  // Reemplaza la suscripción anterior
+    void detach();
+    // Alta y baja aplican toda la historia de la tarea, igual que rebuild()
+    void recordTaskAdded(int boardId, const Task& task);
+    void recordTaskRemoved(int boardId, const Task& task);
+    void recordMove(int boardId, string_view fromState, string_view toState,
+                    const chrono::system_clock::time_point& when);
+
+    // Consultas
+    bool isTracking(int boardId) const;
+    const FlowSeries& getSeries(int boardId);
+    Granularity getGranularity() const;
+
+    // Métodos de utilidad
+    void forgetBoard(int boardId);
+    void clear();
+};
+
+#endif // FLOW_METRICS_MANAGER_H
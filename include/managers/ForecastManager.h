@@ -0,0 +1,72 @@
+#ifndef FORECAST_MANAGER_H
+#define FORECAST_MANAGER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include "models/Board.h"
+
+using namespace std;
+
+/**
+ * @brief Resultado de un pronóstico de entrega
+ */
+struct ForecastResult {
+    bool valid;              // false si no hay historial de throughput
+    size_t trials;
+    size_t taskCount;
+    size_t blockedTrials;    // Simulaciones que no terminaron (dependencias sin resolver)
+    int p50Days;
+    int p85Days;
+    int p95Days;
+    chrono::system_clock::time_point p50Date;
+    chrono::system_clock::time_point p85Date;
+    chrono::system_clock::time_point p95Date;
+
+    ForecastResult();
+};
+
+/**
+ * @brief Pronóstico Monte Carlo de "¿cuándo estarán terminadas estas tareas?"
+ *
+ * Cada simulación toma al azar el throughput de días pasados (obtenido del
+ * registro de actividad) y completa tareas respetando el grafo de
+ * dependencias. Las simulaciones se reparten en bloques entre varios hilos;
+ * cada bloque tiene su propio generador sembrado con (seed, bloque), así
+ * que el resultado es reproducible sin importar el número de hilos.
+ */
+class ForecastManager {
+private:
+    unsigned int threadCount;
+    int historyDays;   // Días de historial usados para el throughput
+    int maxDays;       // Horizonte máximo de una simulación
+    string doneState;
+
+public:
+    // Constructor
+    ForecastManager(unsigned int threadCount = 0, int historyDays = 30,
+                    int maxDays = 3650, const string& doneState = "Terminado");
+
+    // Destructor
+    ~ForecastManager();
+
+    // Throughput diario de los últimos historyDays días (índice 0 = más antiguo)
+    vector<int> collectDailyThroughput(const vector<shared_ptr<Task>>& tasks) const;
+
+    // Pronosticar todas las tareas abiertas del tablero
+    ForecastResult forecast(shared_ptr<Board> board, size_t trials = 10000,
+                            uint64_t seed = 42) const;
+
+    // Pronosticar un conjunto de tareas con un historial dado
+    ForecastResult forecast(const vector<shared_ptr<Task>>& pendingTasks,
+                            const vector<int>& dailyThroughput,
+                            size_t trials, uint64_t seed) const;
+
+    // Configuración
+    void setThreadCount(unsigned int threadCount);
+    unsigned int getThreadCount() const;
+};
+
+#endif // FORECAST_MANAGER_H
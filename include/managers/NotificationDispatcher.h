@@ -0,0 +1,90 @@
+#ifndef NOTIFICATION_DISPATCHER_H
+#define NOTIFICATION_DISPATCHER_H
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <tuple>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include "NotificationManager.h"
+
+using namespace std;
+
+/**
+ * @brief Entrega asíncrona de notificaciones en lotes
+ *
+ * submit() solo encola y vuelve; un hilo propio espera una ventana corta
+ * desde la primera notificación pendiente y entrega todo lo acumulado en
+ * una sola llamada. Dentro de la ventana, una notificación nueva del mismo
+ * tipo, usuario y tarea reemplaza a la pendiente en lugar de sumarse. Con
+ * la cola llena, las nuevas se descartan y se cuentan.
+ *
+ * El callback corre en el hilo de entrega: quien actualice la interfaz
+ * debe pasar al hilo principal (por ejemplo con una conexión encolada).
+ */
+class NotificationDispatcher {
+public:
+    using BatchCallback = function<void(const vector<Notification>&)>;
+    
+    struct Stats {
+        uint64_t submitted = 0;
+        uint64_t delivered = 0;
+        uint64_t coalesced = 0;   // Reemplazadas por una más nueva con la misma clave
+        uint64_t dropped = 0;     // Rechazadas por cola llena
+        uint64_t batches = 0;
+    };
+
+private:
+    using CoalesceKey = tuple<int, int, int>;  // (tipo, usuario, tarea)
+    
+    BatchCallback callback;
+    chrono::milliseconds window;
+    size_t capacity;
+    size_t maxBatchSize;
+    
+    mutable mutex queueMutex;
+    condition_variable queueChanged;
+    condition_variable batchDelivered;
+    deque<Notification> pending;
+    uint64_t pendingBase;                     // Número de secuencia de pending.front()
+    map<CoalesceKey, uint64_t> pendingByKey;  // Clave -> número de secuencia
+    chrono::steady_clock::time_point firstPendingTime;
+    bool delivering;
+    bool flushRequested;
+    bool stopping;
+    Stats stats;
+    
+    thread worker;
+    
+    void run();
+
+public:
+    // Constructor: arranca el hilo de entrega
+    NotificationDispatcher(BatchCallback callback,
+                           chrono::milliseconds window = chrono::milliseconds(200),
+                           size_t capacity = 1024, size_t maxBatchSize = 256);
+    
+    // Destructor: entrega lo pendiente y detiene el hilo
+    ~NotificationDispatcher();
+    
+    NotificationDispatcher(const NotificationDispatcher&) = delete;
+    NotificationDispatcher& operator=(const NotificationDispatcher&) = delete;
+    
+    // Encolar (false si se descartó por cola llena)
+    bool submit(const Notification& notification);
+    
+    // Entrega inmediata de lo pendiente; bloquea hasta terminar
+    void flush();
+    void stop();
+    
+    // Estadísticas
+    Stats getStats() const;
+    size_t getPendingCount() const;
+};
+
+#endif // NOTIFICATION_DISPATCHER_H
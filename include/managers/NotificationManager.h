@@ -3,14 +3,22 @@
 
 #include <string>
 #include <vector>
+#include <deque>
+#include <unordered_map>
+#include <map>
+#include <tuple>
 #include <memory>
+#include <cstdint>
 #include <chrono>
 #include <functional>
 #include "models/Task.h"
 #include "models/Project.h"
+#include "DueDateScheduler.h"
 
 using namespace std;
 
+class NotificationDispatcher;
+
 /**
  * @brief Estructura que representa una notificación
  */
@@ -24,6 +32,7 @@ struct Notification {
         TASK_COMPLETED       // Tarea completada
     };
     
+    uint64_t id;  // Asignado por NotificationManager; estable mientras exista
     Type type;
     string title;
     string message;
@@ -42,14 +51,46 @@ struct Notification {
 /**
  * @brief Gestor de notificaciones del sistema
  * Implementa el patrón Observer para notificar cambios
+ *
+ * El almacén está acotado: una notificación igual (tipo, tarea, usuario) a
+ * otra todavía no leída solo actualiza su texto, cada usuario guarda como máximo
+ * maxPerUser (se eliminan las más antiguas) y cada notificación vence a
+ * las ttl de creada. Los vencimientos se procesan de a poco desde una cola
+ * ordenada por fecha de creación, sin recorrer todo el almacén.
  */
 class NotificationManager {
 private:
-    vector<Notification> notifications;
+    // Bandeja de un usuario en orden de llegada (ids crecientes)
+    struct UserInbox {
+        deque<Notification> items;
+        size_t unreadCount = 0;
+    };
+    
+    using DedupKey = tuple<int, int, int>;  // (tipo, tarea, usuario)
+    
+    unordered_map<int, UserInbox> inboxes;
+    unordered_map<uint64_t, int> userByNotificationId;
+    map<DedupKey, uint64_t> idByDedupKey;     // Última notificación de cada clave
+    deque<pair<int64_t, uint64_t>> expiryQueue;  // (creación en ticks, id), ordenada
+    uint64_t nextNotificationId;
+    size_t totalCount;
+    
+    // Retención
+    size_t maxPerUser;
+    chrono::system_clock::duration ttl;
+    uint64_t deduplicatedCount;
+    uint64_t evictedCount;
+
     function<void(const Notification&)> notificationCallback;
+    shared_ptr<NotificationDispatcher> dispatcher;  // Entrega asíncrona (nulo: síncrona)
+    
+    // Avisos de vencimiento programados por fecha (sin recorridos diarios)
+    shared_ptr<DueDateScheduler> dueDateScheduler;
     
-    // Para verificar tareas próximas a vencer
-    chrono::system_clock::time_point lastCheck;
+    Notification* findNotification(uint64_t id);
+    Notification& storeNotification(const Notification& notification);
+    void removeNotification(uint64_t id);
+    static DedupKey dedupKeyOf(const Notification& notification);
 
 public:
     // Constructor
@@ -61,8 +102,18 @@ public:
     // Configurar callback para notificaciones
     void setNotificationCallback(function<void(const Notification&)> callback);
     
-    // Agregar notificaciones
-    void addNotification(const Notification& notification);
+    // Entrega asíncrona en lotes desde un hilo propio; mientras esté activa
+    // reemplaza al callback síncrono. Un callback nulo la desactiva.
+    void setBatchCallback(function<void(const vector<Notification>&)> callback,
+                          chrono::milliseconds window = chrono::milliseconds(200),
+                          size_t capacity = 1024);
+    void flushNotifications();
+    shared_ptr<NotificationDispatcher> getDispatcher() const;
+    
+    // Agregar notificaciones (devuelve el id asignado, o el de la
+    // notificación no leída equivalente si se descartó por duplicada)
+    uint64_t addNotification(const Notification& notification);
+    void restoreNotification(const Notification& notification);  // Conserva id, sin entregar
     void notifyTaskDueSoon(shared_ptr<Task> task, int userId);
     void notifyTaskOverdue(shared_ptr<Task> task, int userId);
     void notifyDependencyResolved(shared_ptr<Task> task, int userId);
@@ -70,25 +121,39 @@ public:
     void notifyTaskMoved(shared_ptr<Task> task, const string& newState, int userId);
     void notifyTaskCompleted(shared_ptr<Task> task, int userId);
     
-    // Verificar tareas próximas a vencer en un proyecto
-    void checkDueDates(shared_ptr<Project> project);
+    // Vencimientos: vigilar los tableros y emitir los avisos que correspondan
+    void watchProject(shared_ptr<Project> project);
+    int processDueDates(const chrono::system_clock::time_point& now = chrono::system_clock::now());
+    void checkDueDates(shared_ptr<Project> project);  // watchProject + processDueDates
+    chrono::system_clock::time_point getNextDueDateCheck();
+    shared_ptr<DueDateScheduler> getDueDateScheduler() const;
     
     // Consultas
     vector<Notification> getNotificationsByUser(int userId) const;
+    vector<Notification> getNotificationsPage(int userId, size_t offset,
+                                              size_t limit) const;  // Más recientes primero
     vector<Notification> getUnreadNotifications(int userId) const;
-    int getUnreadCount(int userId) const;
+    int getUnreadCount(int userId) const;  // O(1)
+    size_t getNotificationCount(int userId) const;
     
     // Marcar como leída
-    void markAsRead(size_t index);
+    bool markAsRead(uint64_t notificationId);
     void markAllAsRead(int userId);
     
     // Limpiar notificaciones
-    void clearOldNotifications(int daysOld = 7);
+    void clearOldNotifications(int daysOld = 7);  // Leídas, desde la más antigua de cada usuario
     void clearAll();
     
+    // Retención
+    void setRetention(size_t maxPerUser, chrono::system_clock::duration ttl);  // ttl: las nuevas
+    size_t expireNotifications(const chrono::system_clock::time_point& now = chrono::system_clock::now(),
+                               size_t budget = SIZE_MAX);
+    uint64_t getDeduplicatedCount() const;
+    uint64_t getEvictedCount() const;
+    
     // Métodos de utilidad
     size_t getNotificationCount() const;
-    const vector<Notification>& getAllNotifications() const;
+    vector<Notification> getAllNotifications() const;  // Ordenadas por id
 };
 
 #endif // NOTIFICATION_MANAGER_H
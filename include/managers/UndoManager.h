@@ -0,0 +1,140 @@
+#ifndef UNDO_MANAGER_H
+#define UNDO_MANAGER_H
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include "models/Board.h"
+#include "models/Task.h"
+#include "models/Subtask.h"
+
+using namespace std;
+
+/**
+ * @brief Operación deshacible, guardada como registro inverso compacto
+ *
+ * Solo guarda lo necesario para invertir la operación (ids, estados
+ * internados, el valor anterior del campo), nunca una copia de la tarea.
+ * Los textos se guardan como delta: largo del prefijo y del sufijo comunes
+ * (en oldNumber/newNumber) y el tramo del medio antes y después del cambio.
+ * Un GROUP agrupa varios registros que se deshacen como un solo paso.
+ */
+struct UndoCommand {
+    enum class Kind : uint8_t {
+        MOVE_TASK,
+        ADD_TASK,
+        REMOVE_TASK,
+        ADD_DEPENDENCY,
+        REMOVE_DEPENDENCY,
+        ADD_SUBTASK,
+        REMOVE_SUBTASK,
+        EDIT_FIELD,
+        GROUP
+    };
+
+    enum class Field : uint8_t {
+        NONE,
+        TITLE,
+        DESCRIPTION,
+        ASSIGNEE,
+        PRIORITY,
+        DUE_DATE
+    };
+
+    Kind kind;
+    Field field;
+    uint32_t actorId;          // Usuario que hizo el cambio (StringPool)
+    int taskId;
+    int64_t oldNumber;         // Estado internado, id, prioridad, ticks o largo del prefijo
+    int64_t newNumber;         // ... o largo del sufijo en los textos
+    uint32_t position;         // Posición original en la columna o entre las subtareas
+    string oldText;            // Tramo reemplazado del título o la descripción
+    string newText;
+    weak_ptr<Board> board;
+    shared_ptr<Task> task;     // Tarea afectada (se conserva si fue eliminada)
+    shared_ptr<Subtask> subtask;
+    chrono::steady_clock::time_point when;
+    vector<UndoCommand> children;  // Solo en GROUP, en orden de ejecución
+
+    UndoCommand(Kind kind, Field field = Field::NONE);
+
+    string getDescription() const;
+};
+
+/**
+ * @brief Pila de deshacer/rehacer para operaciones de tableros y tareas
+ *
+ * Cada método ejecuta la operación y, si cambió algo, apila su registro
+ * inverso. Ediciones seguidas del mismo campo de la misma tarea dentro de
+ * coalesceWindow se fusionan en un solo paso. Lo registrado entre
+ * beginGroup() y endGroup() forma también un solo paso. La pila guarda como
+ * mucho maxDepth pasos; al superarlo se descarta el más antiguo.
+ */
+class UndoManager {
+private:
+    deque<UndoCommand> undoStack;
+    deque<UndoCommand> redoStack;
+    size_t maxDepth;
+    chrono::milliseconds coalesceWindow;
+    vector<UndoCommand> openGroup;
+    size_t groupDepth;
+
+    void push(UndoCommand command);
+    bool merge(UndoCommand& top, UndoCommand& command) const;
+    bool apply(const UndoCommand& command, bool reverse);
+    void applyField(Task& task, UndoCommand::Field field, int64_t number,
+                    const string& text, const string& actor);
+    void recordEdit(shared_ptr<Task> task, UndoCommand::Field field, const string& actor,
+                    int64_t oldNumber, int64_t newNumber,
+                    const string& oldText = "", const string& newText = "");
+
+public:
+    // Constructor
+    UndoManager(size_t maxDepth = 100,
+                chrono::milliseconds coalesceWindow = chrono::milliseconds(1500));
+
+    // Operaciones de tablero
+    bool moveTask(shared_ptr<Board> board, int taskId, const string& newState,
+                  const string& movedBy);
+    void addTask(shared_ptr<Board> board, shared_ptr<Task> task, const string& state);
+    bool removeTask(shared_ptr<Board> board, int taskId);
+
+    // Operaciones de tarea
+    void addDependency(shared_ptr<Task> task, int dependencyId);
+    void removeDependency(shared_ptr<Task> task, int dependencyId);
+    void addSubtask(shared_ptr<Task> task, shared_ptr<Subtask> subtask);
+    bool removeSubtask(shared_ptr<Task> task, int subtaskId);
+    bool removeSubtaskAt(shared_ptr<Task> task, size_t position);
+
+    // Ediciones de campos
+    void setTitle(shared_ptr<Task> task, const string& title, const string& modifiedBy);
+    void setDescription(shared_ptr<Task> task, const string& description,
+                        const string& modifiedBy);
+    void setAssignedUserId(shared_ptr<Task> task, int userId, const string& modifiedBy);
+    void setPriority(shared_ptr<Task> task, int priority, const string& modifiedBy);
+    void setDueDate(shared_ptr<Task> task, const chrono::system_clock::time_point& date,
+                    const string& modifiedBy);
+
+    // Agrupación: todo lo registrado hasta el endGroup() correspondiente
+    // se deshace junto; los grupos pueden anidarse
+    void beginGroup();
+    void endGroup();
+
+    // Deshacer / rehacer
+    bool undo();
+    bool redo();
+    bool canUndo() const;
+    bool canRedo() const;
+    string getUndoDescription() const;
+    string getRedoDescription() const;
+
+    // Métodos de utilidad
+    size_t getUndoCount() const;
+    size_t getRedoCount() const;
+    void clear();
+};
+
+#endif // UNDO_MANAGER_H
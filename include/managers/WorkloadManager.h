@@ -0,0 +1,68 @@
+#ifndef WORKLOAD_MANAGER_H
+#define WORKLOAD_MANAGER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "models/Project.h"
+
+using namespace std;
+
+/**
+ * @brief Carga de trabajo abierta de un usuario
+ */
+struct UserWorkload {
+    int userId;
+    int openTasks;
+    int pendingSubtasks;
+    double load;  // Suma de los pesos de sus tareas abiertas
+};
+
+/**
+ * @brief Sugerencia de asignación para una tarea sin asignar
+ */
+struct AssignmentSuggestion {
+    int boardId;
+    int taskId;
+    int userId;
+    double weight;
+};
+
+/**
+ * @brief Reporte de carga por usuario con sugerencias de balanceo
+ */
+struct WorkloadReport {
+    vector<UserWorkload> users;  // Mismo orden que Project::getAllUsers
+    vector<AssignmentSuggestion> suggestions;
+    int unassignedTasks;
+};
+
+/**
+ * @brief Calcula la carga de cada usuario y sugiere asignaciones
+ *
+ * Recorre todas las tareas del proyecto una sola vez acumulando en un
+ * índice por usuario, en lugar de buscar las tareas de cada usuario por
+ * separado. Las sugerencias usan el algoritmo voraz LPT: las tareas sin
+ * asignar, de mayor a menor peso, van al usuario con menos carga (montículo
+ * de mínimos), O(T log U).
+ */
+class WorkloadManager {
+private:
+    string doneState;
+
+public:
+    // Constructor
+    WorkloadManager(const string& doneState = "Terminado");
+
+    // Destructor
+    ~WorkloadManager();
+
+    // Peso de una tarea: prioridad + subtareas pendientes
+    static double getTaskWeight(const Task& task);
+
+    // Reporte completo del proyecto
+    WorkloadReport buildReport(shared_ptr<Project> project,
+                               bool includeSuggestions = true) const;
+};
+
+#endif // WORKLOAD_MANAGER_H
@@ -5,38 +5,107 @@
 #include <vector>
 #include <chrono>
 #include <memory>
+#include <cstdint>
+#include <functional>
+#include <shared_mutex>
+#include "utils/RingBuffer.h"
+#include "utils/CompactString.h"
 
 using namespace std;
 
 /**
  * @brief Estructura que representa una entrada en el registro de actividad
+ *
+ * Representación compacta: usuario y campo se guardan como ids internados
+ * en StringPool, la acción es un enum de un byte, los valores cortos viven
+ * dentro de la entrada y la descripción se genera al consultarla.
  */
 struct ActivityEntry {
-    chrono::system_clock::time_point timestamp;
-    string userName;       // Quién hizo el cambio
-    string actionType;     // "created", "moved", "updated", "deleted", "assigned"
-    string fieldModified;  // Campo que se modificó
-    string oldValue;       // Valor anterior
-    string newValue;       // Valor nuevo
-    string description;    // Descripción detallada del cambio
+    enum class Action : uint8_t {
+        CREATED,
+        MOVED,
+        UPDATED,
+        ASSIGNED,
+        DELETED,
+        RESTORED
+    };
+    
+    int64_t timestampTicks;  // Ticks de system_clock desde epoch
+    uint32_t userId;         // Quién hizo el cambio (StringPool)
+    uint32_t fieldId;        // Campo que se modificó (StringPool)
+    CompactString oldValue;  // Valor anterior
+    CompactString newValue;  // Valor nuevo
+    Action action;
     
-    ActivityEntry(const string& userName, const string& actionType,
-                  const string& fieldModified = "", 
+    ActivityEntry(const string& userName, Action action,
+                  const string& fieldModified = "",
                   const string& oldValue = "",
-                  const string& newValue = "",
-                  const string& description = "");
+                  const string& newValue = "");
+    
+    // Reconstrucción desde columnas ya internadas (EventStore)
+    ActivityEntry(const chrono::system_clock::time_point& timestamp,
+                  uint32_t userId, uint32_t fieldId, Action action,
+                  const CompactString& oldValue, const CompactString& newValue);
+    
+    // Getters
+    chrono::system_clock::time_point getTimestamp() const;
+    const string& getUserName() const;
+    const string& getFieldModified() const;
+    string getOldValue() const;
+    string getNewValue() const;
+    string getActionType() const;   // "created", "moved", ...
+    string getDescription() const;  // Texto derivado de la acción y los valores
     
     string toString() const;
+    
+    static string actionToString(Action action);
+    static bool actionFromString(const string& value, Action& action);
+};
+
+/**
+ * @brief Transición de estado extraída de las entradas "moved"
+ */
+struct StateTransition {
+    chrono::system_clock::time_point timestamp;
+    string fromState;
+    string toState;
 };
 
 /**
  * @brief Clase que mantiene un registro detallado de todas las actividades
  * Implementa un historial completo de cambios
+ *
+ * Las entradas viven en un buffer circular: al llegar a maxEntries la más
+ * antigua se sobrescribe en O(1). Si se configura un archivo de archivo,
+ * las entradas desalojadas se escriben ahí en lugar de perderse.
+ *
+ * Mientras las entradas llegan en orden cronológico (lo normal), las
+ * consultas por fecha buscan ambos extremos con búsqueda binaria. Una
+ * entrada fuera de orden desactiva sortedByTime y las consultas vuelven
+ * al recorrido lineal hasta el próximo clear().
+ *
+ * Todas las consultas leen con el lock compartido tomado: o devuelven
+ * copias, o recorren las entradas con un visitante dentro del lock. No hay
+ * referencias ni iteradores que sobrevivan a una inserción concurrente.
  */
 class ActivityLog {
 private:
-    vector<ActivityEntry> entries;
+    using EntryView = RingBuffer<ActivityEntry>;  // Recorrido de la más antigua a la más reciente
+    using EntryRange = pair<EntryView::const_iterator, EntryView::const_iterator>;
+    
+    EntryView entries;
     int maxEntries;  // Límite de entradas para evitar crecimiento indefinido
+    bool sortedByTime;
+    mutable shared_mutex mutex;
+    
+    // Archivo de entradas desalojadas
+    string archivePath;
+    vector<ActivityEntry> pendingArchive;
+    size_t archivedCount;
+    
+    void spill(const ActivityEntry& entry);  // Al archivo pendiente (con el lock tomado)
+    bool writePendingArchive();
+    EntryRange findDateRange(int64_t startTicks, int64_t endTicks) const;
 
 public:
     // Constructor
@@ -55,12 +124,30 @@ public:
     void logDeletion(const string& userName);
     
     // Consultas
-    const vector<ActivityEntry>& getEntries() const;
+    vector<ActivityEntry> getEntries() const;  // Copia, de la más antigua a la más reciente
+    void forEachEntry(const function<void(const ActivityEntry&)>& visitor) const;
     vector<ActivityEntry> getEntriesByUser(const string& userName) const;
     vector<ActivityEntry> getEntriesByActionType(const string& actionType) const;
+    vector<ActivityEntry> getEntriesByActionType(ActivityEntry::Action action) const;
     vector<ActivityEntry> getEntriesByDateRange(
         const chrono::system_clock::time_point& start,
         const chrono::system_clock::time_point& end) const;
+    vector<StateTransition> getStateTransitions() const;  // En orden cronológico
+    
+    // Rangos de fecha sin copiar entradas (extremos incluidos). Los
+    // visitantes corren con el lock compartido y no deben agregar entradas
+    size_t countByDateRange(const chrono::system_clock::time_point& start,
+                            const chrono::system_clock::time_point& end) const;
+    void forEachInDateRange(const chrono::system_clock::time_point& start,
+                            const chrono::system_clock::time_point& end,
+                            const function<void(const ActivityEntry&)>& visitor) const;
+    bool isSortedByTime() const;
+    
+    // Archivo en disco de entradas desalojadas
+    void setArchivePath(const string& path);
+    string getArchivePath() const;
+    bool flushArchive();
+    size_t getArchivedCount() const;
     
     // Métodos de utilidad
     void clear();
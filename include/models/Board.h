@@ -5,7 +5,10 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <functional>
+#include <cstdint>
 #include "Task.h"
+#include "utils/PoolAllocator.h"
 
 using namespace std;
 
@@ -28,8 +31,24 @@ private:
     // Todas las tareas del tablero (para búsqueda rápida por ID)
     map<int, shared_ptr<Task>> tasksById;
     
+    // Estado, prioridad, asignado y vencimiento en columnas para los filtros
+    TaskHotTable hotTable;
+    
     // Contador para IDs de tareas
     int nextTaskId;
+    
+    // Registro de actividad del proyecto al que pertenece el tablero
+    shared_ptr<EventStore> eventStore;
+    
+    // Bus de eventos: propio mientras el tablero no esté en un proyecto
+    shared_ptr<EventBus> eventBus;
+    
+    // Pool de memoria para las tareas del tablero y sus subtareas/registros.
+    // Cada objeto guarda una referencia al pool, que se libera completo
+    // cuando desaparecen el tablero y la última tarea creada en él
+    shared_ptr<SlabPoolResource> memoryPool;
+    
+    vector<shared_ptr<Task>> collectRows(vector<TaskHotTable::Row> rows) const;
 
 public:
     // Constructores
@@ -44,10 +63,15 @@ public:
     string getName() const;
     string getDescription() const;
     const vector<string>& getStates() const;
+    shared_ptr<EventStore> getEventStore() const;
+    shared_ptr<pmr::memory_resource> getMemoryPool() const;
+    shared_ptr<EventBus> getEventBus() const;
     
     // Setters
     void setName(const string& name);
     void setDescription(const string& description);
+    void setEventStore(shared_ptr<EventStore> store);  // Enlaza también las tareas existentes
+    void setEventBus(shared_ptr<EventBus> bus);        // Ídem
     
     // Gestión de estados
     void addState(const string& state);
@@ -56,11 +80,18 @@ public:
     bool hasState(const string& state) const;
     
     // Gestión de tareas
+    shared_ptr<Task> allocateTask(int id, const string& title,
+                                  const string& description = "");  // En el pool, sin agregarla
     shared_ptr<Task> createTask(const string& title, const string& description, 
                                       const string& initialState = "Pendiente");
     void addTask(shared_ptr<Task> task, const string& state);
     void removeTask(int taskId);
     void moveTask(int taskId, const string& newState, const string& movedBy);
+    bool relocateTask(int taskId, const string& newState, const string& movedBy,
+                      size_t position = SIZE_MAX);  // Sin validar dependencias; por defecto al final
+    size_t getTaskPosition(int taskId) const;  // Dentro de su columna
+    bool restoreTaskVersion(int taskId, shared_ptr<TaskMemento> memento,
+                            const string& restoredBy);  // Mueve de columna si hace falta
     
     // Búsqueda y filtrado
     shared_ptr<Task> findTaskById(int id) const;
@@ -68,7 +99,11 @@ public:
     vector<shared_ptr<Task>> getTasksByUser(int userId) const;
     vector<shared_ptr<Task>> getTasksByTag(const string& tag) const;
     vector<shared_ptr<Task>> getOverdueTasks() const;
+    vector<shared_ptr<Task>> getTasksDueBetween(const chrono::system_clock::time_point& from,
+                                                const chrono::system_clock::time_point& to) const;  // Sin terminar
     vector<shared_ptr<Task>> getAllTasks() const;
+    void forEachTask(const function<void(const Task&)>& visitor) const;  // Sin copiar punteros
+    const TaskHotTable& getHotTable() const;
     
     // Validaciones de dependencias
     bool canMoveTask(int taskId, const string& newState) const;
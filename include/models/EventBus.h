@@ -0,0 +1,322 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <string_view>
+#include <cstdint>
+
+using namespace std;
+
+class Task;
+class Board;
+
+/**
+ * @brief Tipos de evento del modelo (uno por canal del bus)
+ */
+enum class ModelEventType {
+    TASK_CREATED,
+    TASK_REMOVED,
+    TASK_MOVED,
+    FIELD_CHANGED,
+    DEPENDENCY_ADDED,
+    DEPENDENCY_REMOVED,
+    BOARD_ADDED,
+    BOARD_REMOVED,
+    BOARD_CLEARED,
+    COUNT
+};
+
+/**
+ * @brief Campos de una tarea que informa FieldChanged
+ */
+enum class TaskField {
+    TITLE,
+    DESCRIPTION,
+    ASSIGNEE,
+    DUE_DATE,
+    PRIORITY,
+    TAGS,
+    SUBTASKS,
+    RESTORED  // Se restauró una versión anterior (varios campos)
+};
+
+// Eventos. Los punteros y string_view solo son válidos durante la entrega:
+// quien necesite conservarlos debe copiarlos.
+
+// La tarea entró al tablero (nueva, cargada o restaurada)
+struct TaskCreated {
+    static constexpr ModelEventType TYPE = ModelEventType::TASK_CREATED;
+    int boardId;
+    const Task* task;
+    string_view state;
+};
+
+// La tarea salió del tablero; el objeto sigue vivo durante la entrega
+struct TaskRemoved {
+    static constexpr ModelEventType TYPE = ModelEventType::TASK_REMOVED;
+    int boardId;
+    const Task* task;
+    string_view state;
+};
+
+struct TaskMoved {
+    static constexpr ModelEventType TYPE = ModelEventType::TASK_MOVED;
+    int boardId;
+    const Task* task;
+    string_view fromState;
+    string_view toState;
+    string_view movedBy;
+    chrono::system_clock::time_point when;
+};
+
+struct FieldChanged {
+    static constexpr ModelEventType TYPE = ModelEventType::FIELD_CHANGED;
+    int boardId;
+    const Task* task;
+    TaskField field;
+};
+
+struct DependencyAdded {
+    static constexpr ModelEventType TYPE = ModelEventType::DEPENDENCY_ADDED;
+    int boardId;
+    const Task* task;
+    int dependencyId;
+};
+
+struct DependencyRemoved {
+    static constexpr ModelEventType TYPE = ModelEventType::DEPENDENCY_REMOVED;
+    int boardId;
+    const Task* task;
+    int dependencyId;
+};
+
+struct BoardAdded {
+    static constexpr ModelEventType TYPE = ModelEventType::BOARD_ADDED;
+    const Board* board;
+};
+
+struct BoardRemoved {
+    static constexpr ModelEventType TYPE = ModelEventType::BOARD_REMOVED;
+    int boardId;
+};
+
+// Se quitaron todas las tareas de un tablero (sin un TaskRemoved por tarea)
+struct BoardCleared {
+    static constexpr ModelEventType TYPE = ModelEventType::BOARD_CLEARED;
+    int boardId;
+};
+
+/**
+ * @brief Bus de eventos tipado para los cambios del modelo
+ *
+ * Cada tipo de evento tiene su propio canal con una lista de suscriptores
+ * inmutable. Publicar solo lee un puntero atómico y recorre la lista: no
+ * reserva memoria ni toma locks, y si el canal está vacío no hace nada.
+ * Suscribirse o desuscribirse copia la lista con un lock de escritura y
+ * publica la copia (copy-on-write).
+ *
+ * Cada canal cuenta las publicaciones en curso. Una lista reemplazada se
+ * retira y se libera cuando ese contador está en cero: la libera el
+ * escritor siguiente o la última publicación en curso al terminar (sin
+ * esperar el lock si está tomado). Así un lector concurrente nunca
+ * recorre una lista liberada y suscribir y desuscribir en bucle no
+ * acumula memoria.
+ *
+ * La entrega es síncrona, en el hilo que publica. Un suscriptor puede
+ * suscribir o desuscribir durante la entrega: el cambio rige desde la
+ * siguiente publicación.
+ */
+class EventBus {
+public:
+    struct Subscription {
+        ModelEventType type = ModelEventType::COUNT;
+        uint64_t id = 0;
+        
+        bool isValid() const { return id != 0; }
+    };
+
+private:
+    class ChannelBase {
+    public:
+        virtual ~ChannelBase() {}
+        virtual bool remove(uint64_t id) = 0;
+        virtual size_t getSubscriberCount() const = 0;
+    };
+    
+    template <typename E>
+    class Channel : public ChannelBase {
+    private:
+        struct Subscriber {
+            uint64_t id;
+            function<void(const E&)> handler;
+        };
+        using List = vector<Subscriber>;
+        
+        atomic<const List*> current;
+        unique_ptr<List> owned;           // Dueño de current
+        mutable vector<unique_ptr<List>> retired;  // Reemplazadas que aún puede leer una publicación
+        mutable atomic<size_t> retiredCount;
+        mutable atomic<size_t> publishing;  // Publicaciones en curso
+        mutable mutex writeMutex;
+        
+        // Con writeMutex tomado. Quien entre a publicar después de ver
+        // publishing == 0 ya lee la lista nueva (orden secuencial)
+        void reclaim() const {
+            if (publishing.load() != 0) return;
+            retired.clear();
+            retired.shrink_to_fit();  // Una entrega larga pudo acumular muchas
+            retiredCount.store(0);
+        }
+        
+        void replace(unique_ptr<List> next) {
+            current.store(next.get());
+            if (owned) {
+                retired.push_back(move(owned));
+                retiredCount.store(retired.size());
+            }
+            owned = move(next);
+            reclaim();
+        }
+    
+    public:
+        Channel() : current(nullptr), retiredCount(0), publishing(0) {}
+        
+        void add(uint64_t id, function<void(const E&)> handler) {
+            lock_guard<mutex> lock(writeMutex);
+            const List* list = owned.get();
+            auto next = list ? make_unique<List>(*list) : make_unique<List>();
+            next->push_back({id, move(handler)});
+            replace(move(next));
+        }
+        
+        bool remove(uint64_t id) override {
+            lock_guard<mutex> lock(writeMutex);
+            const List* list = owned.get();
+            if (!list) return false;
+            
+            auto next = make_unique<List>();
+            for (const auto& subscriber : *list) {
+                if (subscriber.id != id) {
+                    next->push_back(subscriber);
+                }
+            }
+            if (next->size() == list->size()) return false;
+            
+            replace(move(next));
+            return true;
+        }
+        
+        size_t getSubscriberCount() const override {
+            publishing.fetch_add(1);
+            const List* list = current.load();
+            size_t count = list ? list->size() : 0;
+            publishing.fetch_sub(1);
+            return count;
+        }
+        
+        void publish(const E& event) const {
+            publishing.fetch_add(1);
+            const List* list = current.load();
+            if (list) {
+                for (const auto& subscriber : *list) {
+                    subscriber.handler(event);
+                }
+            }
+            
+            // La última en salir libera lo retirado durante la entrega
+            if (publishing.fetch_sub(1) == 1 && retiredCount.load() > 0) {
+                unique_lock<mutex> lock(writeMutex, try_to_lock);
+                if (lock.owns_lock()) {
+                    reclaim();
+                }
+            }
+        }
+    };
+    
+    array<unique_ptr<ChannelBase>, static_cast<size_t>(ModelEventType::COUNT)> channels;
+    atomic<uint64_t> nextSubscriptionId;
+    
+    template <typename E>
+    Channel<E>& channel() const {
+        return static_cast<Channel<E>&>(*channels[static_cast<size_t>(E::TYPE)]);
+    }
+
+public:
+    // Constructor
+    EventBus();
+    
+    // Destructor
+    ~EventBus();
+    
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+    
+    // Suscripción
+    template <typename E>
+    Subscription subscribe(function<void(const E&)> handler) {
+        Subscription subscription;
+        subscription.type = E::TYPE;
+        subscription.id = nextSubscriptionId.fetch_add(1, memory_order_relaxed);
+        channel<E>().add(subscription.id, move(handler));
+        return subscription;
+    }
+    
+    bool unsubscribe(const Subscription& subscription);
+    
+    // Publicación
+    template <typename E>
+    void publish(const E& event) const {
+        channel<E>().publish(event);
+    }
+    
+    template <typename E>
+    bool hasSubscribers() const {
+        return channel<E>().getSubscriberCount() > 0;
+    }
+    
+    size_t getSubscriberCount(ModelEventType type) const;
+};
+
+/**
+ * @brief Conjunto de suscripciones a un bus que se cancelan juntas
+ *
+ * Se desuscribe al destruirse o con reset(); si el bus ya no existe no
+ * hace nada.
+ */
+class EventSubscriptions {
+private:
+    weak_ptr<EventBus> bus;
+    vector<EventBus::Subscription> subscriptions;
+
+public:
+    // Constructores
+    EventSubscriptions();
+    explicit EventSubscriptions(shared_ptr<EventBus> bus);
+    
+    // Destructor
+    ~EventSubscriptions();
+    
+    EventSubscriptions(const EventSubscriptions&) = delete;
+    EventSubscriptions& operator=(const EventSubscriptions&) = delete;
+    EventSubscriptions(EventSubscriptions&& other) noexcept;
+    EventSubscriptions& operator=(EventSubscriptions&& other) noexcept;
+    
+    template <typename E>
+    void subscribe(function<void(const E&)> handler) {
+        if (auto target = bus.lock()) {
+            subscriptions.push_back(target->subscribe<E>(move(handler)));
+        }
+    }
+    
+    shared_ptr<EventBus> getBus() const;
+    bool isAttachedTo(const shared_ptr<EventBus>& other) const;
+    void reset();
+};
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,127 @@
+#ifndef EVENT_STORE_H
+#define EVENT_STORE_H
+
+#include <string>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstdint>
+#include "ActivityLog.h"
+
+using namespace std;
+
+/**
+ * @brief Registro de actividad central de un proyecto (solo agregar)
+ *
+ * Guarda los eventos de todas las tareas en columnas paralelas, una fila
+ * por evento. Cada tarea escribe en su propio flujo (stream), registrado
+ * por par tablero/tarea porque los ids de tarea se repiten entre tableros.
+ *
+ * Índices:
+ * - timeOrder: filas ordenadas por timestamp para rangos con búsqueda binaria
+ * - listas de filas por usuario, por tipo de acción y por flujo
+ *
+ * Las listas de filas crecen en orden de inserción, así que también están
+ * ordenadas por número de fila.
+ *
+ * Un flujo liberado (tarea quitada del tablero) deja de estar indexado por
+ * su par tablero/tarea: una tarea nueva que reciba el mismo id empieza con
+ * un flujo vacío en lugar de heredar la historia. Sus filas se conservan
+ * hasta la próxima compactación, que ocurre sola cuando las filas de
+ * flujos liberados son al menos la mitad del store (y más de un mínimo);
+ * así el costo se amortiza entre los eventos agregados. La compactación
+ * renumera las filas, de modo que los números de fila devueltos por las
+ * consultas solo valen hasta entonces; los ids de flujo no cambian. Una
+ * tarea quitada que vuelve al tablero (deshacer) después de una
+ * compactación conserva su flujo pero sin los eventos anteriores.
+ */
+class EventStore {
+public:
+    using Row = uint32_t;
+    using StreamId = uint32_t;
+
+private:
+    static const size_t ACTION_COUNT = 6;
+
+    // Columnas
+    vector<int64_t> timestamps;
+    vector<uint32_t> userIds;
+    vector<uint32_t> fieldIds;
+    vector<uint8_t> actions;
+    vector<StreamId> streams;
+    vector<CompactString> oldValues;
+    vector<CompactString> newValues;
+
+    // Índices
+    mutable vector<Row> timeOrder;
+    mutable bool timeOrderDirty;  // Hubo filas fuera de orden; se ordena al consultar
+    unordered_map<uint32_t, vector<Row>> rowsByUser;
+    array<vector<Row>, ACTION_COUNT> rowsByAction;
+    vector<vector<Row>> rowsByStream;
+
+    // Flujos: (tablero, tarea) de cada uno
+    vector<pair<int, int>> streamOwners;
+    vector<bool> streamReleased;
+    map<pair<int, int>, StreamId> streamIndex;
+    
+    // Retención: filas de flujos liberados que la compactación descartará
+    static const size_t DEFAULT_COMPACTION_MIN_ROWS = 65536;
+    size_t releasedRows;
+    size_t compactionMinRows;
+
+    mutable shared_mutex mutex;
+
+    void sortTimeOrder() const;
+    void compactLocked();
+    static void remapRows(vector<Row>& rows, const vector<Row>& newIndex);
+    pair<size_t, size_t> rangeBounds(int64_t startTicks, int64_t endTicks) const;
+
+public:
+    // Constructor
+    EventStore();
+
+    // Destructor
+    ~EventStore();
+
+    // Flujos
+    StreamId registerStream(int boardId, int taskId);
+    void releaseStream(int boardId, int taskId);  // El próximo registro del par crea uno nuevo
+    pair<int, int> getStreamOwner(StreamId stream) const;  // (tablero, tarea)
+
+    // Agregar eventos
+    Row append(StreamId stream, const ActivityEntry& entry);
+
+    // Acceso por fila
+    ActivityEntry getEntry(Row row) const;
+    StreamId getStream(Row row) const;
+    chrono::system_clock::time_point getTimestamp(Row row) const;
+
+    // Consultas entre tareas (filas en orden cronológico)
+    vector<Row> getRowsByUser(const string& userName) const;
+    vector<Row> getRowsByAction(ActivityEntry::Action action) const;
+    vector<Row> getRowsByDateRange(const chrono::system_clock::time_point& start,
+                                   const chrono::system_clock::time_point& end) const;
+    size_t countByDateRange(const chrono::system_clock::time_point& start,
+                            const chrono::system_clock::time_point& end) const;
+    vector<ActivityEntry> getEntries(const vector<Row>& rows) const;
+
+    // Vista por tarea
+    size_t getStreamSize(StreamId stream) const;
+    vector<ActivityEntry> getStreamEntries(StreamId stream) const;
+    vector<StateTransition> getStreamTransitions(StreamId stream) const;
+
+    // Retención
+    size_t compact();  // Descarta las filas de flujos liberados; devuelve cuántas
+    void setCompactionMinRows(size_t rows);
+    size_t getReleasedRowCount() const;
+    
+    // Métodos de utilidad
+    size_t getSize() const;
+    void clear();
+};
+
+#endif // EVENT_STORE_H
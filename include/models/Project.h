@@ -27,6 +27,12 @@ private:
     // Usuarios del proyecto
     map<int, shared_ptr<User>> users;
     
+    // Registro de actividad de todas las tareas del proyecto
+    shared_ptr<EventStore> eventStore;
+    
+    // Bus de eventos compartido por todos los tableros del proyecto
+    shared_ptr<EventBus> eventBus;
+    
     // Contadores para IDs
     int nextBoardId;
     int nextUserId;
@@ -45,6 +51,8 @@ public:
     string getDescription() const;
     chrono::system_clock::time_point getCreatedDate() const;
     const vector<shared_ptr<Board>>& getBoards() const;
+    shared_ptr<EventStore> getEventStore() const;
+    shared_ptr<EventBus> getEventBus() const;
     
     // Setters
     void setName(const string& name);
@@ -4,12 +4,21 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <iterator>
+#include <utility>
 
 using namespace std;
 
+class SubtaskIndex;
+
 /**
  * @brief Clase que representa una subtarea anidada
  * Implementa una estructura de árbol para subtareas anidadas
+ *
+ * Cada nodo guarda cuántas subtareas hay en su subárbol (incluido él) y
+ * cuántas están completadas; se actualizan subiendo por la cadena de
+ * padres, así que contar es O(1). Si el árbol pertenece a una tarea,
+ * owner apunta al índice plano de esa tarea.
  */
 class Subtask : public enable_shared_from_this<Subtask> {
 private:
@@ -18,8 +27,78 @@ private:
     string description;
     bool completed;
     vector<shared_ptr<Subtask>> childSubtasks;  // Subtareas anidadas
+    
+    // Estructura derivada (la mantienen Subtask y SubtaskIndex)
+    Subtask* parent;
+    SubtaskIndex* owner;
+    int ownerIndex;        // Posición en el índice del dueño, -1 si no tiene
+    int subtreeTotal;
+    int subtreeCompleted;
+    
+    friend class SubtaskIndex;
+    void propagateCounts(int totalDelta, int completedDelta);
 
 public:
+    /**
+     * @brief Recorrido en preorden (padre antes que hijos) con pila explícita
+     */
+    class PreOrderIterator {
+    private:
+        vector<pair<Subtask*, int>> stack;  // (nodo, profundidad relativa)
+
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = Subtask;
+        using difference_type = ptrdiff_t;
+        using pointer = Subtask*;
+        using reference = Subtask&;
+
+        PreOrderIterator() {}
+        explicit PreOrderIterator(Subtask* root);
+
+        reference operator*() const { return *stack.back().first; }
+        pointer operator->() const { return stack.back().first; }
+        int depth() const { return stack.back().second; }
+
+        PreOrderIterator& operator++();
+        bool operator==(const PreOrderIterator& other) const;
+        bool operator!=(const PreOrderIterator& other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief Recorrido en postorden (hijos antes que el padre) con pila explícita
+     */
+    class PostOrderIterator {
+    private:
+        vector<pair<Subtask*, size_t>> stack;  // (nodo, próximo hijo a visitar)
+        void descend();
+
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = Subtask;
+        using difference_type = ptrdiff_t;
+        using pointer = Subtask*;
+        using reference = Subtask&;
+
+        PostOrderIterator() {}
+        explicit PostOrderIterator(Subtask* root);
+
+        reference operator*() const { return *stack.back().first; }
+        pointer operator->() const { return stack.back().first; }
+
+        PostOrderIterator& operator++();
+        bool operator==(const PostOrderIterator& other) const;
+        bool operator!=(const PostOrderIterator& other) const { return !(*this == other); }
+    };
+
+    template <typename Iterator>
+    struct Range {
+        Iterator first;
+        Iterator last;
+        Iterator begin() const { return first; }
+        Iterator end() const { return last; }
+    };
+
     // Constructores
     Subtask();
     Subtask(int id, const string& title, const string& description = "");
@@ -33,6 +112,7 @@ public:
     string getDescription() const;
     bool isCompleted() const;
     const vector<shared_ptr<Subtask>>& getChildSubtasks() const;
+    Subtask* getParent() const;
     
     // Setters
     void setTitle(const string& title);
@@ -44,8 +124,16 @@ public:
     void removeChildSubtask(int subtaskId);
     shared_ptr<Subtask> findSubtaskById(int id);
     
+    // Recorridos del subárbol (incluye este nodo); sin recursión
+    Range<PreOrderIterator> preOrder();
+    Range<PostOrderIterator> postOrder();
+    
+    // Operaciones sobre todo el subárbol: cada nodo se visita una vez
+    int setSubtreeCompleted(bool completed);  // Devuelve cuántos nodos cambiaron
+    bool isAncestorOf(const Subtask* other) const;
+    
     // Métodos de utilidad
-    int countTotalSubtasks() const;  // Cuenta todas las subtareas recursivamente
+    int countTotalSubtasks() const;  // Incluye esta subtarea y todas las anidadas
     int countCompletedSubtasks() const;
     double getCompletionPercentage() const;
     string toString(int depth = 0) const;
@@ -0,0 +1,67 @@
+#ifndef SUBTASK_INDEX_H
+#define SUBTASK_INDEX_H
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include "Subtask.h"
+
+using namespace std;
+
+/**
+ * @brief Índice plano de todas las subtareas de una tarea
+ *
+ * Cada subtarea del árbol (a cualquier profundidad) ocupa una posición en
+ * un arreglo junto con la posición de su padre (-1 para las raíces). Un
+ * mapa id → posición da búsqueda en O(1), y los totales de la tarea se
+ * mantienen al agregar, quitar o completar subtareas.
+ *
+ * Al quitar un nodo, el último del arreglo ocupa su lugar, así que las
+ * posiciones no son estables entre cambios; los ids sí lo son. Los ids
+ * repetidos o no positivos se reemplazan por uno nuevo al registrar.
+ */
+class SubtaskIndex {
+private:
+    struct Node {
+        shared_ptr<Subtask> subtask;
+        int parentIndex;
+    };
+
+    vector<Node> nodes;
+    unordered_map<int, size_t> indexById;
+    int completedCount;
+    int nextId;
+
+    void removeAt(size_t index);
+
+public:
+    // Constructor
+    SubtaskIndex();
+
+    // Destructor
+    ~SubtaskIndex();
+
+    SubtaskIndex(const SubtaskIndex&) = delete;
+    SubtaskIndex& operator=(const SubtaskIndex&) = delete;
+
+    // Registro de subárboles
+    void registerSubtree(shared_ptr<Subtask> root, int parentIndex);
+    void unregisterSubtree(Subtask* root);
+
+    // Consultas
+    shared_ptr<Subtask> find(int id) const;
+    shared_ptr<Subtask> getNode(size_t index) const;
+    int getParentIndex(size_t index) const;
+    size_t size() const;
+    int getTotalCount() const;
+    int getCompletedCount() const;
+    double getCompletionPercentage() const;
+
+    // Llamado por Subtask al cambiar su estado
+    void adjustCompleted(int delta);
+
+    // Métodos de utilidad
+    void clear();
+};
+
+#endif // SUBTASK_INDEX_H
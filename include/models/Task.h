@@ -6,9 +6,16 @@
 #include <memory>
 #include <chrono>
 #include <set>
+#include <memory_resource>
+#include <cstdint>
 #include "Subtask.h"
+#include "SubtaskIndex.h"
 #include "TaskMemento.h"
+#include "TaskHistory.h"
 #include "ActivityLog.h"
+#include "EventStore.h"
+#include "TaskHotTable.h"
+#include "EventBus.h"
 
 
 using namespace std;
@@ -28,20 +35,44 @@ private:
     chrono::system_clock::time_point createdDate;
     int priority;  // 1 (baja) - 5 (alta)
     
-    // Subtareas
+    // Subtareas (raíces) e índice plano de todo el árbol
     vector<shared_ptr<Subtask>> subtasks;
+    unique_ptr<SubtaskIndex> subtaskIndex;
     
     // Dependencias (IDs de tareas de las que depende esta tarea)
     set<int> dependencies;
     
     // Control de versiones (Patrón Memento)
-    vector<shared_ptr<TaskMemento>> history;
+    TaskHistory history;  // Últimas 50 versiones
     
-    // Registro de actividad
+    // Registro de actividad: en el EventStore del proyecto si la tarea está
+    // en uno; si no, en un registro propio creado con el primer cambio
     shared_ptr<ActivityLog> activityLog;
+    shared_ptr<EventStore> eventStore;
+    EventStore::StreamId streamId;
     
     // Tags/Etiquetas
     vector<string> tags;
+    
+    // Pool del tablero donde se creó la tarea (nulo: memoria general)
+    shared_ptr<pmr::memory_resource> memoryPool;
+    
+    // Fila en la tabla de campos calientes del tablero (nulo: fuera de un tablero)
+    TaskHotTable* hotTable;
+    TaskHotTable::Row hotRow;
+    friend class TaskHotTable;
+    
+    // Bus de eventos del tablero donde está la tarea (nulo: sin observadores)
+    shared_ptr<EventBus> eventBus;
+    int boardId;
+    
+    // Cambia con cada modificación visible; único entre todas las tareas
+    uint64_t contentVersion;
+    
+    void recordActivity(const ActivityEntry& entry);
+    void recordVersion(const string& modifiedBy);
+    void syncHotRow();
+    void publishFieldChanged(TaskField field);
 
 public:
     // Constructores
@@ -61,9 +92,14 @@ public:
     chrono::system_clock::time_point getCreatedDate() const;
     int getPriority() const;
     const vector<shared_ptr<Subtask>>& getSubtasks() const;
+    const SubtaskIndex& getSubtaskIndex() const;
     const set<int>& getDependencies() const;
     const vector<string>& getTags() const;
-    shared_ptr<ActivityLog> getActivityLog() const;
+    // Registro de actividad: copias al momento de la consulta, en orden de
+    // registro; vacío si la tarea todavía no cambió
+    vector<ActivityEntry> getActivityEntries() const;
+    size_t getActivityCount() const;
+    vector<StateTransition> getStateTransitions() const;
     
     // Setters
     void setTitle(const string& title, const string& modifiedBy);
@@ -73,10 +109,33 @@ public:
     void setDueDate(const chrono::system_clock::time_point& date);
     void setPriority(int priority);
     
+    // Registro de actividad central
+    void bindEventStore(shared_ptr<EventStore> store, int boardId);
+    shared_ptr<EventStore> getEventStore() const;
+    
+    // Eventos
+    void bindEventBus(shared_ptr<EventBus> bus, int boardId);  // Nulo: deja de publicar
+    shared_ptr<EventBus> getEventBus() const;
+    int getBoardId() const;  // -1 fuera de un tablero
+    
+    // Versión del contenido (clave de cachés de dibujo)
+    uint64_t getContentVersion() const;
+    void touch();  // Para cambios hechos por fuera de la tarea (p. ej. en una subtarea)
+    
+    // Memoria
+    void setMemoryPool(shared_ptr<pmr::memory_resource> pool);
+    shared_ptr<pmr::memory_resource> getMemoryPool() const;
+    
     // Gestión de subtareas
+    shared_ptr<Subtask> allocateSubtask(const string& title,
+                                        const string& description = "");  // Sin agregarla
     void addSubtask(shared_ptr<Subtask> subtask);
+    void insertSubtask(size_t position, shared_ptr<Subtask> subtask);
     void removeSubtask(int subtaskId);
+    void removeSubtaskAt(size_t position);
     shared_ptr<Subtask> findSubtaskById(int id);
+    bool setSubtreeCompleted(int subtaskId, bool completed);
+    bool moveSubtaskTo(int subtaskId, Task& target, int newParentId = -1);  // -1: como raíz
     double getSubtaskCompletionPercentage() const;
     
     // Gestión de dependencias
@@ -92,8 +151,8 @@ public:
     
     // Patrón Memento - Control de versiones
     shared_ptr<TaskMemento> createMemento(const string& modifiedBy);
-    void restoreFromMemento(shared_ptr<TaskMemento> memento);
-    const vector<shared_ptr<TaskMemento>>& getHistory() const;
+    void restoreFromMemento(shared_ptr<TaskMemento> memento);  // En un tablero: Board::restoreTaskVersion
+    const TaskHistory& getHistory() const;
     
     // Validaciones
     bool canStart() const;  // Verifica si puede iniciarse (dependencias completadas)
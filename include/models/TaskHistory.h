@@ -0,0 +1,75 @@
+#ifndef TASK_HISTORY_H
+#define TASK_HISTORY_H
+
+#include <string>
+#include <deque>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include "TaskMemento.h"
+
+using namespace std;
+
+/**
+ * @brief Historial de versiones de una tarea con almacenamiento compacto
+ *
+ * - Título, estado y autor se comparten entre versiones mientras no cambian
+ * - La descripción se guarda como diferencia con la versión anterior
+ *   (prefijo y sufijo comunes + texto nuevo en medio), con una versión
+ *   completa (keyframe) cada keyframeInterval versiones
+ * - Al superar la capacidad se descarta la versión más antigua en O(1);
+ *   si la siguiente era una diferencia se convierte en keyframe
+ *
+ * Reconstruir la versión k aplica como mucho keyframeInterval diferencias.
+ */
+class TaskHistory {
+private:
+    struct Version {
+        shared_ptr<const string> title;
+        shared_ptr<const string> state;
+        shared_ptr<const string> modifiedBy;
+        int assignedUserId;
+        int64_t timestampTicks;
+
+        // Descripción: keyframe completo, o diferencia con la versión anterior
+        shared_ptr<const string> keyframe;
+        uint32_t prefixLength;
+        uint32_t suffixLength;
+        string middle;
+
+        bool isKeyframe() const { return keyframe != nullptr; }
+    };
+
+    deque<Version> versions;
+    shared_ptr<const string> latestDescription;
+    size_t capacity;
+    size_t keyframeInterval;
+    size_t sinceKeyframe;  // Diferencias desde el último keyframe
+
+    static shared_ptr<const string> shareIfEqual(const shared_ptr<const string>& previous,
+                                                 const string& value);
+    shared_ptr<const string> buildDescription(size_t index) const;
+
+public:
+    // Constructor
+    TaskHistory(size_t capacity = 50, size_t keyframeInterval = 8);
+
+    // Agregar versión
+    void record(const string& title, const string& description, const string& state,
+                int assignedUserId, const string& modifiedBy);
+
+    // Acceso (0 = versión más antigua)
+    shared_ptr<TaskMemento> getVersion(size_t index) const;
+    shared_ptr<TaskMemento> operator[](size_t index) const;
+    chrono::system_clock::time_point getTimestamp(size_t index) const;
+    const string& getModifiedBy(size_t index) const;
+
+    // Métodos de utilidad
+    size_t size() const;
+    bool empty() const;
+    size_t getCapacity() const;
+    size_t getMemoryUsage() const;  // Bytes aproximados de las descripciones guardadas
+    void clear();
+};
+
+#endif // TASK_HISTORY_H
@@ -0,0 +1,78 @@
+#ifndef TASK_HOT_TABLE_H
+#define TASK_HOT_TABLE_H
+
+#include <vector>
+#include <cstdint>
+#include <string>
+#include <chrono>
+#include "utils/SelectionKernels.h"
+
+using namespace std;
+
+class Task;
+
+/**
+ * @brief Copia en columnas (struct-of-arrays) de los campos de las tareas
+ * de un tablero que usan los recorridos: estado, prioridad, asignado y
+ * vencimiento
+ *
+ * Cada tarea del tablero ocupa una fila; la tarea conoce su fila y avisa
+ * a la tabla cuando cambia alguno de esos campos. Los filtros recorren
+ * arreglos contiguos de enteros en lugar de objetos Task dispersos. El
+ * orden de las filas no es estable: quitar una tarea mueve la última a
+ * su lugar.
+ */
+class TaskHotTable {
+public:
+    using Row = uint32_t;
+
+private:
+    vector<uint32_t> stateIds;     // Ids de StringPool
+    vector<int32_t> priorities;
+    vector<int32_t> assigneeIds;
+    vector<int64_t> dueTicks;      // Ticks de system_clock desde epoch
+    vector<int32_t> taskIds;
+    vector<Task*> tasks;
+
+    void writeRow(Row row, const Task& task);
+
+public:
+    // Constructor
+    TaskHotTable();
+    
+    // Destructor: desvincula las tareas que sigan en la tabla
+    ~TaskHotTable();
+    
+    TaskHotTable(const TaskHotTable&) = delete;
+    TaskHotTable& operator=(const TaskHotTable&) = delete;
+    
+    // Filas
+    void insert(Task& task);
+    void remove(Task& task);
+    void update(const Task& task);
+    void clear();
+    
+    // Columnas
+    const vector<uint32_t>& getStateIds() const;
+    const vector<int32_t>& getPriorities() const;
+    const vector<int32_t>& getAssigneeIds() const;
+    const vector<int64_t>& getDueTicks() const;
+    const vector<int32_t>& getTaskIds() const;
+    Task* getTask(Row row) const;
+    size_t size() const;
+    
+    // Filtros (devuelven filas en orden de la tabla)
+    SelectionKernels::Columns getColumns() const;
+    void select(const SelectionKernels::Predicate& predicate, vector<uint64_t>& bitmap) const;
+    vector<Row> selectRows(const SelectionKernels::Predicate& predicate) const;
+    vector<Row> selectOverdue(uint32_t doneStateId, int64_t nowTicks) const;  // Vence antes de nowTicks
+    vector<Row> selectDueBetween(uint32_t doneStateId, int64_t fromTicks, int64_t toTicks) const;  // Exclusivo
+    vector<Row> selectByAssignee(int32_t userId) const;
+    size_t countByState(uint32_t stateId) const;
+    
+    // Conversión
+    static int64_t toTicks(const chrono::system_clock::time_point& tp);
+    static uint32_t stateIdOf(const string& state);
+};
+
+#endif // TASK_HOT_TABLE_H
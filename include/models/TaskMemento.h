@@ -13,18 +13,21 @@ using namespace std;
  */
 class TaskMemento {
 private:
-    string title;
-    string description;
-    string state;
+    // Cadenas inmutables compartidas con las versiones vecinas que no las cambiaron
+    shared_ptr<const string> title;
+    shared_ptr<const string> description;
+    shared_ptr<const string> state;
     int assignedUserId;
     chrono::system_clock::time_point timestamp;
-    string modifiedBy;  // Usuario que hizo el cambio
+    shared_ptr<const string> modifiedBy;  // Usuario que hizo el cambio
     
-    // Constructor privado, solo Task puede crear mementos
+    // Constructor privado, solo Task y TaskHistory pueden crear mementos
     friend class Task;
-    TaskMemento(const string& title, const string& description, 
-                const string& state, int assignedUserId,
-                const string& modifiedBy);
+    friend class TaskHistory;
+    TaskMemento(shared_ptr<const string> title, shared_ptr<const string> description,
+                shared_ptr<const string> state, int assignedUserId,
+                shared_ptr<const string> modifiedBy,
+                const chrono::system_clock::time_point& timestamp);
 
 public:
     // Getters
@@ -8,10 +8,13 @@
 #include <QScrollArea>
 #include <QPushButton>
 #include <QFrame>
+#include <QTimer>
 #include <memory>
 #include <map>
+#include <set>
 #include <string>
 #include "models/Board.h"
+#include "managers/UndoManager.h"
 #include "TaskCard.h"
 #include "ColumnWidget.h"
 
@@ -19,6 +22,17 @@ using namespace std;
 
 /**
  * @brief Widget que muestra un tablero Kanban
+ *
+ * Escucha el bus de eventos del tablero y actualiza solo lo que cambió:
+ * cada evento marca columnas o tarjetas como pendientes y, en la siguiente
+ * vuelta del ciclo de eventos, las columnas marcadas se comparan con el
+ * orden del tablero. Las tarjetas se mueven entre columnas en lugar de
+ * recrearse; solo se construyen las de tareas nuevas y se destruyen las de
+ * tareas quitadas.
+ *
+ * Las columnas que superan el umbral de virtualización muestran sus tareas
+ * en un QListView que solo pinta las filas visibles, en lugar de un widget
+ * por tarea.
  */
 class BoardWidget : public QWidget {
     Q_OBJECT
@@ -26,6 +40,7 @@ class BoardWidget : public QWidget {
 private:
     shared_ptr<Board> board;
     string currentUserName;
+    shared_ptr<UndoManager> undoManager;  // Opcional: registra movimientos y altas/bajas
     
     QVBoxLayout* mainLayout;
     QScrollArea* scrollArea;
@@ -38,15 +53,31 @@ private:
     // Mapa de tarjetas de tareas
     map<int, TaskCard*> taskCards;
     
+    // Columnas con al menos esta cantidad de tareas se virtualizan
+    static const int DEFAULT_VIRTUALIZATION_THRESHOLD = 200;
+    int virtualizationThreshold;
+    
+    // Cambios pendientes de aplicar (se juntan hasta la próxima vuelta)
+    EventSubscriptions subscriptions;
+    set<string> dirtyStates;
+    set<int> dirtyCards;
+    QTimer* syncTimer;
+    
     void setupUI();
     void createColumns();
-    void populateTasks();
+    void subscribeToBoard();
+    void markStateDirty(const string& state);
+    void markCardDirty(int taskId);
+    void syncColumn(const string& state, vector<TaskCard*>& detached);
+    void detachCards(QVBoxLayout* layout, int keep, vector<TaskCard*>& detached);
+    TaskCard* createCard(shared_ptr<Task> task);
     
 private slots:
     void onAddTaskClicked(const string& state);
     void onTaskCardClicked(int taskId);
     void onTaskCardMoved(int taskId, const string& newState);
     void onRefresh();
+    void applyPendingChanges();
 
 signals:
     void taskSelected(int taskId);
@@ -60,6 +91,9 @@ public:
     ~BoardWidget();
     
     shared_ptr<Board> getBoard() const;
+    void setUndoManager(shared_ptr<UndoManager> undoManager);
+    void setVirtualizationThreshold(int threshold);
+    int getVirtualizationThreshold() const;
     void refresh();
     void addTask(shared_ptr<Task> task);
     void updateTask(shared_ptr<Task> task);
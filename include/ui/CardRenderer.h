@@ -0,0 +1,76 @@
+#ifndef CARD_RENDERER_H
+#define CARD_RENDERER_H
+
+#include <QPainter>
+#include <QPixmap>
+#include <QColor>
+#include <QFont>
+#include <QString>
+#include "models/Task.h"
+
+using namespace std;
+
+/**
+ * @brief Dibuja las tarjetas de tarea con un estilo único compartido
+ *
+ * TaskCard y TaskCardDelegate dibujan con la misma instancia en lugar de
+ * aplicar cada tarjeta su propia hoja de estilos y su propio
+ * QGraphicsDropShadowEffect. La tarjeta (fondo, borde y textos) se dibuja
+ * una vez en un pixmap de QPixmapCache con clave versión de contenido de
+ * la tarea + tamaño + estado visual: mientras la tarea no cambie, pintarla
+ * es copiar ese pixmap. La sombra es un nine-patch pre-renderizado por
+ * estado que se estira al tamaño de cada tarjeta.
+ */
+class CardRenderer {
+public:
+    enum class State {
+        NORMAL,
+        HOVER,
+        SELECTED,
+        HIGHLIGHTED,
+        COUNT
+    };
+    
+    static const int SHADOW_MARGIN = 6;  // Espacio alrededor de la tarjeta para la sombra
+
+private:
+    // Aspecto de un estado visual
+    struct Style {
+        QColor background;
+        QColor border;
+        int borderWidth;
+        QColor shadow;
+        int shadowBlur;
+        int shadowOffset;
+    };
+    
+    static const int MAX_INFO_LINES = 4;
+    static const int MARGIN = 10;
+    static const int SPACING = 6;
+    static const int RADIUS = 8;
+    static const int CACHE_LIMIT_KB = 64 * 1024;
+    
+    QFont titleFont;
+    QFont infoFont;
+    int cardHeight;  // Sin la sombra
+    
+    static const Style& getStyle(State state);
+    static QPixmap getShadow(State state);
+    QPixmap getCardPixmap(const Task& task, const QSize& size, State state, qreal dpr) const;
+    void paintCard(QPainter* painter, const QRect& card, const Task& task, State state) const;
+
+public:
+    // Constructor
+    explicit CardRenderer(const QFont& baseFont);
+    
+    // Instancia compartida, con la fuente de la aplicación
+    static const CardRenderer& instance();
+    
+    // Medidas (con el margen de la sombra)
+    int getHeight() const;
+    
+    // Dibujo: la tarjeta ocupa rect menos SHADOW_MARGIN por lado
+    void paint(QPainter* painter, const QRect& rect, const Task& task, State state) const;
+};
+
+#endif // CARD_RENDERER_H
@@ -6,14 +6,21 @@
 #include <QLabel>
 #include <QScrollArea>
 #include <QPushButton>
+#include <QListView>
 #include <QDragEnterEvent>
 #include <QDropEvent>
 #include <string>
+#include "TaskListModel.h"
 
 using namespace std;
 
 /**
  * @brief Widget de columna que acepta drops de tareas
+ *
+ * Muestra las tareas como TaskCard dentro de un QScrollArea o, en modo
+ * virtualizado, en un QListView con TaskListModel y TaskCardDelegate que
+ * solo dibuja las filas visibles. BoardWidget elige el modo según la
+ * cantidad de tareas.
  */
 class ColumnWidget : public QWidget {
     Q_OBJECT
@@ -27,11 +34,15 @@ private:
     QScrollArea* scrollArea;
     QWidget* tasksContainer;
     QVBoxLayout* tasksLayout;
+    QListView* listView;
+    TaskListModel* taskModel;
     QPushButton* addButton;
     
     bool isHighlighted;
+    bool virtualized;
     
     void setupUI();
+    void setupListView();
     void updateHighlight(bool highlight);
 
 protected:
@@ -43,6 +54,7 @@ protected:
 signals:
     void taskDropped(int taskId, const string& targetState);
     void addTaskRequested(const string& state);
+    void taskActivated(int taskId);  // Clic en una fila del modo virtualizado
 
 public:
     explicit ColumnWidget(const string& stateName, QWidget *parent = nullptr);
@@ -50,7 +62,12 @@ public:
     
     string getStateName() const { return stateName; }
     QVBoxLayout* getTasksLayout() { return tasksLayout; }
+    TaskListModel* getTaskModel() { return taskModel; }
     void setTaskCount(int count);
+    
+    // Modo virtualizado: las tarjetas del layout las quita BoardWidget antes
+    void setVirtualized(bool enabled);
+    bool isVirtualized() const { return virtualized; }
 };
 
 #endif // COLUMN_WIDGET_H
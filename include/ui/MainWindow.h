@@ -10,10 +10,18 @@
 #include <QTimer>
 #include <memory>
 #include <map>
+#include <list>
+#include <chrono>
 #include "managers/ProjectManager.h"
 #include "managers/NotificationManager.h"
+#include "managers/FlowMetricsManager.h"
+#include "managers/CycleTimeManager.h"
+#include "managers/ForecastManager.h"
+#include "managers/WorkloadManager.h"
+#include "managers/UndoManager.h"
 #include "utils/DataPersistence.h"
 #include "BoardWidget.h"
+#include "PerfOverlay.h"
 
 using namespace std;
 
@@ -28,6 +36,11 @@ private:
     shared_ptr<ProjectManager> projectManager;
     shared_ptr<NotificationManager> notificationManager;
     shared_ptr<DataPersistence> dataPersistence;
+    shared_ptr<FlowMetricsManager> flowMetrics;
+    shared_ptr<CycleTimeManager> cycleTimes;
+    shared_ptr<ForecastManager> forecaster;
+    shared_ptr<WorkloadManager> workloadManager;
+    shared_ptr<UndoManager> undoManager;
     
     // UI Components
     QTabWidget* tabWidget;
@@ -36,12 +49,26 @@ private:
     QStatusBar* statusBar;
     QLabel* statusLabel;
     QLabel* notificationLabel;
+    QAction* undoAction;
+    QAction* redoAction;
     
     // Timer para autoguardado
     QTimer* autoSaveTimer;
     
-    // Widgets de tableros actuales
-    map<int, BoardWidget*> boardWidgets;
+    // Timer de un disparo armado al próximo aviso de vencimiento
+    QTimer* dueDateTimer;
+    
+    // Monitor de rendimiento
+    static const int PERF_HEARTBEAT_MS = 16;
+    QTimer* perfHeartbeat;
+    chrono::steady_clock::time_point lastHeartbeat;
+    PerfOverlay* perfOverlay;
+    
+    // Widgets de tableros: cada tab es un contenedor vacío hasta que se
+    // abre, y solo los últimos tableros vistos conservan su BoardWidget
+    static const size_t MAX_LIVE_BOARDS = 3;
+    map<int, BoardWidget*> boardWidgets;  // Solo los construidos
+    list<int> recentBoards;               // Más reciente primero
     
     // Usuario actual (simulado)
     int currentUserId;
@@ -54,6 +81,15 @@ private:
     void loadCurrentProject();
     void updateWindowTitle();
     void updateNotificationBadge();
+    void updateUndoActions();
+    void armDueDateTimer();
+    
+    // Tabs de tableros
+    int createBoardTab(shared_ptr<Board> board);
+    void clearBoardTabs();
+    BoardWidget* currentBoardWidget();
+    BoardWidget* ensureBoardWidget(int index);
+    void touchBoard(int boardId);
 
 private slots:
     void onNewProject();
@@ -62,6 +98,9 @@ private slots:
     void onCloseProject();
     void onExit();
     
+    void onUndo();
+    void onRedo();
+    
     void onNewBoard();
     void onNewTask();
     void onSearchTasks();
@@ -74,7 +113,12 @@ private slots:
     void onAbout();
     
     void onAutoSave();
+    void onDueDateTimer();
     void onTabChanged(int index);
+    
+    void onTogglePerfMonitor(bool enabled);
+    void onPerfHeartbeat();
+    void onDumpPerfMetrics();
 
 public:
     explicit MainWindow(QWidget *parent = nullptr);
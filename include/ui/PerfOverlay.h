@@ -0,0 +1,43 @@
+#ifndef PERF_OVERLAY_H
+#define PERF_OVERLAY_H
+
+#include <QWidget>
+#include <QTimer>
+#include <QPaintEvent>
+#include "utils/PerfMonitor.h"
+
+using namespace std;
+
+/**
+ * @brief Panel de depuración superpuesto con las métricas de PerfMonitor
+ *
+ * Muestra el histograma de tiempos de frame, los bloqueos del ciclo de
+ * eventos y las operaciones más lentas. Se redibuja con un timer propio
+ * solo mientras está visible y no recibe eventos de mouse.
+ */
+class PerfOverlay : public QWidget {
+    Q_OBJECT
+
+private:
+    static const int REFRESH_INTERVAL_MS = 500;
+    static const int MAX_OPERATIONS = 8;
+    
+    QTimer* refreshTimer;
+    PerfMonitor::Snapshot snapshot;
+    
+    void reposition();
+
+private slots:
+    void onRefresh();
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+
+public:
+    explicit PerfOverlay(QWidget *parent = nullptr);
+    ~PerfOverlay();
+};
+
+#endif // PERF_OVERLAY_H
@@ -2,9 +2,8 @@
 #define TASK_CARD_H
 
 #include <QWidget>
-#include <QLabel>
-#include <QVBoxLayout>
 #include <QMouseEvent>
+#include <QPaintEvent>
 #include <QDrag>
 #include <QMimeData>
 #include <QEvent>
@@ -13,35 +12,36 @@
 #endif
 #include <memory>
 #include "models/Task.h"
+#include "CardRenderer.h"
 
 using namespace std;
 
 /**
  * @brief Widget que representa una tarjeta de tarea
  * Implementa drag and drop para mover tareas
+ *
+ * No tiene widgets hijos ni hoja de estilos propia: se pinta con el
+ * CardRenderer compartido, que cachea la tarjeta dibujada, y hover o
+ * resaltado solo cambian el estado visual que se le pide.
  */
 class TaskCard : public QWidget {
     Q_OBJECT
 
 private:
     shared_ptr<Task> task;
-    
-    QVBoxLayout* layout;
-    QLabel* titleLabel;
-    QLabel* infoLabel;
-    QLabel* tagsLabel;
-    QLabel* priorityLabel;
+    const CardRenderer& renderer;
     
     QPoint dragStartPosition;
     bool isDragging;
+    bool isHovered;
+    bool isHighlighted;
     
     void setupUI();
     void updateDisplay();
-    QString getPriorityColor() const;
-    QString getDueDateText() const;
-    QString getAssignedUserText() const;
+    CardRenderer::State getVisualState() const;
 
 protected:
+    void paintEvent(QPaintEvent *event) override;
     void mousePressEvent(QMouseEvent *event) override;
     void mouseMoveEvent(QMouseEvent *event) override;
     void mouseReleaseEvent(QMouseEvent *event) override;
@@ -67,9 +67,18 @@ public:
     explicit TaskCard(shared_ptr<Task> task, QWidget *parent = nullptr);
     ~TaskCard();
     
+    QSize sizeHint() const override;
+    
     shared_ptr<Task> getTask() const;
     void updateTask(shared_ptr<Task> task);
     void setHighlighted(bool highlighted);
+    
+    // Textos de la tarjeta (los usa también TaskCardDelegate)
+    static QString getPriorityColor(const Task& task);
+    static QString getDueDateText(const Task& task);
+    static QString getAssignedUserText(const Task& task);
+    static QString getInfoText(const Task& task);
+    static QString getTagsText(const Task& task);
 };
 
 #endif // TASK_CARD_H
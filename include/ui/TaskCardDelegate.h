@@ -0,0 +1,33 @@
+#ifndef TASK_CARD_DELEGATE_H
+#define TASK_CARD_DELEGATE_H
+
+#include <QStyledItemDelegate>
+#include <QPainter>
+#include "CardRenderer.h"
+
+using namespace std;
+
+/**
+ * @brief Dibuja las filas de TaskListModel con el aspecto de TaskCard
+ *
+ * Todas las filas miden lo mismo (la vista usa uniformItemSizes), así que
+ * la vista no necesita medir cada fila para calcular el scroll. El dibujo
+ * y su caché son los de CardRenderer, compartidos con TaskCard.
+ */
+class TaskCardDelegate : public QStyledItemDelegate {
+    Q_OBJECT
+
+private:
+    const CardRenderer& renderer;
+
+public:
+    explicit TaskCardDelegate(QObject *parent = nullptr);
+    ~TaskCardDelegate();
+    
+    void paint(QPainter *painter, const QStyleOptionViewItem& option,
+               const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option,
+                   const QModelIndex& index) const override;
+};
+
+#endif // TASK_CARD_DELEGATE_H
@@ -15,6 +15,7 @@
 #include "models/Task.h"
 #include "models/Board.h"
 #include "models/Project.h"
+#include "managers/UndoManager.h"
 
 using namespace std;
 
@@ -29,6 +30,7 @@ private:
     shared_ptr<Board> board;
     shared_ptr<Project> project;
     bool isNewTask;
+    shared_ptr<UndoManager> undoManager;  // Solo se usa al editar tareas existentes
     
     // Pestaña principal
     QLineEdit* titleEdit;
@@ -91,6 +93,7 @@ public:
     ~TaskDialog();
     
     shared_ptr<Task> getTask() const;
+    void setUndoManager(shared_ptr<UndoManager> undoManager);
     bool wasAccepted() const;
 };
 
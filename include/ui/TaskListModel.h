@@ -0,0 +1,53 @@
+#ifndef TASK_LIST_MODEL_H
+#define TASK_LIST_MODEL_H
+
+#include <QAbstractListModel>
+#include <QMimeData>
+#include <QStringList>
+#include <memory>
+#include <vector>
+#include "models/Task.h"
+
+using namespace std;
+
+/**
+ * @brief Modelo de lista con las tareas de una columna virtualizada
+ *
+ * Los datos de cada fila se calculan al pedirlos, así que solo se
+ * formatean las tarjetas visibles. Arrastrar una fila produce el mismo
+ * mime "application/x-task-id" que TaskCard.
+ */
+class TaskListModel : public QAbstractListModel {
+    Q_OBJECT
+
+private:
+    vector<shared_ptr<Task>> tasks;
+
+public:
+    enum Role {
+        TaskIdRole = Qt::UserRole + 1,
+        TitleRole,
+        InfoRole,
+        TagsRole,
+        PriorityColorRole
+    };
+    
+    explicit TaskListModel(QObject *parent = nullptr);
+    ~TaskListModel();
+    
+    // QAbstractListModel
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+    QStringList mimeTypes() const override;
+    QMimeData* mimeData(const QModelIndexList& indexes) const override;
+    Qt::DropActions supportedDragActions() const override;
+    
+    // Contenido: solo se insertan/quitan las filas del tramo que cambió
+    void setTasks(const vector<shared_ptr<Task>>& newTasks);
+    void refreshTask(int taskId);
+    shared_ptr<Task> getTaskAt(int row) const;
+    int findRow(int taskId) const;
+};
+
+#endif // TASK_LIST_MODEL_H
@@ -0,0 +1,57 @@
+#ifndef COMPACT_STRING_H
+#define COMPACT_STRING_H
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief Cadena inmutable de 16 bytes con almacenamiento en línea
+ *
+ * Hasta 15 caracteres se guardan dentro del propio objeto (nombres de
+ * estados, ids, valores cortos); las cadenas más largas van al heap. El
+ * último byte indica el modo: longitud en línea o HEAP_TAG.
+ */
+class CompactString {
+private:
+    static constexpr size_t INLINE_CAPACITY = 15;
+    static constexpr unsigned char HEAP_TAG = 0xFF;
+
+    // [0..14] caracteres en línea, o puntero + longitud cuando está en heap
+    // [15]    longitud en línea o HEAP_TAG
+    char bytes[16];
+
+    bool isHeap() const;
+    const char* heapData() const;
+    uint32_t heapSize() const;
+    void assign(string_view value);
+    void release();
+
+public:
+    // Constructores
+    CompactString();
+    CompactString(string_view value);
+    CompactString(const string& value);
+    CompactString(const char* value);
+    CompactString(const CompactString& other);
+    CompactString(CompactString&& other) noexcept;
+
+    // Destructor
+    ~CompactString();
+
+    CompactString& operator=(const CompactString& other);
+    CompactString& operator=(CompactString&& other) noexcept;
+
+    // Acceso
+    string_view view() const;
+    string str() const;
+    size_t size() const;
+    bool empty() const;
+
+    bool operator==(string_view other) const;
+    bool operator!=(string_view other) const;
+};
+
+#endif // COMPACT_STRING_H
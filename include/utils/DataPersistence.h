@@ -5,6 +5,7 @@
 #include <memory>
 #include "models/Project.h"
 #include "managers/ProjectManager.h"
+#include "managers/NotificationManager.h"
 
 using namespace std;
 
@@ -22,6 +23,7 @@ private:
     string serializeBoard(shared_ptr<Board> board) const;
     string serializeProject(shared_ptr<Project> project) const;
     string serializeUser(shared_ptr<User> user) const;
+    string serializeNotification(const Notification& notification) const;
 
     // Métodos auxiliares de deserialización
     shared_ptr<Task> deserializeTask(const string &json) const;
@@ -34,6 +36,7 @@ private:
     string unescapeJson(const string &str) const;
     string getProjectFilePath(int projectId) const;
     string getProjectsIndexPath() const;
+    string getNotificationsFilePath() const;
 
 public:
     // Constructor
@@ -46,10 +49,12 @@ public:
     bool saveProject(shared_ptr<Project> project);
     bool saveAllProjects(shared_ptr<ProjectManager> manager);
     bool createBackup(int projectId);
+    bool saveNotifications(shared_ptr<NotificationManager> manager);
 
     // Cargar
     shared_ptr<Project> loadProject(int projectId);
     bool loadAllProjects(shared_ptr<ProjectManager> manager);
+    bool loadNotifications(shared_ptr<NotificationManager> manager);
 
     // Eliminar
     bool deleteProject(int projectId);
@@ -30,6 +30,8 @@ public:
                                                          int days);
     static chrono::system_clock::time_point addHours(const chrono::system_clock::time_point &tp,
                                                           int hours);
+    static chrono::system_clock::time_point startOfDay(const chrono::system_clock::time_point &tp);  // 00:00 local
+    static chrono::system_clock::time_point startOfWeek(const chrono::system_clock::time_point &tp); // Lunes 00:00 local
 
     // Comparaciones
     static bool isToday(const chrono::system_clock::time_point &tp);
@@ -0,0 +1,146 @@
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "QuantileSketch.h"
+#include "RingBuffer.h"
+
+using namespace std;
+
+/**
+ * @brief Instrumentación de latencia de la interfaz
+ *
+ * Mide la duración de operaciones con nombre (PERF_SCOPE) y el tiempo
+ * entre latidos del ciclo de eventos (recordFrame): un latido que llega
+ * tarde es un frame lento, y si supera el umbral queda registrado como
+ * bloqueo. Por operación guarda conteo, total, máximo y un sketch de
+ * cuantiles; además conserva las últimas muestras para volcarlas a un
+ * archivo y analizarlas fuera de la aplicación.
+ *
+ * Desactivado, PERF_SCOPE solo lee un atómico: no toma la hora ni el lock.
+ * Los nombres deben ser literales, porque las muestras guardan el puntero.
+ */
+class PerfMonitor {
+public:
+    static const size_t FRAME_BUCKET_COUNT = 8;
+    
+    struct OperationStats {
+        string name;
+        uint64_t count;
+        double totalMs;
+        double p50Ms;
+        double p95Ms;
+        double maxMs;
+    };
+    
+    struct Stall {
+        chrono::system_clock::time_point when;
+        double durationMs;
+    };
+    
+    struct Snapshot {
+        array<uint64_t, FRAME_BUCKET_COUNT> frameHistogram;
+        uint64_t frameCount;
+        double frameP50Ms;
+        double frameP95Ms;
+        double frameMaxMs;
+        vector<OperationStats> operations;  // La de mayor máximo primero
+        vector<Stall> stalls;               // La más reciente al final
+    };
+    
+    // Mide desde su construcción hasta su destrucción
+    class Scope {
+    private:
+        const char* name;
+        chrono::steady_clock::time_point start;
+        bool active;
+    
+    public:
+        explicit Scope(const char* name)
+            : name(name), active(PerfMonitor::isEnabled()) {
+            if (active) {
+                start = chrono::steady_clock::now();
+            }
+        }
+        
+        ~Scope() {
+            if (active) {
+                PerfMonitor::instance().record(name, chrono::steady_clock::now() - start);
+            }
+        }
+        
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    struct Operation {
+        uint64_t count = 0;
+        double totalMs = 0.0;
+        QuantileSketch sketch;
+    };
+    
+    struct Sample {
+        const char* name;
+        chrono::steady_clock::time_point start;
+        double durationMs;
+    };
+    
+    static const size_t MAX_SAMPLES = 4096;
+    static const size_t MAX_STALLS = 64;
+    
+    static atomic<bool> enabled;
+    
+    mutable mutex dataMutex;
+    map<string, Operation, less<>> operations;
+    RingBuffer<Sample> samples;
+    RingBuffer<Stall> stalls;
+    array<uint64_t, FRAME_BUCKET_COUNT> frameHistogram;
+    QuantileSketch frameSketch;
+    double stallThresholdMs;
+    chrono::steady_clock::time_point origin;  // Referencia de las muestras volcadas
+    
+    PerfMonitor();
+
+public:
+    static PerfMonitor& instance();
+    
+    PerfMonitor(const PerfMonitor&) = delete;
+    PerfMonitor& operator=(const PerfMonitor&) = delete;
+    
+    // Activación
+    static bool isEnabled() { return enabled.load(memory_order_relaxed); }
+    void setEnabled(bool enable);
+    
+    // Registro
+    void record(const char* name, chrono::steady_clock::duration duration);
+    void recordFrame(chrono::steady_clock::duration interval);
+    
+    // Configuración
+    void setStallThreshold(chrono::milliseconds threshold);
+    chrono::milliseconds getStallThreshold() const;
+    
+    // Consultas
+    Snapshot getSnapshot(size_t maxOperations = 10) const;
+    static double getFrameBucketLimit(size_t bucket);  // Límite superior en ms (el último es infinito)
+    
+    // Métodos de utilidad
+    bool dump(const string& filePath) const;
+    void reset();
+};
+
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+
+// Mide el resto del bloque actual bajo el nombre dado (un literal)
+#define PERF_SCOPE(name) PerfMonitor::Scope PERF_CONCAT(perfScope, __LINE__)(name)
+
+#endif // PERF_MONITOR_H
@@ -0,0 +1,95 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+using namespace std;
+
+/**
+ * @brief Pool de bloques pequeños por clases de tamaño
+ *
+ * Reserva bloques de 64 KB y los reparte en trozos de múltiplos de 16
+ * bytes; liberar devuelve el trozo a la lista libre de su clase, sin
+ * pasar por el heap. Los bloques solo se devuelven, todos juntos, al
+ * destruir el pool. Los pedidos de más de 512 bytes van directo al heap.
+ */
+class SlabPoolResource : public pmr::memory_resource {
+private:
+    static constexpr size_t GRANULE = 16;
+    static constexpr size_t MAX_BLOCK = 512;
+    static constexpr size_t CLASS_COUNT = MAX_BLOCK / GRANULE;
+    
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    
+    mutex poolMutex;
+    FreeBlock* freeLists[CLASS_COUNT];
+    char* cursor;        // Parte sin usar del bloque actual
+    char* limit;
+    vector<void*> slabs;
+    size_t slabSize;
+    
+    static size_t classOf(size_t bytes) { return bytes == 0 ? 0 : (bytes - 1) / GRANULE; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override;
+
+public:
+    // Constructor
+    explicit SlabPoolResource(size_t slabSize = 64 * 1024);
+    
+    // Destructor
+    ~SlabPoolResource() override;
+    
+    SlabPoolResource(const SlabPoolResource&) = delete;
+    SlabPoolResource& operator=(const SlabPoolResource&) = delete;
+    
+    // Estadísticas
+    size_t getSlabCount();
+};
+
+/**
+ * @brief Asignador que toma memoria de un pool compartido (std::pmr)
+ *
+ * A diferencia de pmr::polymorphic_allocator, guarda un shared_ptr al
+ * recurso: un objeto creado con allocate_shared mantiene vivo su pool
+ * aunque el dueño del pool (el tablero) ya no exista.
+ */
+template <typename T>
+class PoolAllocator {
+private:
+    template <typename U> friend class PoolAllocator;
+    shared_ptr<pmr::memory_resource> resource;
+
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(shared_ptr<pmr::memory_resource> resource)
+        : resource(move(resource)) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) : resource(other.resource) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(resource->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t n) {
+        resource->deallocate(pointer, n * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const { return resource == other.resource; }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const { return resource != other.resource; }
+};
+
+#endif // POOL_ALLOCATOR_H
@@ -0,0 +1,52 @@
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <map>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief Sketch de cuantiles con error relativo acotado (estilo DDSketch)
+ *
+ * Los valores se agrupan en intervalos logarítmicos de razón gamma, por lo
+ * que cualquier cuantil se responde con error relativo <= relativeAccuracy
+ * sin guardar los valores originales. Insertar es O(log b) y consultar
+ * O(b), donde b es el número de intervalos usados (unos cientos para
+ * duraciones entre segundos y años).
+ */
+class QuantileSketch {
+private:
+    double relativeAccuracy;
+    double gamma;
+    double logGamma;
+
+    map<int, uint64_t> buckets;
+    uint64_t zeroCount;  // Valores demasiado pequeños para un intervalo logarítmico
+    uint64_t count;
+    double minValue;
+    double maxValue;
+
+    int indexOf(double value) const;
+    double valueOf(int index) const;
+
+public:
+    // Constructor
+    QuantileSketch(double relativeAccuracy = 0.01);
+
+    // Agregar valores
+    void add(double value);
+    void merge(const QuantileSketch& other);
+
+    // Consultas
+    double getQuantile(double quantile) const;  // quantile en [0, 1]
+    uint64_t getCount() const;
+    double getMin() const;
+    double getMax() const;
+    bool isEmpty() const;
+
+    // Métodos de utilidad
+    void clear();
+};
+
+#endif // QUANTILE_SKETCH_H
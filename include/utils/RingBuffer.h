@@ -0,0 +1,123 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+
+using namespace std;
+
+/**
+ * @brief Buffer circular de capacidad fija
+ *
+ * Agregar es O(1) también cuando está lleno: se sobrescribe el elemento
+ * más antiguo en lugar de desplazar todo el contenido. La memoria crece
+ * según se usa hasta alcanzar la capacidad. Se recorre del más antiguo al
+ * más reciente con iteradores de acceso aleatorio.
+ */
+template <typename T>
+class RingBuffer {
+private:
+    vector<T> storage;
+    size_t head;      // Posición física del elemento más antiguo
+    size_t count;
+    size_t capacity;
+
+    size_t physicalIndex(size_t logicalIndex) const {
+        size_t index = head + logicalIndex;
+        return index < storage.size() ? index : index - storage.size();
+    }
+
+public:
+    class const_iterator {
+    private:
+        const RingBuffer* buffer;
+        size_t position;  // Índice lógico (0 = más antiguo)
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : buffer(nullptr), position(0) {}
+        const_iterator(const RingBuffer* buffer, size_t position)
+            : buffer(buffer), position(position) {}
+
+        reference operator*() const { return (*buffer)[position]; }
+        pointer operator->() const { return &(*buffer)[position]; }
+        reference operator[](difference_type n) const { return (*buffer)[position + n]; }
+
+        const_iterator& operator++() { ++position; return *this; }
+        const_iterator operator++(int) { const_iterator copy = *this; ++position; return copy; }
+        const_iterator& operator--() { --position; return *this; }
+        const_iterator operator--(int) { const_iterator copy = *this; --position; return copy; }
+        const_iterator& operator+=(difference_type n) { position += n; return *this; }
+        const_iterator& operator-=(difference_type n) { position -= n; return *this; }
+
+        const_iterator operator+(difference_type n) const { return const_iterator(buffer, position + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(buffer, position - n); }
+        friend const_iterator operator+(difference_type n, const const_iterator& it) { return it + n; }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(position) - static_cast<difference_type>(other.position);
+        }
+
+        bool operator==(const const_iterator& other) const { return position == other.position; }
+        bool operator!=(const const_iterator& other) const { return position != other.position; }
+        bool operator<(const const_iterator& other) const { return position < other.position; }
+        bool operator>(const const_iterator& other) const { return position > other.position; }
+        bool operator<=(const const_iterator& other) const { return position <= other.position; }
+        bool operator>=(const const_iterator& other) const { return position >= other.position; }
+    };
+
+    explicit RingBuffer(size_t capacity = 0)
+        : head(0), count(0), capacity(capacity) {}
+
+    // Agrega al final; si está lleno sobrescribe el más antiguo
+    void push(const T& value) {
+        if (capacity == 0) return;
+
+        if (storage.size() < capacity) {
+            storage.push_back(value);
+            ++count;
+        } else {
+            storage[head] = value;
+            head = (head + 1 == capacity) ? 0 : head + 1;
+        }
+    }
+
+    void push(T&& value) {
+        if (capacity == 0) return;
+
+        if (storage.size() < capacity) {
+            storage.push_back(std::move(value));
+            ++count;
+        } else {
+            storage[head] = std::move(value);
+            head = (head + 1 == capacity) ? 0 : head + 1;
+        }
+    }
+
+    // Acceso
+    const T& operator[](size_t logicalIndex) const { return storage[physicalIndex(logicalIndex)]; }
+    const T& front() const { return storage[head]; }
+    const T& back() const { return (*this)[count - 1]; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+
+    // Estado
+    size_t size() const { return count; }
+    size_t getCapacity() const { return capacity; }
+    bool empty() const { return count == 0; }
+    bool full() const { return count == capacity; }
+
+    void clear() {
+        storage.clear();
+        head = 0;
+        count = 0;
+    }
+};
+
+#endif // RING_BUFFER_H
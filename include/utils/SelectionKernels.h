@@ -0,0 +1,64 @@
+#ifndef SELECTION_KERNELS_H
+#define SELECTION_KERNELS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+using namespace std;
+
+/**
+ * @brief Filtros sobre columnas de tareas que producen un mapa de bits
+ *
+ * Evalúan "vencimiento en [dueFrom, dueTo] Y prioridad >= minPriority
+ * Y estado != excludedState Y asignado en assignees" sobre arreglos
+ * contiguos. Hay versiones SSE4.2 y AVX2 (x86 con GCC/Clang) y una escalar;
+ * la implementación se elige una vez al arrancar según la CPU. El bit i
+ * del mapa (palabra i / 64, bit i % 64) corresponde a la fila i.
+ */
+class SelectionKernels {
+public:
+    enum class Isa {
+        SCALAR,
+        SSE42,
+        AVX2
+    };
+    
+    // Columnas a filtrar; todas con "count" elementos
+    struct Columns {
+        const uint32_t* stateIds = nullptr;
+        const int32_t* priorities = nullptr;
+        const int32_t* assigneeIds = nullptr;
+        const int64_t* dueTicks = nullptr;
+        size_t count = 0;
+    };
+    
+    // Los valores por omisión no filtran nada: los límites son inclusivos,
+    // así que también pasan las filas con vencimiento INT64_MIN o INT64_MAX
+    struct Predicate {
+        int64_t dueFrom = numeric_limits<int64_t>::min();  // Inclusivo
+        int64_t dueTo = numeric_limits<int64_t>::max();    // Inclusivo
+        int32_t minPriority = numeric_limits<int32_t>::min();
+        bool excludeState = false;
+        uint32_t excludedStateId = 0;
+        vector<int32_t> assignees;  // Vacío: cualquier asignado
+    };
+    
+    // Selección
+    static void select(const Columns& columns, const Predicate& predicate,
+                       vector<uint64_t>& bitmap);
+    static void select(const Columns& columns, const Predicate& predicate,
+                       vector<uint64_t>& bitmap, Isa isa);  // Fuerza una implementación
+    
+    // Mapas de bits
+    static vector<uint32_t> toRows(const vector<uint64_t>& bitmap);
+    static size_t countBits(const vector<uint64_t>& bitmap);
+    
+    // CPU
+    static Isa detectIsa();       // La mejor disponible (calculada una vez)
+    static bool isSupported(Isa isa);
+    static const char* isaName(Isa isa);
+};
+
+#endif // SELECTION_KERNELS_H
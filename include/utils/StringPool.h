@@ -0,0 +1,47 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief Tabla global de cadenas internadas (Patrón Singleton)
+ *
+ * Cada cadena distinta se guarda una sola vez y se identifica con un
+ * entero de 32 bits. Pensada para valores que se repiten mucho (nombres
+ * de usuario, nombres de campos). El id 0 es siempre la cadena vacía.
+ * Las referencias devueltas por lookup son estables.
+ */
+class StringPool {
+private:
+    deque<string> strings;                 // deque: las referencias no se invalidan
+    unordered_map<string, uint32_t> ids;
+    mutable shared_mutex mutex;
+
+    StringPool();
+
+public:
+    static constexpr uint32_t EMPTY_ID = 0;
+
+    // Singleton
+    static StringPool& getInstance();
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    // Devuelve el id de la cadena, agregándola si no existe
+    uint32_t intern(const string& value);
+
+    // Busca sin agregar; devuelve false si la cadena nunca se internó
+    bool find(const string& value, uint32_t& id) const;
+
+    const string& lookup(uint32_t id) const;
+    size_t size() const;
+};
+
+#endif // STRING_POOL_H
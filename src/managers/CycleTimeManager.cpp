@@ -0,0 +1,183 @@
+#include "managers/CycleTimeManager.h"
+
+using namespace std;
+
+namespace {
+
+double toHours(chrono::system_clock::duration duration) {
+    return chrono::duration<double, ratio<3600>>(duration).count();
+}
+
+} // namespace
+
+// PercentileSummary
+PercentileSummary::PercentileSummary()
+    : p50Hours(0.0), p85Hours(0.0), p95Hours(0.0), count(0) {}
+
+// CycleTimeManager
+
+// Constructor
+CycleTimeManager::CycleTimeManager(const string& doneState)
+    : doneState(doneState) {}
+
+// Destructor
+CycleTimeManager::~CycleTimeManager() {}
+
+void CycleTimeManager::applyTransition(BoardStats& stats, const Task& task,
+                                       const string& fromState, const string& toState,
+                                       const chrono::system_clock::time_point& when) {
+    // Tiempo en la columna de origen
+    auto it = stats.progressByTask.find(task.getId());
+    auto enteredAt = (it != stats.progressByTask.end()) ? it->second.enteredAt
+                                                       : task.getCreatedDate();
+    stats.cycleTimeByState[fromState].add(toHours(when - enteredAt));
+
+    // Lead time al llegar al estado terminado
+    if (toState == doneState) {
+        double leadHours = toHours(when - task.getCreatedDate());
+        stats.leadTime.add(leadHours);
+
+        if (task.getAssignedUserId() >= 0) {
+            stats.leadTimeByAssignee[task.getAssignedUserId()].add(leadHours);
+        }
+    }
+
+    stats.progressByTask[task.getId()] = {toState, when};
+}
+
+PercentileSummary CycleTimeManager::summarize(const QuantileSketch& sketch) {
+    PercentileSummary summary;
+    summary.count = sketch.getCount();
+    if (!sketch.isEmpty()) {
+        summary.p50Hours = sketch.getQuantile(0.50);
+        summary.p85Hours = sketch.getQuantile(0.85);
+        summary.p95Hours = sketch.getQuantile(0.95);
+    }
+    return summary;
+}
+
+// Reconstrucción desde el registro de actividad
+void CycleTimeManager::rebuild(shared_ptr<Board> board) {
+    if (!board) return;
+
+    rebuild(*board);
+}
+
+void CycleTimeManager::rebuild(const Board& board) {
+    BoardStats stats;
+
+    for (const auto& task : board.getAllTasks()) {
+        for (const auto& transition : task->getStateTransitions()) {
+            applyTransition(stats, *task, transition.fromState,
+                            transition.toState, transition.timestamp);
+        }
+    }
+
+    boards[board.getId()] = move(stats);
+}
+
+// Actualización incremental
+void CycleTimeManager::attach(shared_ptr<EventBus> bus) {
+    subscriptions = EventSubscriptions(bus);
+    
+    subscriptions.subscribe<TaskMoved>([this](const TaskMoved& event) {
+        recordTransition(event.boardId, *event.task, string(event.fromState),
+                         string(event.toState), event.when);
+    });
+    subscriptions.subscribe<TaskCreated>([this](const TaskCreated& event) {
+        recordTaskAdded(event.boardId, *event.task);
+    });
+    subscriptions.subscribe<TaskRemoved>([this](const TaskRemoved& event) {
+        recordTaskRemoved(event.boardId, event.task->getId());
+    });
+    subscriptions.subscribe<BoardAdded>([this](const BoardAdded& event) {
+        rebuild(*event.board);
+    });
+    subscriptions.subscribe<BoardCleared>([this](const BoardCleared& event) {
+        // Sin tareas no queda historial: el tablero sigue, con estadísticas vacías
+        if (isTracking(event.boardId)) {
+            boards[event.boardId] = BoardStats();
+        }
+    });
+    subscriptions.subscribe<BoardRemoved>([this](const BoardRemoved& event) {
+        forgetBoard(event.boardId);
+    });
+}
+
+void CycleTimeManager::detach() {
+    subscriptions.reset();
+}
+
+void CycleTimeManager::recordTransition(int boardId, const Task& task,
+                                        const string& fromState, const string& toState,
+                                        const chrono::system_clock::time_point& when) {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) return;
+
+    applyTransition(it->second, task, fromState, toState, when);
+}
+
+void CycleTimeManager::recordTaskAdded(int boardId, const Task& task) {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) return;
+
+    // La tarea está en su estado desde el último movimiento (o desde que se
+    // creó); una tarea restaurada no vuelve a sumar sus tiempos ya medidos
+    vector<StateTransition> transitions = task.getStateTransitions();
+    auto enteredAt = transitions.empty() ? task.getCreatedDate()
+                                         : transitions.back().timestamp;
+    it->second.progressByTask[task.getId()] = {task.getState(), enteredAt};
+}
+
+void CycleTimeManager::recordTaskRemoved(int boardId, int taskId) {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) return;
+
+    it->second.progressByTask.erase(taskId);
+}
+
+// Consultas
+PercentileSummary CycleTimeManager::getLeadTime(int boardId) const {
+    auto it = boards.find(boardId);
+    return (it != boards.end()) ? summarize(it->second.leadTime) : PercentileSummary();
+}
+
+PercentileSummary CycleTimeManager::getCycleTime(int boardId, const string& state) const {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) {
+        return PercentileSummary();
+    }
+
+    auto stateIt = it->second.cycleTimeByState.find(state);
+    return (stateIt != it->second.cycleTimeByState.end()) ? summarize(stateIt->second)
+                                                          : PercentileSummary();
+}
+
+PercentileSummary CycleTimeManager::getLeadTimeByAssignee(int boardId, int userId) const {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) {
+        return PercentileSummary();
+    }
+
+    auto userIt = it->second.leadTimeByAssignee.find(userId);
+    return (userIt != it->second.leadTimeByAssignee.end()) ? summarize(userIt->second)
+                                                           : PercentileSummary();
+}
+
+double CycleTimeManager::getLeadTimePercentile(int boardId, double quantile) const {
+    auto it = boards.find(boardId);
+    return (it != boards.end()) ? it->second.leadTime.getQuantile(quantile) : 0.0;
+}
+
+bool CycleTimeManager::isTracking(int boardId) const {
+    return boards.find(boardId) != boards.end();
+}
+
+// Métodos de utilidad
+void CycleTimeManager::forgetBoard(int boardId) {
+    boards.erase(boardId);
+}
+
+void CycleTimeManager::clear() {
+    boards.clear();
+}
@@ -0,0 +1,251 @@
+#include "managers/DueDateScheduler.h"
+#include "utils/StringPool.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace {
+
+// Con más entradas obsoletas que esto por tarea programada se reconstruye el heap
+const size_t STALE_FACTOR = 4;
+const size_t MIN_COMPACT_SIZE = 64;
+
+chrono::system_clock::time_point fromTicks(int64_t ticks) {
+    return chrono::system_clock::time_point(chrono::system_clock::duration(ticks));
+}
+
+} // namespace
+
+// Constructor
+DueDateScheduler::DueDateScheduler(chrono::system_clock::duration dueSoonLead,
+                                   const string& doneState)
+    : dueSoonLead(dueSoonLead), doneState(doneState),
+      doneStateId(TaskHotTable::stateIdOf(doneState)), nextGeneration(1) {}
+
+// Destructor
+DueDateScheduler::~DueDateScheduler() {
+    clear();
+}
+
+// Tableros vigilados
+void DueDateScheduler::watchBoard(shared_ptr<Board> board) {
+    if (!board) return;
+    
+    int boardId = board->getId();
+    boards[boardId] = board;
+    subscribeTo(board->getEventBus());
+    
+    // Programar las tareas que ya tiene (sin cambios si ya estaban programadas)
+    const TaskHotTable& table = board->getHotTable();
+    const auto& taskIds = table.getTaskIds();
+    const auto& stateIds = table.getStateIds();
+    const auto& dueTicks = table.getDueTicks();
+    for (size_t row = 0; row < table.size(); ++row) {
+        updateTask(boardId, taskIds[row], stateIds[row] == doneStateId, dueTicks[row]);
+    }
+}
+
+void DueDateScheduler::subscribeTo(shared_ptr<EventBus> bus) {
+    if (!bus) return;
+    for (const auto& existing : subscriptions) {
+        if (existing.isAttachedTo(bus)) return;
+    }
+    
+    // Los eventos de tableros no vigilados se ignoran
+    EventSubscriptions group(bus);
+    group.subscribe<TaskCreated>([this](const TaskCreated& event) {
+        if (boards.count(event.boardId)) {
+            updateTask(event.boardId, event.task->getId(), event.state == doneState,
+                       TaskHotTable::toTicks(event.task->getDueDate()));
+        }
+    });
+    group.subscribe<TaskMoved>([this](const TaskMoved& event) {
+        if (boards.count(event.boardId)) {
+            updateTask(event.boardId, event.task->getId(), event.toState == doneState,
+                       TaskHotTable::toTicks(event.task->getDueDate()));
+        }
+    });
+    group.subscribe<FieldChanged>([this](const FieldChanged& event) {
+        bool relevant = event.field == TaskField::DUE_DATE || event.field == TaskField::RESTORED;
+        if (relevant && boards.count(event.boardId)) {
+            updateTask(event.boardId, event.task->getId(), event.task->getState() == doneState,
+                       TaskHotTable::toTicks(event.task->getDueDate()));
+        }
+    });
+    group.subscribe<TaskRemoved>([this](const TaskRemoved& event) {
+        forgetTask(event.boardId, event.task->getId());
+    });
+    group.subscribe<BoardCleared>([this](const BoardCleared& event) {
+        forgetBoardTasks(event.boardId);
+    });
+    group.subscribe<BoardRemoved>([this](const BoardRemoved& event) {
+        unwatchBoard(event.boardId);
+    });
+    subscriptions.push_back(move(group));
+}
+
+void DueDateScheduler::unwatchBoard(int boardId) {
+    if (boards.erase(boardId) > 0) {
+        forgetBoardTasks(boardId);
+    }
+}
+
+void DueDateScheduler::clear() {
+    subscriptions.clear();
+    boards.clear();
+    schedules.clear();
+    heap.clear();
+}
+
+// Cambios en las tareas
+void DueDateScheduler::updateTask(int boardId, int taskId, bool done, int64_t dueTicks) {
+    auto inserted = schedules.emplace(make_pair(boardId, taskId), TaskSchedule());
+    TaskSchedule& entry = inserted.first->second;
+    
+    // Sin cambios de fecha ni de estado terminado no hay nada que reprogramar
+    if (!inserted.second && entry.dueTicks == dueTicks && entry.done == done) {
+        return;
+    }
+    
+    // Una fecha nueva vuelve a habilitar ambos avisos; volver a abrir una
+    // tarea con la misma fecha no los repite
+    if (entry.dueTicks != dueTicks) {
+        entry.dueSoonFired = false;
+        entry.overdueFired = false;
+    }
+    entry.dueTicks = dueTicks;
+    entry.done = done;
+    
+    schedule(boardId, taskId, entry);
+}
+
+// Los avisos que queden en el heap se descartan al salir
+void DueDateScheduler::forgetTask(int boardId, int taskId) {
+    schedules.erase(make_pair(boardId, taskId));
+}
+
+void DueDateScheduler::forgetBoardTasks(int boardId) {
+    schedules.erase(schedules.lower_bound(make_pair(boardId, numeric_limits<int>::min())),
+                    schedules.upper_bound(make_pair(boardId, numeric_limits<int>::max())));
+}
+
+void DueDateScheduler::schedule(int boardId, int taskId, TaskSchedule& entry) {
+    // Invalida los avisos anteriores de la tarea
+    entry.generation = nextGeneration++;
+    
+    if (entry.done || entry.dueTicks <= 0 ||
+        entry.dueTicks == numeric_limits<int64_t>::max()) {
+        return;
+    }
+    
+    discardStale();
+    bool hadPending = !heap.empty();
+    int64_t previousTop = hadPending ? heap.front().fireTicks : 0;
+    
+    if (!entry.dueSoonFired) {
+        pushEntry({entry.dueTicks - dueSoonLead.count(), entry.generation,
+                   boardId, taskId, Alert::DUE_SOON});
+    }
+    if (!entry.overdueFired) {
+        // Vencida cuando la fecha límite ya quedó atrás (Task::isOverdue)
+        pushEntry({entry.dueTicks + 1, entry.generation, boardId, taskId, Alert::OVERDUE});
+    }
+    
+    compactIfNeeded();
+    
+    if (deadlineCallback && !heap.empty() &&
+        (!hadPending || heap.front().fireTicks < previousTop)) {
+        deadlineCallback(fromTicks(heap.front().fireTicks));
+    }
+}
+
+// Heap
+void DueDateScheduler::pushEntry(const HeapEntry& entry) {
+    heap.push_back(entry);
+    push_heap(heap.begin(), heap.end(), greater<HeapEntry>());
+}
+
+void DueDateScheduler::popEntry() {
+    pop_heap(heap.begin(), heap.end(), greater<HeapEntry>());
+    heap.pop_back();
+}
+
+bool DueDateScheduler::isStale(const HeapEntry& entry) const {
+    auto it = schedules.find(make_pair(entry.boardId, entry.taskId));
+    return it == schedules.end() || it->second.generation != entry.generation;
+}
+
+void DueDateScheduler::discardStale() {
+    while (!heap.empty() && isStale(heap.front())) {
+        popEntry();
+    }
+}
+
+void DueDateScheduler::compactIfNeeded() {
+    if (heap.size() < MIN_COMPACT_SIZE || heap.size() < STALE_FACTOR * schedules.size()) {
+        return;
+    }
+    
+    heap.erase(remove_if(heap.begin(), heap.end(),
+                         [this](const HeapEntry& entry) { return isStale(entry); }),
+               heap.end());
+    make_heap(heap.begin(), heap.end(), greater<HeapEntry>());
+}
+
+// Avisos
+vector<DueDateScheduler::DueAlert> DueDateScheduler::collectDue(
+    const chrono::system_clock::time_point& now) {
+    vector<DueAlert> alerts;
+    int64_t nowTicks = TaskHotTable::toTicks(now);
+    
+    discardStale();
+    while (!heap.empty() && heap.front().fireTicks <= nowTicks) {
+        HeapEntry top = heap.front();
+        popEntry();
+        
+        auto it = schedules.find(make_pair(top.boardId, top.taskId));
+        if (it != schedules.end() && it->second.generation == top.generation) {
+            TaskSchedule& entry = it->second;
+            bool report = true;
+            
+            if (top.alert == Alert::DUE_SOON) {
+                entry.dueSoonFired = true;
+                report = nowTicks <= entry.dueTicks;  // Ya vencida: solo el otro aviso
+            } else {
+                entry.overdueFired = true;
+            }
+            
+            auto boardIt = boards.find(top.boardId);
+            auto board = boardIt != boards.end() ? boardIt->second.lock() : nullptr;
+            auto task = (report && board) ? board->findTaskById(top.taskId) : nullptr;
+            if (task) {
+                alerts.push_back({top.alert, top.boardId, task});
+            }
+        }
+        
+        discardStale();
+    }
+    
+    return alerts;
+}
+
+bool DueDateScheduler::hasPending() {
+    discardStale();
+    return !heap.empty();
+}
+
+chrono::system_clock::time_point DueDateScheduler::getNextDeadline() {
+    discardStale();
+    return heap.empty() ? chrono::system_clock::time_point::max()
+                        : fromTicks(heap.front().fireTicks);
+}
+
+size_t DueDateScheduler::getScheduledTaskCount() const {
+    return schedules.size();
+}
+
+void DueDateScheduler::setDeadlineCallback(
+    function<void(const chrono::system_clock::time_point&)> callback) {
+    deadlineCallback = callback;
+}
@@ -0,0 +1,367 @@
+#include "managers/FlowMetricsManager.h"
+#include "utils/DateUtils.h"
+#include <algorithm>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+// Tareas mínimas por hilo para que valga la pena lanzar uno
+const size_t MIN_TASKS_PER_THREAD = 256;
+
+// División entera hacia -infinito: índice del intervalo que contiene tp
+long long bucketOf(const chrono::system_clock::time_point& tp,
+                   const chrono::system_clock::time_point& origin,
+                   chrono::system_clock::duration length) {
+    auto diff = tp - origin;
+    long long index = diff / length;
+    if (diff.count() < 0 && diff % length != chrono::system_clock::duration::zero()) {
+        --index;
+    }
+    return index;
+}
+
+// Recorre la historia de una tarea: cada estado que ocupó desde su creación,
+// con su fin (nullptr si sigue en él), y cada llegada al estado terminado.
+// La reconstrucción y las altas/bajas incrementales comparten este recorrido
+// para que ambos caminos produzcan las mismas series.
+template <typename SpanFn, typename DoneFn>
+void forEachStateSpan(const Task& task, const string& doneState,
+                      SpanFn onSpan, DoneFn onDone) {
+    vector<StateTransition> transitions = task.getStateTransitions();
+
+    string current = transitions.empty() ? task.getState() : transitions.front().fromState;
+    auto since = task.getCreatedDate();
+
+    for (const auto& transition : transitions) {
+        onSpan(current, since, &transition.timestamp);
+        if (transition.toState == doneState) {
+            onDone(transition.timestamp);
+        }
+        current = transition.toState;
+        since = transition.timestamp;
+    }
+
+    onSpan(current, since, nullptr);
+}
+
+// Acumulado parcial de un hilo durante la reconstrucción
+struct PartialFlow {
+    vector<vector<int>> deltas;
+    vector<int> completions;
+};
+
+} // namespace
+
+// Constructor
+FlowMetricsManager::FlowMetricsManager(Granularity granularity, const string& doneState)
+    : granularity(granularity), doneState(doneState) {}
+
+// Destructor
+FlowMetricsManager::~FlowMetricsManager() {}
+
+// Intervalos
+chrono::system_clock::duration FlowMetricsManager::getBucketLength() const {
+    return granularity == Granularity::WEEK ? chrono::hours(24 * 7) : chrono::hours(24);
+}
+
+chrono::system_clock::time_point FlowMetricsManager::alignToBucket(
+    const chrono::system_clock::time_point& tp) const {
+    return granularity == Granularity::WEEK ? DateUtils::startOfWeek(tp)
+                                            : DateUtils::startOfDay(tp);
+}
+
+size_t FlowMetricsManager::ensureBucket(BoardFlow& flow,
+                                        const chrono::system_clock::time_point& tp) {
+    auto length = getBucketLength();
+
+    if (flow.completions.empty()) {
+        flow.origin = alignToBucket(tp);
+    }
+
+    // Evento anterior al origen: agregar intervalos al principio
+    long long index = bucketOf(tp, flow.origin, length);
+    if (index < 0) {
+        size_t missing = static_cast<size_t>(-index);
+        for (auto& row : flow.deltas) {
+            row.insert(row.begin(), missing, 0);
+        }
+        flow.completions.insert(flow.completions.begin(), missing, 0);
+        flow.origin -= length * static_cast<long long>(missing);
+        flow.dirtyFrom = 0;
+        index = 0;
+    }
+
+    size_t bucket = static_cast<size_t>(index);
+    if (bucket >= flow.completions.size()) {
+        flow.dirtyFrom = min(flow.dirtyFrom, flow.completions.size());
+        for (auto& row : flow.deltas) {
+            row.resize(bucket + 1, 0);
+        }
+        flow.completions.resize(bucket + 1, 0);
+    }
+
+    return bucket;
+}
+
+void FlowMetricsManager::recomputeSeries(BoardFlow& flow) {
+    // Extender las series hasta el intervalo actual
+    ensureBucket(flow, chrono::system_clock::now());
+
+    size_t bucketCount = flow.completions.size();
+    if (flow.dirtyFrom >= bucketCount) {
+        return;
+    }
+
+    FlowSeries& series = flow.series;
+    size_t stateCount = flow.states.size();
+    auto length = getBucketLength();
+
+    series.states = flow.states;
+    series.bucketStarts.resize(bucketCount);
+    series.cumulativeByState.resize(stateCount);
+    series.remaining.resize(bucketCount);
+    series.throughput.resize(bucketCount);
+
+    for (size_t s = 0; s < stateCount; ++s) {
+        auto& cumulative = series.cumulativeByState[s];
+        const auto& deltas = flow.deltas[s];
+        cumulative.resize(bucketCount);
+
+        int running = flow.dirtyFrom > 0 ? cumulative[flow.dirtyFrom - 1] : 0;
+        for (size_t b = flow.dirtyFrom; b < bucketCount; ++b) {
+            running += deltas[b];
+            cumulative[b] = running;
+        }
+    }
+
+    for (size_t b = flow.dirtyFrom; b < bucketCount; ++b) {
+        series.bucketStarts[b] = flow.origin + length * static_cast<long long>(b);
+        series.throughput[b] = flow.completions[b];
+
+        int remaining = 0;
+        for (size_t s = 0; s < stateCount; ++s) {
+            if (flow.states[s] != doneState) {
+                remaining += series.cumulativeByState[s][b];
+            }
+        }
+        series.remaining[b] = remaining;
+    }
+
+    flow.dirtyFrom = bucketCount;
+}
+
+// Reconstrucción histórica
+void FlowMetricsManager::rebuild(shared_ptr<Board> board, unsigned int threadCount) {
+    if (!board) return;
+
+    auto tasks = board->getAllTasks();
+    auto now = chrono::system_clock::now();
+    auto length = getBucketLength();
+
+    BoardFlow flow;
+    flow.states = board->getStates();
+    for (size_t i = 0; i < flow.states.size(); ++i) {
+        flow.stateIndex[flow.states[i]] = i;
+    }
+
+    // El origen es el inicio del intervalo de la tarea más antigua
+    auto earliest = now;
+    for (const auto& task : tasks) {
+        earliest = min(earliest, task->getCreatedDate());
+    }
+    flow.origin = alignToBucket(earliest);
+
+    size_t bucketCount = static_cast<size_t>(bucketOf(now, flow.origin, length)) + 1;
+    size_t stateCount = flow.states.size();
+
+    auto clampBucket = [&](const chrono::system_clock::time_point& tp) -> size_t {
+        long long index = bucketOf(tp, flow.origin, length);
+        if (index < 0) return 0;
+        return min(static_cast<size_t>(index), bucketCount - 1);
+    };
+
+    // Procesa un rango de tareas sobre un acumulado local (sin memoria compartida)
+    auto accumulate = [&](size_t begin, size_t end, PartialFlow& partial) {
+        partial.deltas.assign(stateCount, vector<int>(bucketCount, 0));
+        partial.completions.assign(bucketCount, 0);
+
+        for (size_t i = begin; i < end; ++i) {
+            forEachStateSpan(*tasks[i], doneState,
+                [&](const string& state, const chrono::system_clock::time_point& since,
+                    const chrono::system_clock::time_point* until) {
+                    auto it = flow.stateIndex.find(state);
+                    if (it == flow.stateIndex.end()) return;
+                    partial.deltas[it->second][clampBucket(since)] += 1;
+                    if (until) {
+                        partial.deltas[it->second][clampBucket(*until)] -= 1;
+                    }
+                },
+                [&](const chrono::system_clock::time_point& when) {
+                    partial.completions[clampBucket(when)] += 1;
+                });
+        }
+    };
+
+    if (threadCount == 0) {
+        threadCount = max(1u, thread::hardware_concurrency());
+    }
+    size_t workers = min<size_t>(threadCount,
+                                 max<size_t>(1, tasks.size() / MIN_TASKS_PER_THREAD));
+
+    vector<PartialFlow> partials(workers);
+    size_t chunk = (tasks.size() + workers - 1) / workers;
+
+    if (workers == 1) {
+        accumulate(0, tasks.size(), partials[0]);
+    } else {
+        vector<thread> threads;
+        for (size_t w = 0; w < workers; ++w) {
+            size_t begin = min(tasks.size(), w * chunk);
+            size_t end = min(tasks.size(), begin + chunk);
+            threads.emplace_back(accumulate, begin, end, ref(partials[w]));
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    // Combinar los acumulados parciales
+    flow.deltas = move(partials[0].deltas);
+    flow.completions = move(partials[0].completions);
+    for (size_t w = 1; w < workers; ++w) {
+        for (size_t s = 0; s < stateCount; ++s) {
+            for (size_t b = 0; b < bucketCount; ++b) {
+                flow.deltas[s][b] += partials[w].deltas[s][b];
+            }
+        }
+        for (size_t b = 0; b < bucketCount; ++b) {
+            flow.completions[b] += partials[w].completions[b];
+        }
+    }
+
+    flow.dirtyFrom = 0;
+    boards[board->getId()] = move(flow);
+}
+
+// Actualizaciones incrementales
+void FlowMetricsManager::attach(shared_ptr<EventBus> bus) {
+    subscriptions = EventSubscriptions(bus);
+    
+    subscriptions.subscribe<TaskCreated>([this](const TaskCreated& event) {
+        recordTaskAdded(event.boardId, *event.task);
+    });
+    subscriptions.subscribe<TaskRemoved>([this](const TaskRemoved& event) {
+        recordTaskRemoved(event.boardId, *event.task);
+    });
+    subscriptions.subscribe<TaskMoved>([this](const TaskMoved& event) {
+        recordMove(event.boardId, event.fromState, event.toState, event.when);
+    });
+    subscriptions.subscribe<BoardCleared>([this](const BoardCleared& event) {
+        forgetBoard(event.boardId);
+    });
+    subscriptions.subscribe<BoardRemoved>([this](const BoardRemoved& event) {
+        forgetBoard(event.boardId);
+    });
+}
+
+void FlowMetricsManager::detach() {
+    subscriptions.reset();
+}
+
+void FlowMetricsManager::applyTaskHistory(BoardFlow& flow, const Task& task, int sign) {
+    // Cada índice se usa antes del siguiente ensureBucket, que puede
+    // agregar intervalos al principio y desplazar los anteriores
+    forEachStateSpan(task, doneState,
+        [&](const string& state, const chrono::system_clock::time_point& since,
+            const chrono::system_clock::time_point* until) {
+            auto it = flow.stateIndex.find(state);
+            if (it == flow.stateIndex.end()) return;
+
+            size_t from = ensureBucket(flow, since);
+            flow.deltas[it->second][from] += sign;
+            flow.dirtyFrom = min(flow.dirtyFrom, from);
+
+            if (until) {
+                size_t to = ensureBucket(flow, *until);
+                flow.deltas[it->second][to] -= sign;
+                flow.dirtyFrom = min(flow.dirtyFrom, to);
+            }
+        },
+        [&](const chrono::system_clock::time_point& when) {
+            size_t bucket = ensureBucket(flow, when);
+            flow.completions[bucket] += sign;
+            flow.dirtyFrom = min(flow.dirtyFrom, bucket);
+        });
+}
+
+void FlowMetricsManager::recordTaskAdded(int boardId, const Task& task) {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) return;
+
+    applyTaskHistory(it->second, task, 1);
+}
+
+void FlowMetricsManager::recordTaskRemoved(int boardId, const Task& task) {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) return;
+
+    applyTaskHistory(it->second, task, -1);
+}
+
+void FlowMetricsManager::recordMove(int boardId, string_view fromState,
+                                    string_view toState,
+                                    const chrono::system_clock::time_point& when) {
+    auto it = boards.find(boardId);
+    if (it == boards.end()) return;
+
+    BoardFlow& flow = it->second;
+    size_t bucket = ensureBucket(flow, when);
+
+    auto fromIt = flow.stateIndex.find(fromState);
+    if (fromIt != flow.stateIndex.end()) {
+        flow.deltas[fromIt->second][bucket] -= 1;
+    }
+
+    auto toIt = flow.stateIndex.find(toState);
+    if (toIt != flow.stateIndex.end()) {
+        flow.deltas[toIt->second][bucket] += 1;
+    }
+
+    if (toState == doneState) {
+        flow.completions[bucket] += 1;
+    }
+
+    flow.dirtyFrom = min(flow.dirtyFrom, bucket);
+}
+
+// Consultas
+bool FlowMetricsManager::isTracking(int boardId) const {
+    return boards.find(boardId) != boards.end();
+}
+
+const FlowSeries& FlowMetricsManager::getSeries(int boardId) {
+    static const FlowSeries emptySeries;
+
+    auto it = boards.find(boardId);
+    if (it == boards.end()) {
+        return emptySeries;
+    }
+
+    recomputeSeries(it->second);
+    return it->second.series;
+}
+
+FlowMetricsManager::Granularity FlowMetricsManager::getGranularity() const {
+    return granularity;
+}
+
+// Métodos de utilidad
+void FlowMetricsManager::forgetBoard(int boardId) {
+    boards.erase(boardId);
+}
+
+void FlowMetricsManager::clear() {
+    boards.clear();
+}
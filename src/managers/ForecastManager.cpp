@@ -0,0 +1,268 @@
+#include "managers/ForecastManager.h"
+#include "utils/DateUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+// Simulaciones por bloque de trabajo; el bloque es la unidad de reparto
+const size_t TRIALS_PER_CHUNK = 256;
+
+// Grafo de dependencias en formato CSR: dependents[offsets[i]..offsets[i+1])
+// son las tareas que se desbloquean al terminar la tarea i
+struct DependencyGraph {
+    vector<int> indegree;
+    vector<size_t> offsets;
+    vector<int> dependents;
+    vector<int> initiallyReady;
+};
+
+DependencyGraph buildGraph(const vector<shared_ptr<Task>>& tasks) {
+    DependencyGraph graph;
+    size_t n = tasks.size();
+
+    unordered_map<int, int> indexById;
+    for (size_t i = 0; i < n; ++i) {
+        indexById[tasks[i]->getId()] = static_cast<int>(i);
+    }
+
+    // Solo cuentan las dependencias dentro del conjunto pendiente;
+    // las demás ya están terminadas o fuera del pronóstico
+    vector<pair<int, int>> edges;  // (dependencia, dependiente)
+    graph.indegree.assign(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (int depId : tasks[i]->getDependencies()) {
+            auto it = indexById.find(depId);
+            if (it != indexById.end()) {
+                edges.emplace_back(it->second, static_cast<int>(i));
+                graph.indegree[i]++;
+            }
+        }
+    }
+
+    graph.offsets.assign(n + 1, 0);
+    for (const auto& edge : edges) {
+        graph.offsets[edge.first + 1]++;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        graph.offsets[i + 1] += graph.offsets[i];
+    }
+
+    graph.dependents.resize(edges.size());
+    vector<size_t> cursor(graph.offsets.begin(), graph.offsets.end() - 1);
+    for (const auto& edge : edges) {
+        graph.dependents[cursor[edge.first]++] = edge.second;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (graph.indegree[i] == 0) {
+            graph.initiallyReady.push_back(static_cast<int>(i));
+        }
+    }
+
+    return graph;
+}
+
+// Estado reutilizable de un hilo entre simulaciones (sin memoria compartida)
+struct TrialScratch {
+    vector<int> indegree;
+    vector<int> ready;
+    vector<int> unlocked;
+};
+
+int runTrial(const DependencyGraph& graph, const vector<int>& samples,
+             int maxDays, mt19937_64& rng, TrialScratch& scratch) {
+    size_t remaining = graph.indegree.size();
+    if (remaining == 0) {
+        return 0;
+    }
+
+    scratch.indegree = graph.indegree;
+    scratch.ready = graph.initiallyReady;
+    size_t readyHead = 0;
+
+    uniform_int_distribution<size_t> pick(0, samples.size() - 1);
+    int day = 0;
+
+    while (remaining > 0 && day < maxDays) {
+        ++day;
+        int capacity = samples[pick(rng)];
+        scratch.unlocked.clear();
+
+        while (capacity > 0 && readyHead < scratch.ready.size()) {
+            int task = scratch.ready[readyHead++];
+            --remaining;
+            --capacity;
+
+            for (size_t e = graph.offsets[task]; e < graph.offsets[task + 1]; ++e) {
+                int dependent = graph.dependents[e];
+                if (--scratch.indegree[dependent] == 0) {
+                    scratch.unlocked.push_back(dependent);
+                }
+            }
+        }
+
+        // Lo desbloqueado hoy se puede trabajar desde mañana
+        scratch.ready.insert(scratch.ready.end(),
+                             scratch.unlocked.begin(), scratch.unlocked.end());
+
+        // Nada listo y nada nuevo: el resto depende de un ciclo
+        if (readyHead == scratch.ready.size() && remaining > 0) {
+            return maxDays;
+        }
+    }
+
+    return day;
+}
+
+} // namespace
+
+// ForecastResult
+ForecastResult::ForecastResult()
+    : valid(false), trials(0), taskCount(0), blockedTrials(0),
+      p50Days(0), p85Days(0), p95Days(0) {}
+
+// ForecastManager
+
+// Constructor
+ForecastManager::ForecastManager(unsigned int threadCount, int historyDays,
+                                 int maxDays, const string& doneState)
+    : threadCount(threadCount), historyDays(historyDays), maxDays(maxDays),
+      doneState(doneState) {}
+
+// Destructor
+ForecastManager::~ForecastManager() {}
+
+// Throughput histórico
+vector<int> ForecastManager::collectDailyThroughput(
+    const vector<shared_ptr<Task>>& tasks) const {
+    vector<int> daily(historyDays, 0);
+
+    auto today = DateUtils::startOfDay(chrono::system_clock::now());
+    auto windowStart = today - chrono::hours(24 * (historyDays - 1));
+
+    for (const auto& task : tasks) {
+        for (const auto& transition : task->getStateTransitions()) {
+            if (transition.toState != doneState || transition.timestamp < windowStart) {
+                continue;
+            }
+            auto day = chrono::duration_cast<chrono::hours>(
+                transition.timestamp - windowStart).count() / 24;
+            if (day < historyDays) {
+                daily[day]++;
+            }
+        }
+    }
+
+    return daily;
+}
+
+// Pronóstico
+ForecastResult ForecastManager::forecast(shared_ptr<Board> board, size_t trials,
+                                         uint64_t seed) const {
+    if (!board) {
+        return ForecastResult();
+    }
+
+    auto tasks = board->getAllTasks();
+
+    vector<shared_ptr<Task>> pending;
+    for (const auto& task : tasks) {
+        if (task->getState() != doneState) {
+            pending.push_back(task);
+        }
+    }
+
+    return forecast(pending, collectDailyThroughput(tasks), trials, seed);
+}
+
+ForecastResult ForecastManager::forecast(const vector<shared_ptr<Task>>& pendingTasks,
+                                         const vector<int>& dailyThroughput,
+                                         size_t trials, uint64_t seed) const {
+    ForecastResult result;
+    result.trials = trials;
+    result.taskCount = pendingTasks.size();
+
+    // Sin ningún día productivo no hay base para simular
+    bool anyProgress = any_of(dailyThroughput.begin(), dailyThroughput.end(),
+                              [](int count) { return count > 0; });
+    if (trials == 0 || !anyProgress) {
+        return result;
+    }
+
+    DependencyGraph graph = buildGraph(pendingTasks);
+    vector<int> daysByTrial(trials, 0);
+
+    size_t chunkCount = (trials + TRIALS_PER_CHUNK - 1) / TRIALS_PER_CHUNK;
+    atomic<size_t> nextChunk(0);
+
+    // Cada hilo toma bloques hasta agotarlos; cada bloque escribe en su
+    // propio rango de daysByTrial, así que no hace falta ningún lock
+    auto worker = [&]() {
+        TrialScratch scratch;
+        for (;;) {
+            size_t chunk = nextChunk.fetch_add(1);
+            if (chunk >= chunkCount) break;
+
+            seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+                              static_cast<uint32_t>(chunk)};
+            mt19937_64 rng(sequence);
+
+            size_t begin = chunk * TRIALS_PER_CHUNK;
+            size_t end = min(trials, begin + TRIALS_PER_CHUNK);
+            for (size_t t = begin; t < end; ++t) {
+                daysByTrial[t] = runTrial(graph, dailyThroughput, maxDays, rng, scratch);
+            }
+        }
+    };
+
+    unsigned int workers = threadCount > 0 ? threadCount
+                                           : max(1u, thread::hardware_concurrency());
+    workers = static_cast<unsigned int>(min<size_t>(workers, chunkCount));
+
+    if (workers <= 1) {
+        worker();
+    } else {
+        vector<thread> threads;
+        for (unsigned int w = 0; w < workers; ++w) {
+            threads.emplace_back(worker);
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    result.blockedTrials = static_cast<size_t>(
+        count(daysByTrial.begin(), daysByTrial.end(), maxDays));
+
+    sort(daysByTrial.begin(), daysByTrial.end());
+    auto percentile = [&](double q) {
+        return daysByTrial[static_cast<size_t>(q * (trials - 1))];
+    };
+
+    result.p50Days = percentile(0.50);
+    result.p85Days = percentile(0.85);
+    result.p95Days = percentile(0.95);
+
+    auto today = DateUtils::startOfDay(chrono::system_clock::now());
+    result.p50Date = DateUtils::addDays(today, result.p50Days);
+    result.p85Date = DateUtils::addDays(today, result.p85Days);
+    result.p95Date = DateUtils::addDays(today, result.p95Days);
+    result.valid = true;
+
+    return result;
+}
+
+// Configuración
+void ForecastManager::setThreadCount(unsigned int threadCount) {
+    this->threadCount = threadCount;
+}
+
+unsigned int ForecastManager::getThreadCount() const {
+    return threadCount;
+}
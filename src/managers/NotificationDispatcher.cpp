@@ -0,0 +1,131 @@
+#include "managers/NotificationDispatcher.h"
+#include <algorithm>
+
+using namespace std;
+
+// Constructor
+NotificationDispatcher::NotificationDispatcher(BatchCallback callback,
+                                               chrono::milliseconds window,
+                                               size_t capacity, size_t maxBatchSize)
+    : callback(callback), window(window), capacity(max<size_t>(1, capacity)),
+      maxBatchSize(max<size_t>(1, maxBatchSize)), pendingBase(0),
+      delivering(false), flushRequested(false), stopping(false) {
+    worker = thread(&NotificationDispatcher::run, this);
+}
+
+// Destructor
+NotificationDispatcher::~NotificationDispatcher() {
+    stop();
+}
+
+// Encolar
+bool NotificationDispatcher::submit(const Notification& notification) {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        if (stopping) return false;
+        stats.submitted++;
+        
+        // Solo se agrupan las que se refieren a una tarea concreta
+        bool coalescable = notification.taskId >= 0;
+        CoalesceKey key(static_cast<int>(notification.type), notification.userId,
+                        notification.taskId);
+        
+        if (coalescable) {
+            auto it = pendingByKey.find(key);
+            if (it != pendingByKey.end()) {
+                pending[it->second - pendingBase] = notification;
+                stats.coalesced++;
+                return true;
+            }
+        }
+        
+        if (pending.size() >= capacity) {
+            stats.dropped++;
+            return false;
+        }
+        
+        if (coalescable) {
+            pendingByKey[key] = pendingBase + pending.size();
+        }
+        if (pending.empty()) {
+            firstPendingTime = chrono::steady_clock::now();
+        }
+        pending.push_back(notification);
+    }
+    
+    queueChanged.notify_one();
+    return true;
+}
+
+void NotificationDispatcher::flush() {
+    unique_lock<mutex> lock(queueMutex);
+    flushRequested = true;
+    queueChanged.notify_one();
+    batchDelivered.wait(lock, [this] { return pending.empty() && !delivering; });
+    flushRequested = false;
+}
+
+void NotificationDispatcher::stop() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueChanged.notify_one();
+    
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+// Hilo de entrega
+void NotificationDispatcher::run() {
+    unique_lock<mutex> lock(queueMutex);
+    
+    for (;;) {
+        queueChanged.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (pending.empty()) break;  // Detenido y sin nada pendiente
+        
+        // Dejar que se acumulen (y agrupen) las que lleguen dentro de la ventana
+        queueChanged.wait_until(lock, firstPendingTime + window,
+                                [this] { return stopping || flushRequested; });
+        
+        size_t count = min(pending.size(), maxBatchSize);
+        vector<Notification> batch(make_move_iterator(pending.begin()),
+                                   make_move_iterator(pending.begin() + count));
+        pending.erase(pending.begin(), pending.begin() + count);
+        
+        uint64_t firstRemaining = pendingBase + count;
+        for (auto it = pendingByKey.begin(); it != pendingByKey.end(); ) {
+            it = it->second < firstRemaining ? pendingByKey.erase(it) : next(it);
+        }
+        pendingBase = firstRemaining;
+        if (!pending.empty()) {
+            firstPendingTime = chrono::steady_clock::now();
+        }
+        
+        delivering = true;
+        lock.unlock();
+        if (callback) {
+            callback(batch);
+        }
+        lock.lock();
+        delivering = false;
+        
+        stats.delivered += batch.size();
+        stats.batches++;
+        batchDelivered.notify_all();
+    }
+    
+    batchDelivered.notify_all();
+}
+
+// Estadísticas
+NotificationDispatcher::Stats NotificationDispatcher::getStats() const {
+    lock_guard<mutex> lock(queueMutex);
+    return stats;
+}
+
+size_t NotificationDispatcher::getPendingCount() const {
+    lock_guard<mutex> lock(queueMutex);
+    return pending.size();
+}
@@ -1,4 +1,5 @@
 #include "managers/NotificationManager.h"
+#include "managers/NotificationDispatcher.h"
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -10,7 +11,7 @@ using namespace std;
 
 Notification::Notification(Type type, const string& title, 
                           const string& message, int taskId, int userId)
-    : type(type), title(title), message(message), taskId(taskId), 
+    : id(0), type(type), title(title), message(message), taskId(taskId), 
       userId(userId), timestamp(chrono::system_clock::now()), read(false) {}
 
 string Notification::getTypeString() const {
@@ -41,7 +42,10 @@ string Notification::toString() const {
 
 // Constructor
 NotificationManager::NotificationManager() 
-    : lastCheck(chrono::system_clock::now()) {}
+    : nextNotificationId(1), totalCount(0),
+      maxPerUser(500), ttl(chrono::hours(24 * 30)),
+      deduplicatedCount(0), evictedCount(0),
+      dueDateScheduler(make_shared<DueDateScheduler>()) {}
 
 // Destructor
 NotificationManager::~NotificationManager() {}
@@ -52,14 +56,150 @@ void NotificationManager::setNotificationCallback(
     notificationCallback = callback;
 }
 
+void NotificationManager::setBatchCallback(
+    function<void(const vector<Notification>&)> callback,
+    chrono::milliseconds window, size_t capacity) {
+    // El dispatcher anterior entrega lo pendiente antes de reemplazarse
+    dispatcher.reset();
+    
+    if (callback) {
+        dispatcher = make_shared<NotificationDispatcher>(callback, window, capacity);
+    }
+}
+
+void NotificationManager::flushNotifications() {
+    if (dispatcher) {
+        dispatcher->flush();
+    }
+}
+
+shared_ptr<NotificationDispatcher> NotificationManager::getDispatcher() const {
+    return dispatcher;
+}
+
 // Agregar notificaciones
-void NotificationManager::addNotification(const Notification& notification) {
-    notifications.push_back(notification);
+uint64_t NotificationManager::addNotification(const Notification& notification) {
+    // Solo las que se refieren a una tarea tienen clave de duplicado
+    if (notification.taskId >= 0) {
+        auto it = idByDedupKey.find(dedupKeyOf(notification));
+        if (it != idByDedupKey.end()) {
+            Notification* existing = findNotification(it->second);
+            if (existing && !existing->read) {
+                // Se conserva la pendiente con el texto más reciente
+                existing->title = notification.title;
+                existing->message = notification.message;
+                deduplicatedCount++;
+                return existing->id;
+            }
+        }
+    }
+    
+    Notification toStore = notification;
+    toStore.id = nextNotificationId++;
+    Notification& stored = storeNotification(toStore);
+    uint64_t id = stored.id;
     
-    // Llamar callback si está configurado
-    if (notificationCallback) {
-        notificationCallback(notification);
+    // Entregar en lote si hay dispatcher; si no, llamar callback si está configurado
+    if (dispatcher) {
+        dispatcher->submit(stored);
+    } else if (notificationCallback) {
+        notificationCallback(stored);
     }
+    
+    // Vencimientos pendientes, unos pocos por cada alta
+    expireNotifications(chrono::system_clock::now(), 8);
+    
+    return id;
+}
+
+void NotificationManager::restoreNotification(const Notification& notification) {
+    if (notification.id == 0 || findNotification(notification.id)) return;
+    
+    nextNotificationId = max(nextNotificationId, notification.id + 1);
+    storeNotification(notification);
+}
+
+Notification& NotificationManager::storeNotification(const Notification& notification) {
+    UserInbox& inbox = inboxes[notification.userId];
+    
+    // Las bandejas se mantienen ordenadas por id
+    auto position = inbox.items.end();
+    if (!inbox.items.empty() && inbox.items.back().id > notification.id) {
+        position = lower_bound(inbox.items.begin(), inbox.items.end(), notification.id,
+            [](const Notification& n, uint64_t value) {
+                return n.id < value;
+            });
+    }
+    Notification& stored = *inbox.items.insert(position, notification);
+    
+    uint64_t id = stored.id;
+    userByNotificationId[id] = stored.userId;
+    if (!stored.read) {
+        inbox.unreadCount++;
+    }
+    totalCount++;
+    
+    if (stored.taskId >= 0) {
+        idByDedupKey[dedupKeyOf(stored)] = id;
+    }
+    
+    // La cola de vencimientos va por fecha de creación; las restauradas desde
+    // disco pueden llegar fuera de ese orden
+    pair<int64_t, uint64_t> expiry(stored.timestamp.time_since_epoch().count(), id);
+    if (expiryQueue.empty() || expiryQueue.back().first <= expiry.first) {
+        expiryQueue.push_back(expiry);
+    } else {
+        expiryQueue.insert(upper_bound(expiryQueue.begin(), expiryQueue.end(), expiry), expiry);
+    }
+    
+    // Cuota por usuario: se van las más antiguas
+    while (inbox.items.size() > maxPerUser && inbox.items.front().id != id) {
+        removeNotification(inbox.items.front().id);
+        evictedCount++;
+    }
+    
+    return *findNotification(id);
+}
+
+void NotificationManager::removeNotification(uint64_t id) {
+    auto userIt = userByNotificationId.find(id);
+    if (userIt == userByNotificationId.end()) return;
+    
+    UserInbox& inbox = inboxes[userIt->second];
+    auto& items = inbox.items;
+    
+    // Lo habitual es quitar la más antigua
+    auto it = items.begin();
+    if (it == items.end() || it->id != id) {
+        it = lower_bound(items.begin(), items.end(), id,
+            [](const Notification& n, uint64_t value) {
+                return n.id < value;
+            });
+        if (it == items.end() || it->id != id) return;
+    }
+    
+    if (!it->read) {
+        inbox.unreadCount--;
+    }
+    if (it->taskId >= 0) {
+        auto keyIt = idByDedupKey.find(dedupKeyOf(*it));
+        if (keyIt != idByDedupKey.end() && keyIt->second == id) {
+            idByDedupKey.erase(keyIt);
+        }
+    }
+    
+    userByNotificationId.erase(userIt);
+    totalCount--;
+    
+    if (it == items.begin()) {
+        items.pop_front();
+    } else {
+        items.erase(it);
+    }
+}
+
+NotificationManager::DedupKey NotificationManager::dedupKeyOf(const Notification& notification) {
+    return DedupKey(static_cast<int>(notification.type), notification.taskId, notification.userId);
 }
 
 void NotificationManager::notifyTaskDueSoon(shared_ptr<Task> task, int userId) {
@@ -133,54 +273,78 @@ void NotificationManager::notifyTaskCompleted(shared_ptr<Task> task, int userId)
     addNotification(notification);
 }
 
-// Verificar tareas próximas a vencer
-void NotificationManager::checkDueDates(shared_ptr<Project> project) {
+// Vencimientos
+void NotificationManager::watchProject(shared_ptr<Project> project) {
     if (!project) return;
     
-    // Solo verificar una vez al día
-    auto now = chrono::system_clock::now();
-    auto hoursSinceLastCheck = chrono::duration_cast<chrono::hours>(
-        now - lastCheck).count();
-    
-    if (hoursSinceLastCheck < 24) {
-        return;  // Ya se verificó recientemente
+    for (const auto& board : project->getBoards()) {
+        dueDateScheduler->watchBoard(board);
     }
+}
+
+int NotificationManager::processDueDates(const chrono::system_clock::time_point& now) {
+    auto alerts = dueDateScheduler->collectDue(now);
     
-    lastCheck = now;
-    
-    // Verificar todas las tareas del proyecto
-    for (const auto& board : project->getBoards()) {
-        auto tasks = board->getAllTasks();
-        
-        for (const auto& task : tasks) {
-            if (task->getState() == "Terminado") {
-                continue;  // Ignorar tareas terminadas
-            }
-            
-            int daysUntilDue = task->getDaysUntilDue();
-            
-            // Notificar si vence en 1 día o menos
-            if (daysUntilDue <= 1 && daysUntilDue >= 0) {
-                notifyTaskDueSoon(task, task->getAssignedUserId());
-            }
-            
-            // Notificar si está vencida
-            if (task->isOverdue()) {
-                notifyTaskOverdue(task, task->getAssignedUserId());
-            }
+    for (const auto& due : alerts) {
+        if (due.alert == DueDateScheduler::Alert::DUE_SOON) {
+            notifyTaskDueSoon(due.task, due.task->getAssignedUserId());
+        } else {
+            notifyTaskOverdue(due.task, due.task->getAssignedUserId());
         }
     }
+    
+    return static_cast<int>(alerts.size());
+}
+
+void NotificationManager::checkDueDates(shared_ptr<Project> project) {
+    watchProject(project);
+    processDueDates();
+}
+
+chrono::system_clock::time_point NotificationManager::getNextDueDateCheck() {
+    return dueDateScheduler->getNextDeadline();
+}
+
+shared_ptr<DueDateScheduler> NotificationManager::getDueDateScheduler() const {
+    return dueDateScheduler;
+}
+
+// Búsqueda por id: la bandeja está ordenada por id
+Notification* NotificationManager::findNotification(uint64_t id) {
+    auto userIt = userByNotificationId.find(id);
+    if (userIt == userByNotificationId.end()) return nullptr;
+    
+    auto& items = inboxes[userIt->second].items;
+    auto it = lower_bound(items.begin(), items.end(), id,
+        [](const Notification& n, uint64_t value) {
+            return n.id < value;
+        });
+    
+    return (it != items.end() && it->id == id) ? &*it : nullptr;
 }
 
 // Consultas
 vector<Notification> NotificationManager::getNotificationsByUser(int userId) const {
+    auto it = inboxes.find(userId);
+    if (it == inboxes.end()) return {};
+    
+    return vector<Notification>(it->second.items.begin(), it->second.items.end());
+}
+
+vector<Notification> NotificationManager::getNotificationsPage(int userId, size_t offset,
+                                                               size_t limit) const {
     vector<Notification> result;
     
-    copy_if(notifications.begin(), notifications.end(), 
-                back_inserter(result),
-        [userId](const Notification& n) {
-            return n.userId == userId;
-        });
+    auto it = inboxes.find(userId);
+    if (it == inboxes.end() || offset >= it->second.items.size()) return result;
+    
+    const auto& items = it->second.items;
+    size_t count = min(limit, items.size() - offset);
+    result.reserve(count);
+    
+    // offset 0 es la más reciente
+    auto newest = items.rbegin() + offset;
+    result.assign(newest, newest + count);
     
     return result;
 }
@@ -188,32 +352,49 @@ vector<Notification> NotificationManager::getNotificationsByUser(int userId) con
 vector<Notification> NotificationManager::getUnreadNotifications(int userId) const {
     vector<Notification> result;
     
-    copy_if(notifications.begin(), notifications.end(),
+    auto it = inboxes.find(userId);
+    if (it == inboxes.end()) return result;
+    
+    result.reserve(it->second.unreadCount);
+    copy_if(it->second.items.begin(), it->second.items.end(),
                 back_inserter(result),
-        [userId](const Notification& n) {
-            return n.userId == userId && !n.read;
+        [](const Notification& n) {
+            return !n.read;
         });
     
     return result;
 }
 
 int NotificationManager::getUnreadCount(int userId) const {
-    return static_cast<int>(getUnreadNotifications(userId).size());
+    auto it = inboxes.find(userId);
+    return it != inboxes.end() ? static_cast<int>(it->second.unreadCount) : 0;
+}
+
+size_t NotificationManager::getNotificationCount(int userId) const {
+    auto it = inboxes.find(userId);
+    return it != inboxes.end() ? it->second.items.size() : 0;
 }
 
 // Marcar como leída
-void NotificationManager::markAsRead(size_t index) {
-    if (index < notifications.size()) {
-        notifications[index].read = true;
+bool NotificationManager::markAsRead(uint64_t notificationId) {
+    Notification* notification = findNotification(notificationId);
+    if (!notification) return false;
+    
+    if (!notification->read) {
+        notification->read = true;
+        inboxes[notification->userId].unreadCount--;
     }
+    return true;
 }
 
 void NotificationManager::markAllAsRead(int userId) {
-    for (auto& notification : notifications) {
-        if (notification.userId == userId) {
-            notification.read = true;
-        }
+    auto it = inboxes.find(userId);
+    if (it == inboxes.end() || it->second.unreadCount == 0) return;
+    
+    for (auto& notification : it->second.items) {
+        notification.read = true;
     }
+    it->second.unreadCount = 0;
 }
 
 // Limpiar notificaciones
@@ -221,25 +402,85 @@ void NotificationManager::clearOldNotifications(int daysOld) {
     auto now = chrono::system_clock::now();
     auto cutoff = now - chrono::hours(daysOld * 24);
     
-    notifications.erase(
-        remove_if(notifications.begin(), notifications.end(),
-            [cutoff](const Notification& n) {
-                return n.timestamp < cutoff && n.read;
-            }),
-        notifications.end()
-    );
+    // Desde el principio de cada bandeja; se detiene en la primera reciente
+    // o no leída para no recorrer todo
+    for (auto& pair : inboxes) {
+        auto& items = pair.second.items;
+        while (!items.empty() && items.front().read && items.front().timestamp < cutoff) {
+            removeNotification(items.front().id);
+        }
+    }
 }
 
 void NotificationManager::clearAll() {
-    notifications.clear();
+    inboxes.clear();
+    userByNotificationId.clear();
+    idByDedupKey.clear();
+    expiryQueue.clear();
+    totalCount = 0;
+}
+
+// Retención
+void NotificationManager::setRetention(size_t maxPerUser, chrono::system_clock::duration ttl) {
+    this->maxPerUser = max<size_t>(1, maxPerUser);
+    this->ttl = ttl;
+    
+    for (auto& pair : inboxes) {
+        auto& items = pair.second.items;
+        while (items.size() > this->maxPerUser) {
+            removeNotification(items.front().id);
+            evictedCount++;
+        }
+    }
+}
+
+size_t NotificationManager::expireNotifications(const chrono::system_clock::time_point& now,
+                                                size_t budget) {
+    // Se guarda la fecha de creación y no el vencimiento para que un cambio
+    // de TTL no desordene la cola
+    int64_t limitTicks = (now - ttl).time_since_epoch().count();
+    size_t expired = 0;
+    
+    // La cola sigue el orden de creación; las ya eliminadas se saltan
+    while (expired < budget && !expiryQueue.empty() && expiryQueue.front().first <= limitTicks) {
+        uint64_t id = expiryQueue.front().second;
+        expiryQueue.pop_front();
+        
+        if (userByNotificationId.count(id)) {
+            removeNotification(id);
+            evictedCount++;
+            expired++;
+        }
+    }
+    
+    return expired;
+}
+
+uint64_t NotificationManager::getDeduplicatedCount() const {
+    return deduplicatedCount;
+}
+
+uint64_t NotificationManager::getEvictedCount() const {
+    return evictedCount;
 }
 
 // Métodos de utilidad
 size_t NotificationManager::getNotificationCount() const {
-    return notifications.size();
+    return totalCount;
 }
 
-const vector<Notification>& NotificationManager::getAllNotifications() const {
-    return notifications;
+vector<Notification> NotificationManager::getAllNotifications() const {
+    vector<Notification> result;
+    result.reserve(totalCount);
+    
+    for (const auto& pair : inboxes) {
+        result.insert(result.end(), pair.second.items.begin(), pair.second.items.end());
+    }
+    
+    sort(result.begin(), result.end(),
+        [](const Notification& a, const Notification& b) {
+            return a.id < b.id;
+        });
+    
+    return result;
 }
-
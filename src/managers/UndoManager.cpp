@@ -0,0 +1,516 @@
+#include "managers/UndoManager.h"
+#include "utils/StringPool.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+int64_t toTicks(const chrono::system_clock::time_point& tp) {
+    return tp.time_since_epoch().count();
+}
+
+chrono::system_clock::time_point fromTicks(int64_t ticks) {
+    return chrono::system_clock::time_point(chrono::system_clock::duration(ticks));
+}
+
+bool isTextField(UndoCommand::Field field) {
+    return field == UndoCommand::Field::TITLE || field == UndoCommand::Field::DESCRIPTION;
+}
+
+// Deja en el registro solo el tramo que cambió, igual que los deltas de
+// TaskHistory
+void storeTextDelta(UndoCommand& command, const string& before, const string& after) {
+    size_t limit = min(before.size(), after.size());
+    size_t prefix = 0;
+    while (prefix < limit && before[prefix] == after[prefix]) {
+        ++prefix;
+    }
+    size_t suffix = 0;
+    while (suffix < limit - prefix &&
+           before[before.size() - 1 - suffix] == after[after.size() - 1 - suffix]) {
+        ++suffix;
+    }
+
+    command.oldNumber = static_cast<int64_t>(prefix);
+    command.newNumber = static_cast<int64_t>(suffix);
+    command.oldText = before.substr(prefix, before.size() - prefix - suffix);
+    command.newText = after.substr(prefix, after.size() - prefix - suffix);
+}
+
+// Reemplaza en text el tramo del medio del registro por middle
+string spliceText(const string& text, const UndoCommand& command, const string& middle) {
+    size_t prefix = static_cast<size_t>(command.oldNumber);
+    size_t suffix = static_cast<size_t>(command.newNumber);
+    if (prefix + suffix > text.size()) {
+        return text;  // El texto cambió por fuera de la pila
+    }
+
+    string result;
+    result.reserve(prefix + middle.size() + suffix);
+    result.append(text, 0, prefix);
+    result.append(middle);
+    result.append(text, text.size() - suffix, suffix);
+    return result;
+}
+
+} // namespace
+
+// UndoCommand
+UndoCommand::UndoCommand(Kind kind, Field field)
+    : kind(kind), field(field), actorId(StringPool::EMPTY_ID), taskId(-1),
+      oldNumber(0), newNumber(0), position(0), when(chrono::steady_clock::now()) {}
+
+string UndoCommand::getDescription() const {
+    switch (kind) {
+        case Kind::MOVE_TASK:         return "Mover tarea";
+        case Kind::ADD_TASK:          return "Agregar tarea";
+        case Kind::REMOVE_TASK:       return "Eliminar tarea";
+        case Kind::ADD_DEPENDENCY:    return "Agregar dependencia";
+        case Kind::REMOVE_DEPENDENCY: return "Quitar dependencia";
+        case Kind::ADD_SUBTASK:       return "Agregar subtarea";
+        case Kind::REMOVE_SUBTASK:    return "Eliminar subtarea";
+        case Kind::GROUP:             break;
+        case Kind::EDIT_FIELD:
+            switch (field) {
+                case Field::TITLE:       return "Editar título";
+                case Field::DESCRIPTION: return "Editar descripción";
+                case Field::ASSIGNEE:    return "Cambiar asignado";
+                case Field::PRIORITY:    return "Cambiar prioridad";
+                case Field::DUE_DATE:    return "Cambiar fecha límite";
+                case Field::NONE:        break;
+            }
+            break;
+    }
+    return "Editar tarea";
+}
+
+// UndoManager
+
+// Constructor
+UndoManager::UndoManager(size_t maxDepth, chrono::milliseconds coalesceWindow)
+    : maxDepth(max<size_t>(1, maxDepth)), coalesceWindow(coalesceWindow), groupDepth(0) {}
+
+// Los textos llegan completos y se reducen a su delta al apilarse
+void UndoManager::push(UndoCommand command) {
+    redoStack.clear();
+
+    if (groupDepth > 0) {
+        if (openGroup.empty() || !merge(openGroup.back(), command)) {
+            if (command.kind == UndoCommand::Kind::EDIT_FIELD && isTextField(command.field)) {
+                storeTextDelta(command, string(command.oldText), string(command.newText));
+            }
+            openGroup.push_back(move(command));
+        }
+        return;
+    }
+
+    if (!undoStack.empty() && merge(undoStack.back(), command)) {
+        return;
+    }
+
+    if (command.kind == UndoCommand::Kind::EDIT_FIELD && isTextField(command.field)) {
+        storeTextDelta(command, string(command.oldText), string(command.newText));
+    }
+    undoStack.push_back(move(command));
+    if (undoStack.size() > maxDepth) {
+        undoStack.pop_front();
+    }
+}
+
+// Fusionar ediciones rápidas del mismo campo: se conserva el valor anterior
+// de la primera y el nuevo de la última
+bool UndoManager::merge(UndoCommand& top, UndoCommand& command) const {
+    if (command.kind != UndoCommand::Kind::EDIT_FIELD ||
+        top.kind != UndoCommand::Kind::EDIT_FIELD || top.field != command.field ||
+        top.task != command.task || top.actorId != command.actorId ||
+        command.when - top.when > coalesceWindow) {
+        return false;
+    }
+
+    if (isTextField(command.field)) {
+        // command.oldText es el texto que dejó top: se reconstruye el
+        // original y se calcula un solo delta hasta el texto nuevo
+        string original = spliceText(command.oldText, top, top.oldText);
+        storeTextDelta(top, original, command.newText);
+    } else {
+        top.newNumber = command.newNumber;
+    }
+    top.when = command.when;
+    return true;
+}
+
+bool UndoManager::apply(const UndoCommand& command, bool reverse) {
+    const string& actor = StringPool::getInstance().lookup(command.actorId);
+
+    switch (command.kind) {
+        case UndoCommand::Kind::MOVE_TASK: {
+            auto board = command.board.lock();
+            if (!board) return false;
+            uint32_t stateId = static_cast<uint32_t>(reverse ? command.oldNumber : command.newNumber);
+            return board->relocateTask(command.taskId, StringPool::getInstance().lookup(stateId), actor,
+                                       reverse ? command.position : SIZE_MAX);
+        }
+
+        case UndoCommand::Kind::ADD_TASK:
+        case UndoCommand::Kind::REMOVE_TASK: {
+            auto board = command.board.lock();
+            if (!board || !command.task) return false;
+            bool remove = (command.kind == UndoCommand::Kind::ADD_TASK) == reverse;
+            if (remove) {
+                board->removeTask(command.task->getId());
+            } else if (!board->findTaskById(command.task->getId())) {
+                board->addTask(command.task, command.task->getState());
+            }
+            return true;
+        }
+
+        case UndoCommand::Kind::ADD_DEPENDENCY:
+        case UndoCommand::Kind::REMOVE_DEPENDENCY: {
+            if (!command.task) return false;
+            int dependencyId = static_cast<int>(command.newNumber);
+            bool remove = (command.kind == UndoCommand::Kind::ADD_DEPENDENCY) == reverse;
+            if (remove) {
+                command.task->removeDependency(dependencyId);
+            } else {
+                command.task->addDependency(dependencyId);
+            }
+            return true;
+        }
+
+        case UndoCommand::Kind::ADD_SUBTASK:
+        case UndoCommand::Kind::REMOVE_SUBTASK: {
+            if (!command.task || !command.subtask) return false;
+            bool remove = (command.kind == UndoCommand::Kind::ADD_SUBTASK) == reverse;
+            if (remove) {
+                const auto& subtasks = command.task->getSubtasks();
+                auto it = find(subtasks.begin(), subtasks.end(), command.subtask);
+                if (it == subtasks.end()) return false;
+                command.task->removeSubtaskAt(static_cast<size_t>(it - subtasks.begin()));
+            } else {
+                command.task->insertSubtask(command.position, command.subtask);
+            }
+            return true;
+        }
+
+        case UndoCommand::Kind::EDIT_FIELD: {
+            if (!command.task) return false;
+            if (isTextField(command.field)) {
+                const string& current = command.field == UndoCommand::Field::TITLE
+                    ? command.task->getTitle() : command.task->getDescription();
+                applyField(*command.task, command.field, 0,
+                           spliceText(current, command, reverse ? command.oldText : command.newText),
+                           actor);
+            } else {
+                applyField(*command.task, command.field,
+                           reverse ? command.oldNumber : command.newNumber, "", actor);
+            }
+            return true;
+        }
+
+        case UndoCommand::Kind::GROUP: {
+            // Se deshace en orden inverso; basta con que algo se aplique
+            bool applied = false;
+            if (reverse) {
+                for (auto it = command.children.rbegin(); it != command.children.rend(); ++it) {
+                    applied = apply(*it, true) || applied;
+                }
+            } else {
+                for (const auto& child : command.children) {
+                    applied = apply(child, false) || applied;
+                }
+            }
+            return applied;
+        }
+    }
+
+    return false;
+}
+
+void UndoManager::applyField(Task& task, UndoCommand::Field field, int64_t number,
+                             const string& text, const string& actor) {
+    switch (field) {
+        case UndoCommand::Field::TITLE:       task.setTitle(text, actor); break;
+        case UndoCommand::Field::DESCRIPTION: task.setDescription(text, actor); break;
+        case UndoCommand::Field::ASSIGNEE:    task.setAssignedUserId(static_cast<int>(number), actor); break;
+        case UndoCommand::Field::PRIORITY:    task.setPriority(static_cast<int>(number)); break;
+        case UndoCommand::Field::DUE_DATE:    task.setDueDate(fromTicks(number)); break;
+        case UndoCommand::Field::NONE:        break;
+    }
+}
+
+void UndoManager::recordEdit(shared_ptr<Task> task, UndoCommand::Field field, const string& actor,
+                             int64_t oldNumber, int64_t newNumber,
+                             const string& oldText, const string& newText) {
+    UndoCommand command(UndoCommand::Kind::EDIT_FIELD, field);
+    command.actorId = StringPool::getInstance().intern(actor);
+    command.taskId = task->getId();
+    command.task = task;
+    command.oldNumber = oldNumber;
+    command.newNumber = newNumber;
+    command.oldText = oldText;
+    command.newText = newText;
+    push(move(command));
+}
+
+// Operaciones de tablero
+bool UndoManager::moveTask(shared_ptr<Board> board, int taskId, const string& newState,
+                           const string& movedBy) {
+    if (!board) return false;
+
+    auto task = board->findTaskById(taskId);
+    if (!task) return false;
+
+    string oldState = task->getState();
+    size_t position = board->getTaskPosition(taskId);
+    board->moveTask(taskId, newState, movedBy);
+    if (task->getState() == oldState) {
+        return false;  // Estado inválido o bloqueado por dependencias
+    }
+
+    UndoCommand command(UndoCommand::Kind::MOVE_TASK);
+    command.actorId = StringPool::getInstance().intern(movedBy);
+    command.taskId = taskId;
+    command.board = board;
+    command.oldNumber = StringPool::getInstance().intern(oldState);
+    command.newNumber = StringPool::getInstance().intern(newState);
+    command.position = static_cast<uint32_t>(min<size_t>(position, UINT32_MAX));
+    push(move(command));
+    return true;
+}
+
+void UndoManager::addTask(shared_ptr<Board> board, shared_ptr<Task> task, const string& state) {
+    if (!board || !task) return;
+
+    board->addTask(task, state);
+    if (board->findTaskById(task->getId()) != task) return;
+
+    UndoCommand command(UndoCommand::Kind::ADD_TASK);
+    command.taskId = task->getId();
+    command.board = board;
+    command.task = task;
+    push(move(command));
+}
+
+bool UndoManager::removeTask(shared_ptr<Board> board, int taskId) {
+    if (!board) return false;
+
+    auto task = board->findTaskById(taskId);
+    if (!task) return false;
+
+    board->removeTask(taskId);
+
+    UndoCommand command(UndoCommand::Kind::REMOVE_TASK);
+    command.taskId = taskId;
+    command.board = board;
+    command.task = task;
+    push(move(command));
+    return true;
+}
+
+// Operaciones de tarea
+void UndoManager::addDependency(shared_ptr<Task> task, int dependencyId) {
+    if (!task || task->hasDependency(dependencyId)) return;
+
+    task->addDependency(dependencyId);
+    if (!task->hasDependency(dependencyId)) return;
+
+    UndoCommand command(UndoCommand::Kind::ADD_DEPENDENCY);
+    command.taskId = task->getId();
+    command.task = task;
+    command.newNumber = dependencyId;
+    push(move(command));
+}
+
+void UndoManager::removeDependency(shared_ptr<Task> task, int dependencyId) {
+    if (!task || !task->hasDependency(dependencyId)) return;
+
+    task->removeDependency(dependencyId);
+
+    UndoCommand command(UndoCommand::Kind::REMOVE_DEPENDENCY);
+    command.taskId = task->getId();
+    command.task = task;
+    command.newNumber = dependencyId;
+    push(move(command));
+}
+
+void UndoManager::addSubtask(shared_ptr<Task> task, shared_ptr<Subtask> subtask) {
+    if (!task || !subtask) return;
+
+    UndoCommand command(UndoCommand::Kind::ADD_SUBTASK);
+    command.taskId = task->getId();
+    command.task = task;
+    command.subtask = subtask;
+    command.position = static_cast<uint32_t>(task->getSubtasks().size());
+
+    task->addSubtask(subtask);
+    push(move(command));
+}
+
+bool UndoManager::removeSubtask(shared_ptr<Task> task, int subtaskId) {
+    if (!task) return false;
+
+    const auto& subtasks = task->getSubtasks();
+    auto it = find_if(subtasks.begin(), subtasks.end(),
+        [subtaskId](const shared_ptr<Subtask>& subtask) {
+            return subtask->getId() == subtaskId;
+        });
+    if (it == subtasks.end()) return false;
+
+    return removeSubtaskAt(task, static_cast<size_t>(it - subtasks.begin()));
+}
+
+bool UndoManager::removeSubtaskAt(shared_ptr<Task> task, size_t position) {
+    if (!task || position >= task->getSubtasks().size()) return false;
+
+    UndoCommand command(UndoCommand::Kind::REMOVE_SUBTASK);
+    command.taskId = task->getId();
+    command.task = task;
+    command.subtask = task->getSubtasks()[position];
+    command.position = static_cast<uint32_t>(position);
+
+    task->removeSubtaskAt(position);
+    push(move(command));
+    return true;
+}
+
+// Ediciones de campos
+void UndoManager::setTitle(shared_ptr<Task> task, const string& title, const string& modifiedBy) {
+    if (!task || task->getTitle() == title) return;
+
+    string oldTitle = task->getTitle();
+    task->setTitle(title, modifiedBy);
+    recordEdit(task, UndoCommand::Field::TITLE, modifiedBy, 0, 0, oldTitle, title);
+}
+
+void UndoManager::setDescription(shared_ptr<Task> task, const string& description,
+                                 const string& modifiedBy) {
+    if (!task || task->getDescription() == description) return;
+
+    string oldDescription = task->getDescription();
+    task->setDescription(description, modifiedBy);
+    recordEdit(task, UndoCommand::Field::DESCRIPTION, modifiedBy, 0, 0,
+               oldDescription, description);
+}
+
+void UndoManager::setAssignedUserId(shared_ptr<Task> task, int userId, const string& modifiedBy) {
+    if (!task || task->getAssignedUserId() == userId) return;
+
+    int oldUserId = task->getAssignedUserId();
+    task->setAssignedUserId(userId, modifiedBy);
+    recordEdit(task, UndoCommand::Field::ASSIGNEE, modifiedBy, oldUserId, userId);
+}
+
+void UndoManager::setPriority(shared_ptr<Task> task, int priority, const string& modifiedBy) {
+    if (!task || task->getPriority() == priority) return;
+
+    int oldPriority = task->getPriority();
+    task->setPriority(priority);
+    if (task->getPriority() == oldPriority) return;  // Fuera de rango
+
+    recordEdit(task, UndoCommand::Field::PRIORITY, modifiedBy, oldPriority, priority);
+}
+
+void UndoManager::setDueDate(shared_ptr<Task> task, const chrono::system_clock::time_point& date,
+                             const string& modifiedBy) {
+    if (!task || task->getDueDate() == date) return;
+
+    int64_t oldTicks = toTicks(task->getDueDate());
+    task->setDueDate(date);
+    recordEdit(task, UndoCommand::Field::DUE_DATE, modifiedBy, oldTicks, toTicks(date));
+}
+
+// Agrupación
+void UndoManager::beginGroup() {
+    ++groupDepth;
+}
+
+void UndoManager::endGroup() {
+    if (groupDepth == 0 || --groupDepth > 0) return;
+
+    vector<UndoCommand> children;
+    children.swap(openGroup);
+    if (children.empty()) return;
+
+    // Los hijos ya están reducidos: se apilan sin pasar por push()
+    UndoCommand group(UndoCommand::Kind::GROUP);
+    if (children.size() == 1) {
+        group = move(children.front());
+    } else {
+        group.children = move(children);
+    }
+
+    undoStack.push_back(move(group));
+    if (undoStack.size() > maxDepth) {
+        undoStack.pop_front();
+    }
+}
+
+// Deshacer / rehacer
+bool UndoManager::undo() {
+    if (undoStack.empty()) return false;
+
+    UndoCommand command = move(undoStack.back());
+    undoStack.pop_back();
+
+    if (!apply(command, true)) {
+        return false;  // El tablero ya no existe: el paso se descarta
+    }
+
+    redoStack.push_back(move(command));
+    if (redoStack.size() > maxDepth) {
+        redoStack.pop_front();
+    }
+    return true;
+}
+
+bool UndoManager::redo() {
+    if (redoStack.empty()) return false;
+
+    UndoCommand command = move(redoStack.back());
+    redoStack.pop_back();
+
+    if (!apply(command, false)) {
+        return false;
+    }
+
+    // Un paso rehecho no debe fusionarse con la siguiente edición
+    command.when -= coalesceWindow + chrono::milliseconds(1);
+    undoStack.push_back(move(command));
+    if (undoStack.size() > maxDepth) {
+        undoStack.pop_front();
+    }
+    return true;
+}
+
+bool UndoManager::canUndo() const {
+    return !undoStack.empty();
+}
+
+bool UndoManager::canRedo() const {
+    return !redoStack.empty();
+}
+
+string UndoManager::getUndoDescription() const {
+    return undoStack.empty() ? "" : undoStack.back().getDescription();
+}
+
+string UndoManager::getRedoDescription() const {
+    return redoStack.empty() ? "" : redoStack.back().getDescription();
+}
+
+// Métodos de utilidad
+size_t UndoManager::getUndoCount() const {
+    return undoStack.size();
+}
+
+size_t UndoManager::getRedoCount() const {
+    return redoStack.size();
+}
+
+void UndoManager::clear() {
+    undoStack.clear();
+    redoStack.clear();
+    openGroup.clear();
+    groupDepth = 0;
+}
@@ -0,0 +1,109 @@
+#include "managers/WorkloadManager.h"
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+int countPendingSubtasks(const Task& task) {
+    const auto& index = task.getSubtaskIndex();
+    return index.getTotalCount() - index.getCompletedCount();
+}
+
+} // namespace
+
+// Constructor
+WorkloadManager::WorkloadManager(const string& doneState)
+    : doneState(doneState) {}
+
+// Destructor
+WorkloadManager::~WorkloadManager() {}
+
+double WorkloadManager::getTaskWeight(const Task& task) {
+    return task.getPriority() + countPendingSubtasks(task);
+}
+
+WorkloadReport WorkloadManager::buildReport(shared_ptr<Project> project,
+                                            bool includeSuggestions) const {
+    WorkloadReport report;
+    report.unassignedTasks = 0;
+
+    if (!project) {
+        return report;
+    }
+
+    // Índice por usuario
+    auto users = project->getAllUsers();
+    unordered_map<int, size_t> indexByUser;
+    indexByUser.reserve(users.size());
+    report.users.reserve(users.size());
+
+    for (const auto& user : users) {
+        indexByUser[user->getId()] = report.users.size();
+        report.users.push_back({user->getId(), 0, 0, 0.0});
+    }
+
+    // Una sola pasada por todas las tareas abiertas
+    vector<AssignmentSuggestion> unassigned;
+
+    for (const auto& board : project->getBoards()) {
+        int boardId = board->getId();
+
+        board->forEachTask([&](const Task& task) {
+            if (task.getState() == doneState) {
+                return;
+            }
+
+            auto it = indexByUser.find(task.getAssignedUserId());
+            if (it == indexByUser.end()) {
+                // Sin asignar o asignada a un usuario que ya no existe
+                report.unassignedTasks++;
+                if (includeSuggestions) {
+                    unassigned.push_back({boardId, task.getId(), -1, getTaskWeight(task)});
+                }
+                return;
+            }
+
+            int pending = countPendingSubtasks(task);
+            UserWorkload& workload = report.users[it->second];
+            workload.openTasks++;
+            workload.pendingSubtasks += pending;
+            workload.load += task.getPriority() + pending;
+        });
+    }
+
+    if (!includeSuggestions || unassigned.empty() || report.users.empty()) {
+        return report;
+    }
+
+    // LPT: tareas más pesadas primero, cada una al usuario con menos carga
+    stable_sort(unassigned.begin(), unassigned.end(),
+        [](const AssignmentSuggestion& a, const AssignmentSuggestion& b) {
+            return a.weight > b.weight;
+        });
+
+    using LoadEntry = pair<double, size_t>;  // (carga, índice de usuario)
+    vector<LoadEntry> initial;
+    initial.reserve(report.users.size());
+    for (size_t i = 0; i < report.users.size(); ++i) {
+        initial.emplace_back(report.users[i].load, i);
+    }
+    priority_queue<LoadEntry, vector<LoadEntry>, greater<LoadEntry>> leastLoaded(
+        greater<LoadEntry>(), move(initial));
+
+    report.suggestions.reserve(unassigned.size());
+    for (auto& suggestion : unassigned) {
+        LoadEntry entry = leastLoaded.top();
+        leastLoaded.pop();
+
+        suggestion.userId = report.users[entry.second].userId;
+        report.suggestions.push_back(suggestion);
+
+        entry.first += suggestion.weight;
+        leastLoaded.push(entry);
+    }
+
+    return report;
+}
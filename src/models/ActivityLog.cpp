@@ -1,119 +1,264 @@
 #include "models/ActivityLog.h"
+#include "utils/StringPool.h"
 #include <sstream>
 #include <iomanip>
 #include <ctime>
 #include <algorithm>
+#include <fstream>
+#include <mutex>
 
 using namespace std;
 
+namespace {
+
+// Entradas desalojadas que se acumulan antes de escribir al archivo
+const size_t ARCHIVE_BATCH_SIZE = 64;
+
+// Escapa el separador para que cada entrada ocupe una sola línea
+string escapeField(const string& value) {
+    string result;
+    result.reserve(value.size());
+    for (char c : value) {
+        switch (c) {
+            case '\\': result += "\\\\"; break;
+            case '|': result += "\\p"; break;
+            case '\n': result += "\\n"; break;
+            default: result += c; break;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
 // ActivityEntry
-ActivityEntry::ActivityEntry(const string& userName, const string& actionType,
+ActivityEntry::ActivityEntry(const string& userName, Action action,
                              const string& fieldModified,
                              const string& oldValue,
-                             const string& newValue,
-                             const string& description)
-    : userName(userName), actionType(actionType), fieldModified(fieldModified),
-      oldValue(oldValue), newValue(newValue), description(description),
-      timestamp(chrono::system_clock::now()) {}
+                             const string& newValue)
+    : timestampTicks(chrono::system_clock::now().time_since_epoch().count()),
+      userId(StringPool::getInstance().intern(userName)),
+      fieldId(StringPool::getInstance().intern(fieldModified)),
+      oldValue(oldValue), newValue(newValue), action(action) {}
+
+ActivityEntry::ActivityEntry(const chrono::system_clock::time_point& timestamp,
+                             uint32_t userId, uint32_t fieldId, Action action,
+                             const CompactString& oldValue, const CompactString& newValue)
+    : timestampTicks(timestamp.time_since_epoch().count()),
+      userId(userId), fieldId(fieldId),
+      oldValue(oldValue), newValue(newValue), action(action) {}
+
+// Getters
+chrono::system_clock::time_point ActivityEntry::getTimestamp() const {
+    return chrono::system_clock::time_point(chrono::system_clock::duration(timestampTicks));
+}
+
+const string& ActivityEntry::getUserName() const {
+    return StringPool::getInstance().lookup(userId);
+}
+
+const string& ActivityEntry::getFieldModified() const {
+    return StringPool::getInstance().lookup(fieldId);
+}
+
+string ActivityEntry::getOldValue() const {
+    return oldValue.str();
+}
+
+string ActivityEntry::getNewValue() const {
+    return newValue.str();
+}
+
+string ActivityEntry::getActionType() const {
+    return actionToString(action);
+}
+
+string ActivityEntry::getDescription() const {
+    switch (action) {
+        case Action::CREATED:  return "Creó " + newValue.str();
+        case Action::MOVED:    return "Movió de " + oldValue.str() + " a " + newValue.str();
+        case Action::UPDATED:  return "Actualizó " + getFieldModified();
+        case Action::ASSIGNED: return "Asignó a " + newValue.str();
+        case Action::DELETED:  return "Eliminó la tarea";
+        case Action::RESTORED: return "Restauró versión anterior";
+    }
+    return "";
+}
 
 string ActivityEntry::toString() const {
     stringstream ss;
     
     // Convertir timestamp a string
-    time_t time = chrono::system_clock::to_time_t(timestamp);
+    time_t time = chrono::system_clock::to_time_t(getTimestamp());
     ss << "[" << put_time(localtime(&time), "%Y-%m-%d %H:%M:%S") << "] ";
-    ss << userName << " - " << actionType;
+    ss << getUserName() << " - " << getActionType();
     
+    const string& fieldModified = getFieldModified();
     if (!fieldModified.empty()) {
         ss << " (" << fieldModified;
         if (!oldValue.empty() || !newValue.empty()) {
             ss << ": ";
             if (!oldValue.empty()) {
-                ss << "'" << oldValue << "'";
+                ss << "'" << oldValue.view() << "'";
             }
             if (!newValue.empty()) {
-                ss << " → '" << newValue << "'";
+                ss << " → '" << newValue.view() << "'";
             }
         }
         ss << ")";
     }
     
-    if (!description.empty()) {
-        ss << " - " << description;
-    }
+    ss << " - " << getDescription();
     
     return ss.str();
 }
 
+string ActivityEntry::actionToString(Action action) {
+    switch (action) {
+        case Action::CREATED:  return "created";
+        case Action::MOVED:    return "moved";
+        case Action::UPDATED:  return "updated";
+        case Action::ASSIGNED: return "assigned";
+        case Action::DELETED:  return "deleted";
+        case Action::RESTORED: return "restored";
+    }
+    return "";
+}
+
+bool ActivityEntry::actionFromString(const string& value, Action& action) {
+    static const pair<const char*, Action> names[] = {
+        {"created", Action::CREATED},
+        {"moved", Action::MOVED},
+        {"updated", Action::UPDATED},
+        {"assigned", Action::ASSIGNED},
+        {"deleted", Action::DELETED},
+        {"restored", Action::RESTORED}
+    };
+    
+    for (const auto& name : names) {
+        if (value == name.first) {
+            action = name.second;
+            return true;
+        }
+    }
+    return false;
+}
+
 // ActivityLog
 
 // Constructor
-ActivityLog::ActivityLog(int maxEntries) : maxEntries(maxEntries) {}
+ActivityLog::ActivityLog(int maxEntries)
+    : entries(static_cast<size_t>(max(0, maxEntries))), maxEntries(maxEntries),
+      sortedByTime(true), archivedCount(0) {}
 
 // Destructor
-ActivityLog::~ActivityLog() {}
+ActivityLog::~ActivityLog() {
+    flushArchive();
+}
 
 // Agregar entradas
 void ActivityLog::addEntry(const ActivityEntry& entry) {
-    entries.push_back(entry);
+    unique_lock<shared_mutex> lock(mutex);
+    
+    if (!entries.empty() && entry.timestampTicks < entries.back().timestampTicks) {
+        sortedByTime = false;
+    }
+    
+    // Sin capacidad no se guarda nada en memoria: va directo al archivo
+    if (entries.getCapacity() == 0) {
+        if (!archivePath.empty()) {
+            spill(entry);
+        }
+        return;
+    }
+    
+    // Al estar lleno, la más antigua se sobrescribe; archivarla antes
+    if (entries.full() && !archivePath.empty()) {
+        spill(entries.front());
+    }
+    
+    entries.push(entry);
+}
+
+void ActivityLog::spill(const ActivityEntry& entry) {
+    pendingArchive.push_back(entry);
     
-    // Mantener el límite de entradas
-    if (entries.size() > static_cast<size_t>(maxEntries)) {
-        entries.erase(entries.begin());
+    if (pendingArchive.size() >= ARCHIVE_BATCH_SIZE) {
+        writePendingArchive();
     }
 }
 
 void ActivityLog::logCreation(const string& userName, const string& objectName) {
-    ActivityEntry entry(userName, "created", "", "", "", 
-                        "Creó " + objectName);
+    ActivityEntry entry(userName, ActivityEntry::Action::CREATED, "", "", objectName);
     addEntry(entry);
 }
 
 void ActivityLog::logMove(const string& userName, const string& fromState, 
                          const string& toState) {
-    ActivityEntry entry(userName, "moved", "estado", fromState, toState,
-                        "Movió de " + fromState + " a " + toState);
+    ActivityEntry entry(userName, ActivityEntry::Action::MOVED, "estado", fromState, toState);
     addEntry(entry);
 }
 
 void ActivityLog::logUpdate(const string& userName, const string& field,
                            const string& oldValue, const string& newValue) {
-    ActivityEntry entry(userName, "updated", field, oldValue, newValue,
-                        "Actualizó " + field);
+    ActivityEntry entry(userName, ActivityEntry::Action::UPDATED, field, oldValue, newValue);
     addEntry(entry);
 }
 
 void ActivityLog::logAssignment(const string& userName, const string& assignedTo) {
-    ActivityEntry entry(userName, "assigned", "asignado a", "", assignedTo,
-                        "Asignó a " + assignedTo);
+    ActivityEntry entry(userName, ActivityEntry::Action::ASSIGNED, "asignado a", "", assignedTo);
     addEntry(entry);
 }
 
 void ActivityLog::logDeletion(const string& userName) {
-    ActivityEntry entry(userName, "deleted", "", "", "",
-                        "Eliminó la tarea");
+    ActivityEntry entry(userName, ActivityEntry::Action::DELETED);
     addEntry(entry);
 }
 
 // Consultas
-const vector<ActivityEntry>& ActivityLog::getEntries() const {
-    return entries;
+vector<ActivityEntry> ActivityLog::getEntries() const {
+    shared_lock<shared_mutex> lock(mutex);
+    return vector<ActivityEntry>(entries.begin(), entries.end());
+}
+
+void ActivityLog::forEachEntry(const function<void(const ActivityEntry&)>& visitor) const {
+    shared_lock<shared_mutex> lock(mutex);
+    for (const auto& entry : entries) {
+        visitor(entry);
+    }
 }
 
 vector<ActivityEntry> ActivityLog::getEntriesByUser(const string& userName) const {
     vector<ActivityEntry> result;
+    
+    // Un nombre nunca internado no puede aparecer en ninguna entrada
+    uint32_t userId;
+    if (!StringPool::getInstance().find(userName, userId)) {
+        return result;
+    }
+    
+    shared_lock<shared_mutex> lock(mutex);
     copy_if(entries.begin(), entries.end(), back_inserter(result),
-        [&userName](const ActivityEntry& entry) {
-            return entry.userName == userName;
+        [userId](const ActivityEntry& entry) {
+            return entry.userId == userId;
         });
     return result;
 }
 
 vector<ActivityEntry> ActivityLog::getEntriesByActionType(const string& actionType) const {
+    ActivityEntry::Action action;
+    if (!ActivityEntry::actionFromString(actionType, action)) {
+        return vector<ActivityEntry>();
+    }
+    return getEntriesByActionType(action);
+}
+
+vector<ActivityEntry> ActivityLog::getEntriesByActionType(ActivityEntry::Action action) const {
     vector<ActivityEntry> result;
+    shared_lock<shared_mutex> lock(mutex);
     copy_if(entries.begin(), entries.end(), back_inserter(result),
-        [&actionType](const ActivityEntry& entry) {
-            return entry.actionType == actionType;
+        [action](const ActivityEntry& entry) {
+            return entry.action == action;
         });
     return result;
 }
@@ -122,23 +267,145 @@ vector<ActivityEntry> ActivityLog::getEntriesByDateRange(
     const chrono::system_clock::time_point& start,
     const chrono::system_clock::time_point& end) const {
     vector<ActivityEntry> result;
-    copy_if(entries.begin(), entries.end(), back_inserter(result),
-        [&start, &end](const ActivityEntry& entry) {
-            return entry.timestamp >= start && entry.timestamp <= end;
-        });
+    forEachInDateRange(start, end, [&result](const ActivityEntry& entry) {
+        result.push_back(entry);
+    });
+    return result;
+}
+
+vector<StateTransition> ActivityLog::getStateTransitions() const {
+    vector<StateTransition> result;
+    shared_lock<shared_mutex> lock(mutex);
+    for (const auto& entry : entries) {
+        if (entry.action == ActivityEntry::Action::MOVED) {
+            result.push_back({entry.getTimestamp(), entry.getOldValue(), entry.getNewValue()});
+        }
+    }
     return result;
 }
 
+// Rangos de fecha
+ActivityLog::EntryRange ActivityLog::findDateRange(int64_t startTicks, int64_t endTicks) const {
+    if (!sortedByTime) {
+        // Sin orden garantizado no hay un rango contiguo que devolver
+        return EntryRange(entries.end(), entries.end());
+    }
+    
+    auto first = lower_bound(entries.begin(), entries.end(), startTicks,
+        [](const ActivityEntry& entry, int64_t ticks) { return entry.timestampTicks < ticks; });
+    auto last = upper_bound(first, entries.end(), endTicks,
+        [](int64_t ticks, const ActivityEntry& entry) { return ticks < entry.timestampTicks; });
+    return EntryRange(first, last);
+}
+
+size_t ActivityLog::countByDateRange(const chrono::system_clock::time_point& start,
+                                     const chrono::system_clock::time_point& end) const {
+    int64_t startTicks = start.time_since_epoch().count();
+    int64_t endTicks = end.time_since_epoch().count();
+    
+    shared_lock<shared_mutex> lock(mutex);
+    if (sortedByTime) {
+        auto range = findDateRange(startTicks, endTicks);
+        return static_cast<size_t>(range.second - range.first);
+    }
+    
+    return static_cast<size_t>(count_if(entries.begin(), entries.end(),
+        [startTicks, endTicks](const ActivityEntry& entry) {
+            return entry.timestampTicks >= startTicks && entry.timestampTicks <= endTicks;
+        }));
+}
+
+void ActivityLog::forEachInDateRange(const chrono::system_clock::time_point& start,
+                                     const chrono::system_clock::time_point& end,
+                                     const function<void(const ActivityEntry&)>& visitor) const {
+    int64_t startTicks = start.time_since_epoch().count();
+    int64_t endTicks = end.time_since_epoch().count();
+    
+    // El visitante corre con el lock compartido: no debe agregar entradas
+    shared_lock<shared_mutex> lock(mutex);
+    if (sortedByTime) {
+        auto range = findDateRange(startTicks, endTicks);
+        for (auto it = range.first; it != range.second; ++it) {
+            visitor(*it);
+        }
+        return;
+    }
+    
+    for (const auto& entry : entries) {
+        if (entry.timestampTicks >= startTicks && entry.timestampTicks <= endTicks) {
+            visitor(entry);
+        }
+    }
+}
+
+bool ActivityLog::isSortedByTime() const {
+    shared_lock<shared_mutex> lock(mutex);
+    return sortedByTime;
+}
+
+// Archivo en disco de entradas desalojadas
+void ActivityLog::setArchivePath(const string& path) {
+    unique_lock<shared_mutex> lock(mutex);
+    writePendingArchive();
+    archivePath = path;
+}
+
+string ActivityLog::getArchivePath() const {
+    shared_lock<shared_mutex> lock(mutex);
+    return archivePath;
+}
+
+bool ActivityLog::flushArchive() {
+    unique_lock<shared_mutex> lock(mutex);
+    return writePendingArchive();
+}
+
+bool ActivityLog::writePendingArchive() {
+    if (pendingArchive.empty() || archivePath.empty()) {
+        return true;
+    }
+    
+    ofstream file(archivePath, ios::app);
+    if (!file.is_open()) {
+        return false;  // Se reintenta en el siguiente lote
+    }
+    
+    for (const auto& entry : pendingArchive) {
+        auto millis = chrono::duration_cast<chrono::milliseconds>(
+            entry.getTimestamp().time_since_epoch()).count();
+        file << "ENTRY|" << millis << "|"
+             << escapeField(entry.getUserName()) << "|"
+             << entry.getActionType() << "|"
+             << escapeField(entry.getFieldModified()) << "|"
+             << escapeField(entry.getOldValue()) << "|"
+             << escapeField(entry.getNewValue()) << "|"
+             << escapeField(entry.getDescription()) << "\n";
+    }
+    
+    archivedCount += pendingArchive.size();
+    pendingArchive.clear();
+    return true;
+}
+
+size_t ActivityLog::getArchivedCount() const {
+    shared_lock<shared_mutex> lock(mutex);
+    return archivedCount + pendingArchive.size();
+}
+
 // Métodos de utilidad
 void ActivityLog::clear() {
+    unique_lock<shared_mutex> lock(mutex);
     entries.clear();
+    sortedByTime = true;
 }
 
 size_t ActivityLog::getSize() const {
+    shared_lock<shared_mutex> lock(mutex);
     return entries.size();
 }
 
 string ActivityLog::toString() const {
+    shared_lock<shared_mutex> lock(mutex);
     stringstream ss;
     ss << "Activity Log (" << entries.size() << " entradas):\n";
     ss << "----------------------------------------\n";
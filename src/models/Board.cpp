@@ -6,7 +6,9 @@ using namespace std;
 
 // Constructores
 Board::Board() 
-    : id(-1), name(""), description(""), nextTaskId(1) {
+    : id(-1), name(""), description(""), nextTaskId(1),
+      eventBus(make_shared<EventBus>()),
+      memoryPool(make_shared<SlabPoolResource>()) {
     // Estados predeterminados
     states = {"Pendiente", "En Progreso", "Terminado"};
     
@@ -17,7 +19,9 @@ Board::Board()
 }
 
 Board::Board(int id, const string& name, const string& description)
-    : id(id), name(name), description(description), nextTaskId(1) {
+    : id(id), name(name), description(description), nextTaskId(1),
+      eventBus(make_shared<EventBus>()),
+      memoryPool(make_shared<SlabPoolResource>()) {
     // Estados predeterminados
     states = {"Pendiente", "En Progreso", "Terminado"};
     
@@ -47,6 +51,18 @@ const vector<string>& Board::getStates() const {
     return states;
 }
 
+shared_ptr<EventStore> Board::getEventStore() const {
+    return eventStore;
+}
+
+shared_ptr<pmr::memory_resource> Board::getMemoryPool() const {
+    return memoryPool;
+}
+
+shared_ptr<EventBus> Board::getEventBus() const {
+    return eventBus;
+}
+
 // Setters
 void Board::setName(const string& name) {
     this->name = name;
@@ -56,6 +72,25 @@ void Board::setDescription(const string& description) {
     this->description = description;
 }
 
+void Board::setEventStore(shared_ptr<EventStore> store) {
+    eventStore = store;
+    
+    if (eventStore) {
+        for (const auto& pair : tasksById) {
+            pair.second->bindEventStore(eventStore, id);
+        }
+    }
+}
+
+void Board::setEventBus(shared_ptr<EventBus> bus) {
+    if (!bus || bus == eventBus) return;
+    
+    eventBus = bus;
+    for (const auto& pair : tasksById) {
+        pair.second->bindEventBus(eventBus, id);
+    }
+}
+
 // Gestión de estados
 void Board::addState(const string& state) {
     if (!hasState(state)) {
@@ -87,10 +122,23 @@ bool Board::hasState(const string& state) const {
 }
 
 // Gestión de tareas
+shared_ptr<Task> Board::allocateTask(int id, const string& title,
+                                     const string& description) {
+    // Bloque de control y tarea en una sola reserva dentro del pool
+    auto task = allocate_shared<Task>(PoolAllocator<Task>(memoryPool), id, title, description);
+    task->setMemoryPool(memoryPool);
+    return task;
+}
+
 shared_ptr<Task> Board::createTask(const string& title, 
                                          const string& description,
                                          const string& initialState) {
-    auto task = make_shared<Task>(nextTaskId++, title, description);
+    auto task = allocateTask(nextTaskId++, title, description);
+    
+    // Enlazar antes del primer cambio para no crear un registro propio
+    if (eventStore) {
+        task->bindEventStore(eventStore, id);
+    }
     
     // Verificar que el estado inicial existe
     string state = hasState(initialState) ? initialState : states[0];
@@ -103,8 +151,15 @@ shared_ptr<Task> Board::createTask(const string& title,
 
 void Board::addTask(shared_ptr<Task> task, const string& state) {
     if (task && hasState(state)) {
+        if (eventStore) {
+            task->bindEventStore(eventStore, id);
+        }
         tasksByState[state].push_back(task);
         tasksById[task->getId()] = task;
+        hotTable.insert(*task);
+        
+        task->bindEventBus(eventBus, id);
+        eventBus->publish(TaskCreated{id, task.get(), state});
     }
 }
 
@@ -126,6 +181,16 @@ void Board::removeTask(int taskId) {
         
         // Eliminar del mapa global
         tasksById.erase(it);
+        hotTable.remove(*task);
+        
+        eventBus->publish(TaskRemoved{id, task.get(), state});
+        task->bindEventBus(nullptr, -1);
+        
+        // La tarea conserva su flujo (deshacer la vuelve a agregar con su
+        // historia), pero un id reutilizado no lo hereda
+        if (eventStore) {
+            eventStore->releaseStream(id, taskId);
+        }
     }
 }
 
@@ -145,7 +210,20 @@ void Board::moveTask(int taskId, const string& newState, const string& movedBy)
         return;  // No se puede mover por dependencias
     }
     
+    relocateTask(taskId, newState, movedBy);
+}
+
+bool Board::relocateTask(int taskId, const string& newState, const string& movedBy,
+                         size_t position) {
+    auto task = findTaskById(taskId);
+    if (!task || !hasState(newState)) {
+        return false;
+    }
+    
     string oldState = task->getState();
+    if (oldState == newState) {
+        return true;
+    }
     
     // Eliminar de la lista del estado anterior
     auto& oldStateTasks = tasksByState[oldState];
@@ -157,11 +235,44 @@ void Board::moveTask(int taskId, const string& newState, const string& movedBy)
         oldStateTasks.end()
     );
     
+    // Agregar a la lista del nuevo estado antes de cambiar el estado, para
+    // que quien reciba TaskMoved vea el tablero ya actualizado
+    auto& newStateTasks = tasksByState[newState];
+    newStateTasks.insert(newStateTasks.begin() + min(position, newStateTasks.size()), task);
+    
     // Actualizar estado de la tarea
     task->setState(newState, movedBy);
+    return true;
+}
+
+bool Board::restoreTaskVersion(int taskId, shared_ptr<TaskMemento> memento,
+                               const string& restoredBy) {
+    auto task = findTaskById(taskId);
+    if (!task || !memento || !hasState(memento->getState())) {
+        return false;
+    }
     
-    // Agregar a la lista del nuevo estado
-    tasksByState[newState].push_back(task);
+    // Primero la columna, como cualquier movimiento; la restauración ya no
+    // encuentra cambio de estado
+    relocateTask(taskId, memento->getState(), restoredBy);
+    task->restoreFromMemento(memento);
+    return true;
+}
+
+size_t Board::getTaskPosition(int taskId) const {
+    auto task = findTaskById(taskId);
+    if (!task) {
+        return SIZE_MAX;
+    }
+    
+    auto it = tasksByState.find(task->getState());
+    if (it == tasksByState.end()) {
+        return SIZE_MAX;
+    }
+    
+    const auto& tasks = it->second;
+    auto found = find(tasks.begin(), tasks.end(), task);
+    return found != tasks.end() ? static_cast<size_t>(found - tasks.begin()) : SIZE_MAX;
 }
 
 // Búsqueda y filtrado
@@ -176,15 +287,7 @@ vector<shared_ptr<Task>> Board::getTasksByState(const string& state) const {
 }
 
 vector<shared_ptr<Task>> Board::getTasksByUser(int userId) const {
-    vector<shared_ptr<Task>> result;
-    
-    for (const auto& pair : tasksById) {
-        if (pair.second->getAssignedUserId() == userId) {
-            result.push_back(pair.second);
-        }
-    }
-    
-    return result;
+    return collectRows(hotTable.selectByAssignee(userId));
 }
 
 vector<shared_ptr<Task>> Board::getTasksByTag(const string& tag) const {
@@ -200,11 +303,31 @@ vector<shared_ptr<Task>> Board::getTasksByTag(const string& tag) const {
 }
 
 vector<shared_ptr<Task>> Board::getOverdueTasks() const {
-    vector<shared_ptr<Task>> result;
+    auto now = chrono::system_clock::now();
+    return collectRows(hotTable.selectOverdue(TaskHotTable::stateIdOf("Terminado"),
+                                              TaskHotTable::toTicks(now)));
+}
+
+vector<shared_ptr<Task>> Board::getTasksDueBetween(const chrono::system_clock::time_point& from,
+                                                   const chrono::system_clock::time_point& to) const {
+    return collectRows(hotTable.selectDueBetween(TaskHotTable::stateIdOf("Terminado"),
+                                                 TaskHotTable::toTicks(from),
+                                                 TaskHotTable::toTicks(to)));
+}
+
+// Filas de la tabla caliente a tareas, ordenadas por ID como tasksById
+vector<shared_ptr<Task>> Board::collectRows(vector<TaskHotTable::Row> rows) const {
+    const auto& taskIds = hotTable.getTaskIds();
+    sort(rows.begin(), rows.end(), [&taskIds](TaskHotTable::Row a, TaskHotTable::Row b) {
+        return taskIds[a] < taskIds[b];
+    });
     
-    for (const auto& pair : tasksById) {
-        if (pair.second->isOverdue()) {
-            result.push_back(pair.second);
+    vector<shared_ptr<Task>> result;
+    result.reserve(rows.size());
+    for (TaskHotTable::Row row : rows) {
+        auto it = tasksById.find(taskIds[row]);
+        if (it != tasksById.end() && it->second.get() == hotTable.getTask(row)) {
+            result.push_back(it->second);
         }
     }
     
@@ -221,6 +344,16 @@ vector<shared_ptr<Task>> Board::getAllTasks() const {
     return result;
 }
 
+void Board::forEachTask(const function<void(const Task&)>& visitor) const {
+    for (const auto& pair : tasksById) {
+        visitor(*pair.second);
+    }
+}
+
+const TaskHotTable& Board::getHotTable() const {
+    return hotTable;
+}
+
 // Validaciones de dependencias
 bool Board::canMoveTask(int taskId, const string& newState) const {
     auto task = findTaskById(taskId);
@@ -302,10 +435,23 @@ string Board::toString() const {
 }
 
 void Board::clearAllTasks() {
+    hotTable.clear();
+    for (const auto& pair : tasksById) {
+        pair.second->bindEventBus(nullptr, -1);
+        if (eventStore) {
+            eventStore->releaseStream(id, pair.first);
+        }
+    }
     tasksById.clear();
     for (auto& pair : tasksByState) {
         pair.second.clear();
     }
     nextTaskId = 1;
+    
+    // Pool nuevo: el anterior devuelve todos sus bloques de una vez cuando
+    // se destruye la última tarea que lo referencia
+    memoryPool = make_shared<SlabPoolResource>();
+    
+    eventBus->publish(BoardCleared{id});
 }
 
@@ -0,0 +1,78 @@
+#include "models/EventBus.h"
+
+using namespace std;
+
+// EventBus
+
+// Constructor
+EventBus::EventBus() : nextSubscriptionId(1) {
+    channels[static_cast<size_t>(ModelEventType::TASK_CREATED)] = make_unique<Channel<TaskCreated>>();
+    channels[static_cast<size_t>(ModelEventType::TASK_REMOVED)] = make_unique<Channel<TaskRemoved>>();
+    channels[static_cast<size_t>(ModelEventType::TASK_MOVED)] = make_unique<Channel<TaskMoved>>();
+    channels[static_cast<size_t>(ModelEventType::FIELD_CHANGED)] = make_unique<Channel<FieldChanged>>();
+    channels[static_cast<size_t>(ModelEventType::DEPENDENCY_ADDED)] = make_unique<Channel<DependencyAdded>>();
+    channels[static_cast<size_t>(ModelEventType::DEPENDENCY_REMOVED)] = make_unique<Channel<DependencyRemoved>>();
+    channels[static_cast<size_t>(ModelEventType::BOARD_ADDED)] = make_unique<Channel<BoardAdded>>();
+    channels[static_cast<size_t>(ModelEventType::BOARD_REMOVED)] = make_unique<Channel<BoardRemoved>>();
+    channels[static_cast<size_t>(ModelEventType::BOARD_CLEARED)] = make_unique<Channel<BoardCleared>>();
+}
+
+// Destructor
+EventBus::~EventBus() {}
+
+// Suscripción
+bool EventBus::unsubscribe(const Subscription& subscription) {
+    if (!subscription.isValid() || subscription.type == ModelEventType::COUNT) {
+        return false;
+    }
+    return channels[static_cast<size_t>(subscription.type)]->remove(subscription.id);
+}
+
+size_t EventBus::getSubscriberCount(ModelEventType type) const {
+    if (type == ModelEventType::COUNT) return 0;
+    return channels[static_cast<size_t>(type)]->getSubscriberCount();
+}
+
+// EventSubscriptions
+
+// Constructores
+EventSubscriptions::EventSubscriptions() {}
+
+EventSubscriptions::EventSubscriptions(shared_ptr<EventBus> bus) : bus(bus) {}
+
+// Destructor
+EventSubscriptions::~EventSubscriptions() {
+    reset();
+}
+
+EventSubscriptions::EventSubscriptions(EventSubscriptions&& other) noexcept
+    : bus(move(other.bus)), subscriptions(move(other.subscriptions)) {
+    other.subscriptions.clear();
+}
+
+EventSubscriptions& EventSubscriptions::operator=(EventSubscriptions&& other) noexcept {
+    if (this != &other) {
+        reset();
+        bus = move(other.bus);
+        subscriptions = move(other.subscriptions);
+        other.subscriptions.clear();
+    }
+    return *this;
+}
+
+shared_ptr<EventBus> EventSubscriptions::getBus() const {
+    return bus.lock();
+}
+
+bool EventSubscriptions::isAttachedTo(const shared_ptr<EventBus>& other) const {
+    return other && bus.lock() == other;
+}
+
+void EventSubscriptions::reset() {
+    if (auto target = bus.lock()) {
+        for (const auto& subscription : subscriptions) {
+            target->unsubscribe(subscription);
+        }
+    }
+    subscriptions.clear();
+}
@@ -0,0 +1,317 @@
+#include "models/EventStore.h"
+#include "utils/StringPool.h"
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
+using namespace std;
+
+// Constructor
+EventStore::EventStore()
+    : timeOrderDirty(false), releasedRows(0),
+      compactionMinRows(DEFAULT_COMPACTION_MIN_ROWS) {}
+
+// Destructor
+EventStore::~EventStore() {}
+
+// Flujos
+EventStore::StreamId EventStore::registerStream(int boardId, int taskId) {
+    unique_lock<shared_mutex> lock(mutex);
+
+    auto key = make_pair(boardId, taskId);
+    auto it = streamIndex.find(key);
+    if (it != streamIndex.end()) {
+        return it->second;
+    }
+
+    StreamId stream = static_cast<StreamId>(streamOwners.size());
+    streamOwners.push_back(key);
+    streamReleased.push_back(false);
+    rowsByStream.emplace_back();
+    streamIndex[key] = stream;
+    return stream;
+}
+
+void EventStore::releaseStream(int boardId, int taskId) {
+    unique_lock<shared_mutex> lock(mutex);
+    
+    auto it = streamIndex.find(make_pair(boardId, taskId));
+    if (it == streamIndex.end()) return;
+    
+    StreamId stream = it->second;
+    streamIndex.erase(it);
+    streamReleased[stream] = true;
+    releasedRows += rowsByStream[stream].size();
+    
+    // Amortizado: se compacta cuando la basura iguala a lo vivo
+    if (releasedRows >= compactionMinRows && releasedRows * 2 >= timestamps.size()) {
+        compactLocked();
+    }
+}
+
+pair<int, int> EventStore::getStreamOwner(StreamId stream) const {
+    shared_lock<shared_mutex> lock(mutex);
+    return stream < streamOwners.size() ? streamOwners[stream] : make_pair(-1, -1);
+}
+
+// Agregar eventos
+EventStore::Row EventStore::append(StreamId stream, const ActivityEntry& entry) {
+    unique_lock<shared_mutex> lock(mutex);
+
+    Row row = static_cast<Row>(timestamps.size());
+
+    // Los eventos llegan casi siempre en orden; uno anterior al último
+    // (por ejemplo, al migrar un registro existente) marca el índice
+    if (!timeOrder.empty() && entry.timestampTicks < timestamps[timeOrder.back()]) {
+        timeOrderDirty = true;
+    }
+
+    timestamps.push_back(entry.timestampTicks);
+    userIds.push_back(entry.userId);
+    fieldIds.push_back(entry.fieldId);
+    actions.push_back(static_cast<uint8_t>(entry.action));
+    streams.push_back(stream);
+    oldValues.push_back(entry.oldValue);
+    newValues.push_back(entry.newValue);
+
+    timeOrder.push_back(row);
+    rowsByUser[entry.userId].push_back(row);
+    rowsByAction[static_cast<size_t>(entry.action)].push_back(row);
+    if (stream < rowsByStream.size()) {
+        rowsByStream[stream].push_back(row);
+        if (streamReleased[stream]) {
+            releasedRows++;  // Una tarea quitada que sigue cambiando
+        }
+    }
+
+    return row;
+}
+
+// Acceso por fila
+ActivityEntry EventStore::getEntry(Row row) const {
+    shared_lock<shared_mutex> lock(mutex);
+    return ActivityEntry(chrono::system_clock::time_point(chrono::system_clock::duration(timestamps[row])),
+                         userIds[row], fieldIds[row],
+                         static_cast<ActivityEntry::Action>(actions[row]),
+                         oldValues[row], newValues[row]);
+}
+
+EventStore::StreamId EventStore::getStream(Row row) const {
+    shared_lock<shared_mutex> lock(mutex);
+    return streams[row];
+}
+
+chrono::system_clock::time_point EventStore::getTimestamp(Row row) const {
+    shared_lock<shared_mutex> lock(mutex);
+    return chrono::system_clock::time_point(chrono::system_clock::duration(timestamps[row]));
+}
+
+// Índice temporal
+void EventStore::sortTimeOrder() const {
+    {
+        shared_lock<shared_mutex> lock(mutex);
+        if (!timeOrderDirty) return;
+    }
+
+    unique_lock<shared_mutex> lock(mutex);
+    if (!timeOrderDirty) return;  // Otro hilo ya lo ordenó
+
+    stable_sort(timeOrder.begin(), timeOrder.end(),
+        [this](Row a, Row b) { return timestamps[a] < timestamps[b]; });
+    timeOrderDirty = false;
+}
+
+pair<size_t, size_t> EventStore::rangeBounds(int64_t startTicks, int64_t endTicks) const {
+    auto first = lower_bound(timeOrder.begin(), timeOrder.end(), startTicks,
+        [this](Row row, int64_t ticks) { return timestamps[row] < ticks; });
+    auto last = upper_bound(first, timeOrder.end(), endTicks,
+        [this](int64_t ticks, Row row) { return ticks < timestamps[row]; });
+    return make_pair(static_cast<size_t>(first - timeOrder.begin()),
+                     static_cast<size_t>(last - timeOrder.begin()));
+}
+
+// Consultas entre tareas
+vector<EventStore::Row> EventStore::getRowsByUser(const string& userName) const {
+    uint32_t userId;
+    if (!StringPool::getInstance().find(userName, userId)) {
+        return vector<Row>();
+    }
+
+    shared_lock<shared_mutex> lock(mutex);
+    auto it = rowsByUser.find(userId);
+    return it != rowsByUser.end() ? it->second : vector<Row>();
+}
+
+vector<EventStore::Row> EventStore::getRowsByAction(ActivityEntry::Action action) const {
+    shared_lock<shared_mutex> lock(mutex);
+    return rowsByAction[static_cast<size_t>(action)];
+}
+
+vector<EventStore::Row> EventStore::getRowsByDateRange(
+    const chrono::system_clock::time_point& start,
+    const chrono::system_clock::time_point& end) const {
+    sortTimeOrder();
+
+    shared_lock<shared_mutex> lock(mutex);
+    auto bounds = rangeBounds(start.time_since_epoch().count(), end.time_since_epoch().count());
+    return vector<Row>(timeOrder.begin() + bounds.first, timeOrder.begin() + bounds.second);
+}
+
+size_t EventStore::countByDateRange(const chrono::system_clock::time_point& start,
+                                    const chrono::system_clock::time_point& end) const {
+    sortTimeOrder();
+
+    shared_lock<shared_mutex> lock(mutex);
+    auto bounds = rangeBounds(start.time_since_epoch().count(), end.time_since_epoch().count());
+    return bounds.second - bounds.first;
+}
+
+vector<ActivityEntry> EventStore::getEntries(const vector<Row>& rows) const {
+    vector<ActivityEntry> result;
+    result.reserve(rows.size());
+    for (Row row : rows) {
+        result.push_back(getEntry(row));
+    }
+    return result;
+}
+
+// Vista por tarea
+size_t EventStore::getStreamSize(StreamId stream) const {
+    shared_lock<shared_mutex> lock(mutex);
+    return stream < rowsByStream.size() ? rowsByStream[stream].size() : 0;
+}
+
+vector<ActivityEntry> EventStore::getStreamEntries(StreamId stream) const {
+    vector<Row> rows;
+    {
+        shared_lock<shared_mutex> lock(mutex);
+        if (stream < rowsByStream.size()) {
+            rows = rowsByStream[stream];
+        }
+    }
+    return getEntries(rows);
+}
+
+vector<StateTransition> EventStore::getStreamTransitions(StreamId stream) const {
+    vector<StateTransition> result;
+
+    shared_lock<shared_mutex> lock(mutex);
+    if (stream >= rowsByStream.size()) {
+        return result;
+    }
+
+    const uint8_t moved = static_cast<uint8_t>(ActivityEntry::Action::MOVED);
+    for (Row row : rowsByStream[stream]) {
+        if (actions[row] == moved) {
+            result.push_back({chrono::system_clock::time_point(chrono::system_clock::duration(timestamps[row])),
+                              oldValues[row].str(), newValues[row].str()});
+        }
+    }
+    return result;
+}
+
+// Retención
+size_t EventStore::compact() {
+    unique_lock<shared_mutex> lock(mutex);
+    size_t before = timestamps.size();
+    compactLocked();
+    return before - timestamps.size();
+}
+
+void EventStore::setCompactionMinRows(size_t rows) {
+    unique_lock<shared_mutex> lock(mutex);
+    compactionMinRows = rows;
+}
+
+size_t EventStore::getReleasedRowCount() const {
+    shared_lock<shared_mutex> lock(mutex);
+    return releasedRows;
+}
+
+void EventStore::compactLocked() {
+    if (releasedRows == 0) return;
+
+    // Nueva posición de cada fila que queda; las descartadas no tienen
+    const Row DROPPED = numeric_limits<Row>::max();
+    vector<Row> newIndex(timestamps.size(), DROPPED);
+    Row kept = 0;
+    for (Row row = 0; row < timestamps.size(); ++row) {
+        if (streamReleased[streams[row]]) continue;
+
+        newIndex[row] = kept;
+        timestamps[kept] = timestamps[row];
+        userIds[kept] = userIds[row];
+        fieldIds[kept] = fieldIds[row];
+        actions[kept] = actions[row];
+        streams[kept] = streams[row];
+        oldValues[kept] = move(oldValues[row]);
+        newValues[kept] = move(newValues[row]);
+        ++kept;
+    }
+
+    timestamps.resize(kept);
+    userIds.resize(kept);
+    fieldIds.resize(kept);
+    actions.resize(kept);
+    streams.resize(kept);
+    oldValues.resize(kept);
+    newValues.resize(kept);
+
+    // Los índices conservan su orden; solo cambian los números de fila
+    remapRows(timeOrder, newIndex);
+    for (auto it = rowsByUser.begin(); it != rowsByUser.end();) {
+        remapRows(it->second, newIndex);
+        it = it->second.empty() ? rowsByUser.erase(it) : next(it);
+    }
+    for (auto& rows : rowsByAction) {
+        remapRows(rows, newIndex);
+    }
+    for (StreamId stream = 0; stream < rowsByStream.size(); ++stream) {
+        if (streamReleased[stream]) {
+            vector<Row>().swap(rowsByStream[stream]);
+        } else {
+            remapRows(rowsByStream[stream], newIndex);
+        }
+    }
+
+    releasedRows = 0;
+}
+
+void EventStore::remapRows(vector<Row>& rows, const vector<Row>& newIndex) {
+    size_t kept = 0;
+    for (Row row : rows) {
+        if (newIndex[row] != numeric_limits<Row>::max()) {
+            rows[kept++] = newIndex[row];
+        }
+    }
+    rows.resize(kept);
+}
+
+// Métodos de utilidad
+size_t EventStore::getSize() const {
+    shared_lock<shared_mutex> lock(mutex);
+    return timestamps.size();
+}
+
+void EventStore::clear() {
+    unique_lock<shared_mutex> lock(mutex);
+
+    timestamps.clear();
+    userIds.clear();
+    fieldIds.clear();
+    actions.clear();
+    streams.clear();
+    oldValues.clear();
+    newValues.clear();
+
+    timeOrder.clear();
+    timeOrderDirty = false;
+    rowsByUser.clear();
+    for (auto& rows : rowsByAction) {
+        rows.clear();
+    }
+    for (auto& rows : rowsByStream) {
+        rows.clear();
+    }
+    releasedRows = 0;
+}
@@ -8,11 +8,15 @@ using namespace std;
 Project::Project()
     : id(-1), name(""), description(""), 
       createdDate(chrono::system_clock::now()),
+      eventStore(make_shared<EventStore>()),
+      eventBus(make_shared<EventBus>()),
       nextBoardId(1), nextUserId(1) {}
 
 Project::Project(int id, const string& name, const string& description)
     : id(id), name(name), description(description),
       createdDate(chrono::system_clock::now()),
+      eventStore(make_shared<EventStore>()),
+      eventBus(make_shared<EventBus>()),
       nextBoardId(1), nextUserId(1) {}
 
 // Destructor
@@ -39,6 +43,14 @@ const vector<shared_ptr<Board>>& Project::getBoards() const {
     return boards;
 }
 
+shared_ptr<EventStore> Project::getEventStore() const {
+    return eventStore;
+}
+
+shared_ptr<EventBus> Project::getEventBus() const {
+    return eventBus;
+}
+
 // Setters
 void Project::setName(const string& name) {
     this->name = name;
@@ -52,17 +64,24 @@ void Project::setDescription(const string& description) {
 shared_ptr<Board> Project::createBoard(const string& name, 
                                              const string& description) {
     auto board = make_shared<Board>(nextBoardId++, name, description);
+    board->setEventStore(eventStore);
+    board->setEventBus(eventBus);
     boards.push_back(board);
+    eventBus->publish(BoardAdded{board.get()});
     return board;
 }
 
 void Project::addBoard(shared_ptr<Board> board) {
     if (board) {
+        board->setEventStore(eventStore);
+        board->setEventBus(eventBus);
         boards.push_back(board);
+        eventBus->publish(BoardAdded{board.get()});
     }
 }
 
 void Project::removeBoard(int boardId) {
+    auto previousCount = boards.size();
     boards.erase(
         remove_if(boards.begin(), boards.end(),
             [boardId](const shared_ptr<Board>& b) {
@@ -70,6 +89,10 @@ void Project::removeBoard(int boardId) {
             }),
         boards.end()
     );
+    
+    if (boards.size() != previousCount) {
+        eventBus->publish(BoardRemoved{boardId});
+    }
 }
 
 shared_ptr<Board> Project::findBoardById(int id) const {
@@ -204,8 +227,12 @@ string Project::toString() const {
 }
 
 void Project::clearAllData() {
+    for (const auto& board : boards) {
+        eventBus->publish(BoardRemoved{board->getId()});
+    }
     boards.clear();
     users.clear();
+    eventStore = make_shared<EventStore>();
     nextBoardId = 1;
     nextUserId = 1;
 }
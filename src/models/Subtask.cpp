@@ -1,17 +1,48 @@
 #include "models/Subtask.h"
+#include "models/SubtaskIndex.h"
 #include <sstream>
 #include <algorithm>
 
 using namespace std;
 
 // Constructores
-Subtask::Subtask() : id(-1), title(""), description(""), completed(false) {}
+Subtask::Subtask()
+    : id(-1), title(""), description(""), completed(false),
+      parent(nullptr), owner(nullptr), ownerIndex(-1),
+      subtreeTotal(1), subtreeCompleted(0) {}
 
 Subtask::Subtask(int id, const string& title, const string& description)
-    : id(id), title(title), description(description), completed(false) {}
+    : id(id), title(title), description(description), completed(false),
+      parent(nullptr), owner(nullptr), ownerIndex(-1),
+      subtreeTotal(1), subtreeCompleted(0) {}
 
 // Destructor
-Subtask::~Subtask() {}
+Subtask::~Subtask() {
+    // Liberar el subárbol con una pila propia: dejar que cada shared_ptr
+    // destruya a sus hijos recursivamente desborda la pila en árboles profundos
+    vector<shared_ptr<Subtask>> pending;
+    
+    auto detachChildren = [&pending](Subtask& node) {
+        for (auto& child : node.childSubtasks) {
+            if (child->parent == &node) {
+                child->parent = nullptr;
+            }
+            pending.push_back(move(child));
+        }
+        node.childSubtasks.clear();
+    };
+    
+    detachChildren(*this);
+    while (!pending.empty()) {
+        shared_ptr<Subtask> node = move(pending.back());
+        pending.pop_back();
+        
+        // Solo se desarma si este era el último dueño
+        if (node.use_count() == 1) {
+            detachChildren(*node);
+        }
+    }
+}
 
 // Getters
 int Subtask::getId() const {
@@ -34,6 +65,10 @@ const vector<shared_ptr<Subtask>>& Subtask::getChildSubtasks() const {
     return childSubtasks;
 }
 
+Subtask* Subtask::getParent() const {
+    return parent;
+}
+
 // Setters
 void Subtask::setTitle(const string& title) {
     this->title = title;
@@ -44,62 +79,208 @@ void Subtask::setDescription(const string& description) {
 }
 
 void Subtask::setCompleted(bool completed) {
+    if (this->completed == completed) return;
+    
     this->completed = completed;
+    propagateCounts(0, completed ? 1 : -1);
+    
+    if (owner) {
+        owner->adjustCompleted(completed ? 1 : -1);
+    }
+}
+
+void Subtask::propagateCounts(int totalDelta, int completedDelta) {
+    for (Subtask* node = this; node; node = node->parent) {
+        node->subtreeTotal += totalDelta;
+        node->subtreeCompleted += completedDelta;
+    }
 }
 
 // Gestión de subtareas anidadas
 void Subtask::addChildSubtask(shared_ptr<Subtask> subtask) {
-    if (subtask) {
-        childSubtasks.push_back(subtask);
+    if (!subtask || subtask.get() == this || subtask->parent) {
+        return;  // Ya cuelga de otro nodo: hay que quitarlo de ahí primero
+    }
+    
+    subtask->parent = this;
+    childSubtasks.push_back(subtask);
+    propagateCounts(subtask->subtreeTotal, subtask->subtreeCompleted);
+    
+    if (owner) {
+        owner->registerSubtree(subtask, ownerIndex);
     }
 }
 
 void Subtask::removeChildSubtask(int subtaskId) {
-    childSubtasks.erase(
-        remove_if(childSubtasks.begin(), childSubtasks.end(),
-            [subtaskId](const shared_ptr<Subtask>& st) {
-                return st->getId() == subtaskId;
-            }),
-        childSubtasks.end()
-    );
+    auto it = remove_if(childSubtasks.begin(), childSubtasks.end(),
+        [subtaskId](const shared_ptr<Subtask>& st) {
+            return st->getId() == subtaskId;
+        });
+    
+    for (auto removed = it; removed != childSubtasks.end(); ++removed) {
+        Subtask* child = removed->get();
+        propagateCounts(-child->subtreeTotal, -child->subtreeCompleted);
+        if (owner) {
+            owner->unregisterSubtree(child);
+        }
+        child->parent = nullptr;
+    }
+    
+    childSubtasks.erase(it, childSubtasks.end());
 }
 
 shared_ptr<Subtask> Subtask::findSubtaskById(int id) {
-    if (this->id == id) {
-        // Intentar obtener shared_ptr si existe, sino retornar nullptr
-        // porque esta función se llama desde objetos que ya son shared_ptr
-        try {
-            return shared_from_this();
-        } catch (...) {
-            return nullptr;
+    // Con índice: búsqueda directa y verificar que esté en este subárbol
+    if (owner) {
+        auto found = owner->find(id);
+        for (Subtask* node = found.get(); node; node = node->parent) {
+            if (node == this) {
+                return found;
+            }
         }
+        return nullptr;
+    }
+    
+    if (this->id == id) {
+        // Vacío si el nodo no está administrado por un shared_ptr
+        return weak_from_this().lock();
     }
     
-    for (auto& child : childSubtasks) {
-        auto found = child->findSubtaskById(id);
-        if (found) {
-            return found;
+    // Preorden con pila explícita
+    vector<const shared_ptr<Subtask>*> pending;
+    for (auto it = childSubtasks.rbegin(); it != childSubtasks.rend(); ++it) {
+        pending.push_back(&*it);
+    }
+    
+    while (!pending.empty()) {
+        const shared_ptr<Subtask>& node = *pending.back();
+        pending.pop_back();
+        
+        if (node->id == id) {
+            return node;
+        }
+        for (auto it = node->childSubtasks.rbegin(); it != node->childSubtasks.rend(); ++it) {
+            pending.push_back(&*it);
         }
     }
     
     return nullptr;
 }
 
+// Recorridos
+Subtask::PreOrderIterator::PreOrderIterator(Subtask* root) {
+    if (root) {
+        stack.emplace_back(root, 0);
+    }
+}
+
+Subtask::PreOrderIterator& Subtask::PreOrderIterator::operator++() {
+    auto current = stack.back();
+    stack.pop_back();
+    
+    // Hijos en orden inverso para visitarlos de izquierda a derecha
+    const auto& children = current.first->childSubtasks;
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+        stack.emplace_back(it->get(), current.second + 1);
+    }
+    return *this;
+}
+
+bool Subtask::PreOrderIterator::operator==(const PreOrderIterator& other) const {
+    if (stack.empty() || other.stack.empty()) {
+        return stack.empty() == other.stack.empty();
+    }
+    return stack.back().first == other.stack.back().first &&
+           stack.size() == other.stack.size();
+}
+
+Subtask::PostOrderIterator::PostOrderIterator(Subtask* root) {
+    if (root) {
+        stack.emplace_back(root, 0);
+        descend();
+    }
+}
+
+void Subtask::PostOrderIterator::descend() {
+    // Bajar por el primer hijo pendiente hasta llegar a una hoja
+    for (;;) {
+        auto& top = stack.back();
+        const auto& children = top.first->childSubtasks;
+        if (top.second >= children.size()) {
+            return;
+        }
+        Subtask* next = children[top.second++].get();
+        stack.emplace_back(next, 0);
+    }
+}
+
+Subtask::PostOrderIterator& Subtask::PostOrderIterator::operator++() {
+    stack.pop_back();
+    if (!stack.empty()) {
+        descend();
+    }
+    return *this;
+}
+
+bool Subtask::PostOrderIterator::operator==(const PostOrderIterator& other) const {
+    if (stack.empty() || other.stack.empty()) {
+        return stack.empty() == other.stack.empty();
+    }
+    return stack.back().first == other.stack.back().first &&
+           stack.size() == other.stack.size();
+}
+
+Subtask::Range<Subtask::PreOrderIterator> Subtask::preOrder() {
+    return {PreOrderIterator(this), PreOrderIterator()};
+}
+
+Subtask::Range<Subtask::PostOrderIterator> Subtask::postOrder() {
+    return {PostOrderIterator(this), PostOrderIterator()};
+}
+
+// Operaciones sobre el subárbol
+int Subtask::setSubtreeCompleted(bool completed) {
+    int changed = 0;
+    
+    // Un solo recorrido: los contadores de cada nodo quedan en 0 o en su
+    // total, porque todo el subárbol termina con el mismo estado
+    for (auto& node : preOrder()) {
+        if (node.completed != completed) {
+            node.completed = completed;
+            changed++;
+        }
+        node.subtreeCompleted = completed ? node.subtreeTotal : 0;
+    }
+    
+    if (changed > 0) {
+        int delta = completed ? changed : -changed;
+        if (parent) {
+            parent->propagateCounts(0, delta);
+        }
+        if (owner) {
+            owner->adjustCompleted(delta);
+        }
+    }
+    
+    return changed;
+}
+
+bool Subtask::isAncestorOf(const Subtask* other) const {
+    for (const Subtask* node = other; node; node = node->parent) {
+        if (node == this) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // Métodos de utilidad
 int Subtask::countTotalSubtasks() const {
-    int count = 1;  // Contar esta subtarea
-    for (const auto& child : childSubtasks) {
-        count += child->countTotalSubtasks();
-    }
-    return count;
+    return subtreeTotal;  // Incluye esta subtarea
 }
 
 int Subtask::countCompletedSubtasks() const {
-    int count = completed ? 1 : 0;
-    for (const auto& child : childSubtasks) {
-        count += child->countCompletedSubtasks();
-    }
-    return count;
+    return subtreeCompleted;
 }
 
 double Subtask::getCompletionPercentage() const {
@@ -110,22 +291,36 @@ double Subtask::getCompletionPercentage() const {
 
 string Subtask::toString(int depth) const {
     stringstream ss;
-    string indent(depth * 2, ' ');
-    
-    ss << indent << "[" << (completed ? "X" : " ") << "] " 
-       << title;
     
-    if (!description.empty()) {
-        ss << " - " << description;
-    }
-    
-    if (!childSubtasks.empty()) {
-        ss << " (" << countCompletedSubtasks() << "/" 
-           << countTotalSubtasks() << " completadas)";
-    }
+    // Preorden con pila explícita: (nodo, profundidad)
+    vector<pair<const Subtask*, int>> pending{{this, depth}};
+    bool first = true;
     
-    for (const auto& child : childSubtasks) {
-        ss << "\n" << child->toString(depth + 1);
+    while (!pending.empty()) {
+        auto current = pending.back();
+        pending.pop_back();
+        const Subtask& node = *current.first;
+        
+        if (!first) {
+            ss << "\n";
+        }
+        first = false;
+        
+        ss << string(current.second * 2, ' ') << "[" << (node.completed ? "X" : " ") << "] "
+           << node.title;
+        
+        if (!node.description.empty()) {
+            ss << " - " << node.description;
+        }
+        
+        if (!node.childSubtasks.empty()) {
+            ss << " (" << node.countCompletedSubtasks() << "/"
+               << node.countTotalSubtasks() << " completadas)";
+        }
+        
+        for (auto it = node.childSubtasks.rbegin(); it != node.childSubtasks.rend(); ++it) {
+            pending.emplace_back(it->get(), current.second + 1);
+        }
     }
     
     return ss.str();
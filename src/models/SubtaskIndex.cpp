@@ -0,0 +1,134 @@
+#include "models/SubtaskIndex.h"
+#include <algorithm>
+
+using namespace std;
+
+// Constructor
+SubtaskIndex::SubtaskIndex() : completedCount(0), nextId(1) {}
+
+// Destructor
+SubtaskIndex::~SubtaskIndex() {
+    clear();
+}
+
+// Registro de subárboles
+void SubtaskIndex::registerSubtree(shared_ptr<Subtask> root, int parentIndex) {
+    if (!root) return;
+
+    // Recorrido con pila explícita: los árboles importados pueden ser muy profundos
+    vector<pair<shared_ptr<Subtask>, int>> pending;
+    pending.emplace_back(root, parentIndex);
+
+    while (!pending.empty()) {
+        auto current = move(pending.back());
+        pending.pop_back();
+        Subtask* node = current.first.get();
+
+        if (node->id <= 0 || indexById.count(node->id)) {
+            node->id = nextId;
+        }
+        nextId = max(nextId, node->id + 1);
+
+        size_t index = nodes.size();
+        node->owner = this;
+        node->ownerIndex = static_cast<int>(index);
+        indexById[node->id] = index;
+        if (node->completed) {
+            completedCount++;
+        }
+        nodes.push_back({current.first, current.second});
+
+        for (const auto& child : node->childSubtasks) {
+            pending.emplace_back(child, static_cast<int>(index));
+        }
+    }
+}
+
+void SubtaskIndex::unregisterSubtree(Subtask* root) {
+    if (!root || root->owner != this) return;
+
+    vector<Subtask*> pending{root};
+    while (!pending.empty()) {
+        Subtask* node = pending.back();
+        pending.pop_back();
+
+        for (const auto& child : node->childSubtasks) {
+            pending.push_back(child.get());
+        }
+
+        // Conservar una referencia: el índice puede ser el último dueño
+        shared_ptr<Subtask> keepAlive = nodes[node->ownerIndex].subtask;
+        removeAt(static_cast<size_t>(node->ownerIndex));
+        node->owner = nullptr;
+        node->ownerIndex = -1;
+    }
+}
+
+void SubtaskIndex::removeAt(size_t index) {
+    Subtask* removed = nodes[index].subtask.get();
+    indexById.erase(removed->id);
+    if (removed->completed) {
+        completedCount--;
+    }
+
+    // El último nodo ocupa el hueco; sus hijos deben apuntar a la nueva posición
+    size_t last = nodes.size() - 1;
+    if (index != last) {
+        nodes[index] = move(nodes[last]);
+        Subtask* moved = nodes[index].subtask.get();
+        moved->ownerIndex = static_cast<int>(index);
+        indexById[moved->id] = index;
+
+        for (const auto& child : moved->childSubtasks) {
+            if (child->owner == this) {
+                nodes[child->ownerIndex].parentIndex = static_cast<int>(index);
+            }
+        }
+    }
+    nodes.pop_back();
+}
+
+// Consultas
+shared_ptr<Subtask> SubtaskIndex::find(int id) const {
+    auto it = indexById.find(id);
+    return it != indexById.end() ? nodes[it->second].subtask : nullptr;
+}
+
+shared_ptr<Subtask> SubtaskIndex::getNode(size_t index) const {
+    return index < nodes.size() ? nodes[index].subtask : nullptr;
+}
+
+int SubtaskIndex::getParentIndex(size_t index) const {
+    return index < nodes.size() ? nodes[index].parentIndex : -1;
+}
+
+size_t SubtaskIndex::size() const {
+    return nodes.size();
+}
+
+int SubtaskIndex::getTotalCount() const {
+    return static_cast<int>(nodes.size());
+}
+
+int SubtaskIndex::getCompletedCount() const {
+    return completedCount;
+}
+
+double SubtaskIndex::getCompletionPercentage() const {
+    return nodes.empty() ? 0.0 : (completedCount * 100.0) / nodes.size();
+}
+
+void SubtaskIndex::adjustCompleted(int delta) {
+    completedCount += delta;
+}
+
+// Métodos de utilidad
+void SubtaskIndex::clear() {
+    for (auto& node : nodes) {
+        node.subtask->owner = nullptr;
+        node.subtask->ownerIndex = -1;
+    }
+    nodes.clear();
+    indexById.clear();
+    completedCount = 0;
+}
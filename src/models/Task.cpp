@@ -1,25 +1,45 @@
 #include "models/Task.h"
+#include "utils/PoolAllocator.h"
 #include <sstream>
 #include <algorithm>
 #include <ctime>
+#include <atomic>
 
 using namespace std;
 
+namespace {
+
+// Las versiones no se repiten entre tareas: una tarea nueva con el id de
+// otra ya borrada no coincide con lo que se haya cacheado de aquella
+atomic<uint64_t> nextContentVersion(1);
+
+uint64_t newContentVersion() {
+    return nextContentVersion.fetch_add(1, memory_order_relaxed);
+}
+
+} // namespace
+
 // Constructores
 Task::Task() 
     : id(-1), title(""), description(""), state("Pendiente"),
       assignedUserId(-1), priority(3),
       createdDate(chrono::system_clock::now()),
-      activityLog(make_shared<ActivityLog>()) {}
+      subtaskIndex(make_unique<SubtaskIndex>()), streamId(0),
+      hotTable(nullptr), hotRow(0), boardId(-1), contentVersion(newContentVersion()) {}
 
 Task::Task(int id, const string& title, const string& description)
     : id(id), title(title), description(description), state("Pendiente"),
       assignedUserId(-1), priority(3),
       createdDate(chrono::system_clock::now()),
-      activityLog(make_shared<ActivityLog>()) {}
+      subtaskIndex(make_unique<SubtaskIndex>()), streamId(0),
+      hotTable(nullptr), hotRow(0), boardId(-1), contentVersion(newContentVersion()) {}
 
 // Destructor
-Task::~Task() {}
+Task::~Task() {
+    if (hotTable) {
+        hotTable->remove(*this);
+    }
+}
 
 // Getters
 int Task::getId() const {
@@ -58,6 +78,10 @@ const vector<shared_ptr<Subtask>>& Task::getSubtasks() const {
     return subtasks;
 }
 
+const SubtaskIndex& Task::getSubtaskIndex() const {
+    return *subtaskIndex;
+}
+
 const set<int>& Task::getDependencies() const {
     return dependencies;
 }
@@ -66,8 +90,26 @@ const vector<string>& Task::getTags() const {
     return tags;
 }
 
-shared_ptr<ActivityLog> Task::getActivityLog() const {
-    return activityLog;
+vector<ActivityEntry> Task::getActivityEntries() const {
+    // Con EventStore el registro es el flujo de la tarea dentro del store
+    if (eventStore) {
+        return eventStore->getStreamEntries(streamId);
+    }
+    return activityLog ? activityLog->getEntries() : vector<ActivityEntry>();
+}
+
+size_t Task::getActivityCount() const {
+    if (eventStore) {
+        return eventStore->getStreamSize(streamId);
+    }
+    return activityLog ? activityLog->getSize() : 0;
+}
+
+vector<StateTransition> Task::getStateTransitions() const {
+    if (eventStore) {
+        return eventStore->getStreamTransitions(streamId);
+    }
+    return activityLog ? activityLog->getStateTransitions() : vector<StateTransition>();
 }
 
 // Setters
@@ -77,10 +119,12 @@ void Task::setTitle(const string& newTitle, const string& modifiedBy) {
         this->title = newTitle;
         
         // Registrar cambio
-        activityLog->logUpdate(modifiedBy, "título", oldTitle, newTitle);
+        recordActivity(ActivityEntry(modifiedBy, ActivityEntry::Action::UPDATED,
+                                     "título", oldTitle, newTitle));
         
         // Crear memento
-        createMemento(modifiedBy);
+        recordVersion(modifiedBy);
+        publishFieldChanged(TaskField::TITLE);
     }
 }
 
@@ -90,12 +134,13 @@ void Task::setDescription(const string& newDescription, const string& modifiedBy
         this->description = newDescription;
         
         // Registrar cambio
-        activityLog->logUpdate(modifiedBy, "descripción", 
-                              oldDescription.substr(0, 30), 
-                              newDescription.substr(0, 30));
+        recordActivity(ActivityEntry(modifiedBy, ActivityEntry::Action::UPDATED, "descripción",
+                                     oldDescription.substr(0, 30),
+                                     newDescription.substr(0, 30)));
         
         // Crear memento
-        createMemento(modifiedBy);
+        recordVersion(modifiedBy);
+        publishFieldChanged(TaskField::DESCRIPTION);
     }
 }
 
@@ -104,83 +149,240 @@ void Task::setState(const string& newState, const string& modifiedBy) {
         string oldState = this->state;
         this->state = newState;
         
+        syncHotRow();
+        
         // Registrar movimiento
-        activityLog->logMove(modifiedBy, oldState, newState);
+        recordActivity(ActivityEntry(modifiedBy, ActivityEntry::Action::MOVED,
+                                     "estado", oldState, newState));
         
         // Crear memento
-        createMemento(modifiedBy);
+        recordVersion(modifiedBy);
+        
+        if (eventBus) {
+            eventBus->publish(TaskMoved{boardId, this, oldState, this->state, modifiedBy,
+                                        chrono::system_clock::now()});
+        }
     }
 }
 
 void Task::setAssignedUserId(int userId, const string& modifiedBy) {
     if (userId != this->assignedUserId) {
         this->assignedUserId = userId;
+        syncHotRow();
         
         // Registrar asignación
-        activityLog->logAssignment(modifiedBy, "Usuario ID: " + to_string(userId));
+        recordActivity(ActivityEntry(modifiedBy, ActivityEntry::Action::ASSIGNED, "asignado a",
+                                     "", "Usuario ID: " + to_string(userId)));
+        publishFieldChanged(TaskField::ASSIGNEE);
     }
 }
 
 void Task::setDueDate(const chrono::system_clock::time_point& date) {
-    this->dueDate = date;
+    if (date != this->dueDate) {
+        this->dueDate = date;
+        syncHotRow();
+        publishFieldChanged(TaskField::DUE_DATE);
+    }
 }
 
 void Task::setPriority(int priority) {
-    if (priority >= 1 && priority <= 5) {
+    if (priority >= 1 && priority <= 5 && priority != this->priority) {
         this->priority = priority;
+        syncHotRow();
+        publishFieldChanged(TaskField::PRIORITY);
+    }
+}
+
+// Registro de actividad central
+void Task::bindEventStore(shared_ptr<EventStore> store, int boardId) {
+    if (!store || store == eventStore) return;
+    
+    EventStore::StreamId newStream = store->registerStream(boardId, id);
+    
+    // Pasar al nuevo store lo registrado hasta ahora
+    if (eventStore) {
+        for (const auto& entry : eventStore->getStreamEntries(streamId)) {
+            store->append(newStream, entry);
+        }
+    } else if (activityLog) {
+        for (const auto& entry : activityLog->getEntries()) {
+            store->append(newStream, entry);
+        }
+        activityLog.reset();
+    }
+    
+    eventStore = store;
+    streamId = newStream;
+}
+
+shared_ptr<EventStore> Task::getEventStore() const {
+    return eventStore;
+}
+
+// Eventos
+void Task::bindEventBus(shared_ptr<EventBus> bus, int boardId) {
+    eventBus = bus;
+    this->boardId = bus ? boardId : -1;
+}
+
+shared_ptr<EventBus> Task::getEventBus() const {
+    return eventBus;
+}
+
+int Task::getBoardId() const {
+    return boardId;
+}
+
+uint64_t Task::getContentVersion() const {
+    return contentVersion;
+}
+
+void Task::touch() {
+    contentVersion = newContentVersion();
+}
+
+void Task::publishFieldChanged(TaskField field) {
+    touch();
+    if (eventBus) {
+        eventBus->publish(FieldChanged{boardId, this, field});
+    }
+}
+
+void Task::syncHotRow() {
+    if (hotTable) {
+        hotTable->update(*this);
+    }
+}
+
+// Memoria
+void Task::setMemoryPool(shared_ptr<pmr::memory_resource> pool) {
+    memoryPool = pool;
+}
+
+shared_ptr<pmr::memory_resource> Task::getMemoryPool() const {
+    return memoryPool;
+}
+
+void Task::recordActivity(const ActivityEntry& entry) {
+    if (eventStore) {
+        eventStore->append(streamId, entry);
+        return;
+    }
+    
+    if (!activityLog) {
+        activityLog = memoryPool
+            ? allocate_shared<ActivityLog>(PoolAllocator<ActivityLog>(memoryPool))
+            : make_shared<ActivityLog>();
     }
+    activityLog->addEntry(entry);
 }
 
 // Gestión de subtareas
+shared_ptr<Subtask> Task::allocateSubtask(const string& title, const string& description) {
+    // El id definitivo lo asigna el índice al agregarla
+    if (memoryPool) {
+        return allocate_shared<Subtask>(PoolAllocator<Subtask>(memoryPool), 0, title, description);
+    }
+    return make_shared<Subtask>(0, title, description);
+}
+
 void Task::addSubtask(shared_ptr<Subtask> subtask) {
-    if (subtask) {
-        subtasks.push_back(subtask);
+    insertSubtask(subtasks.size(), subtask);
+}
+
+void Task::insertSubtask(size_t position, shared_ptr<Subtask> subtask) {
+    if (subtask && !subtask->getParent()) {
+        subtasks.insert(subtasks.begin() + min(position, subtasks.size()), subtask);
+        subtaskIndex->registerSubtree(subtask, -1);
+        publishFieldChanged(TaskField::SUBTASKS);
     }
 }
 
 void Task::removeSubtask(int subtaskId) {
-    subtasks.erase(
-        remove_if(subtasks.begin(), subtasks.end(),
-            [subtaskId](const shared_ptr<Subtask>& st) {
-                return st->getId() == subtaskId;
-            }),
-        subtasks.end()
-    );
+    auto it = remove_if(subtasks.begin(), subtasks.end(),
+        [subtaskId](const shared_ptr<Subtask>& st) {
+            return st->getId() == subtaskId;
+        });
+    
+    if (it == subtasks.end()) return;
+    
+    for (auto removed = it; removed != subtasks.end(); ++removed) {
+        subtaskIndex->unregisterSubtree(removed->get());
+    }
+    subtasks.erase(it, subtasks.end());
+    publishFieldChanged(TaskField::SUBTASKS);
 }
 
-shared_ptr<Subtask> Task::findSubtaskById(int id) {
-    for (auto& subtask : subtasks) {
-        auto found = subtask->findSubtaskById(id);
-        if (found) {
-            return found;
-        }
+void Task::removeSubtaskAt(size_t position) {
+    if (position < subtasks.size()) {
+        subtaskIndex->unregisterSubtree(subtasks[position].get());
+        subtasks.erase(subtasks.begin() + position);
+        publishFieldChanged(TaskField::SUBTASKS);
     }
-    return nullptr;
 }
 
-double Task::getSubtaskCompletionPercentage() const {
-    if (subtasks.empty()) {
-        return 0.0;
-    }
+shared_ptr<Subtask> Task::findSubtaskById(int id) {
+    return subtaskIndex->find(id);
+}
+
+bool Task::setSubtreeCompleted(int subtaskId, bool completed) {
+    auto subtask = subtaskIndex->find(subtaskId);
+    if (!subtask) return false;
     
-    int total = 0;
-    int completed = 0;
+    subtask->setSubtreeCompleted(completed);
+    touch();
+    return true;
+}
+
+bool Task::moveSubtaskTo(int subtaskId, Task& target, int newParentId) {
+    auto subtask = subtaskIndex->find(subtaskId);
+    if (!subtask) return false;
     
-    for (const auto& subtask : subtasks) {
-        total += subtask->countTotalSubtasks();
-        completed += subtask->countCompletedSubtasks();
+    shared_ptr<Subtask> newParent;
+    if (newParentId > 0) {
+        newParent = target.subtaskIndex->find(newParentId);
+        if (!newParent || subtask->isAncestorOf(newParent.get())) {
+            return false;  // Padre inexistente, o dentro del propio subárbol
+        }
     }
     
-    return total > 0 ? (completed * 100.0) / total : 0.0;
+    // Desenganchar: los contadores del subárbol no cambian, solo los de
+    // los ancestros, y cada nodo se quita y se registra una vez
+    if (Subtask* parent = subtask->getParent()) {
+        parent->removeChildSubtask(subtaskId);
+    } else {
+        removeSubtask(subtaskId);
+    }
+    
+    if (newParent) {
+        newParent->addChildSubtask(subtask);
+    } else {
+        target.addSubtask(subtask);
+    }
+    return true;
+}
+
+double Task::getSubtaskCompletionPercentage() const {
+    return subtaskIndex->getCompletionPercentage();
 }
 
 // Gestión de dependencias
 void Task::addDependency(int taskId) {
-    dependencies.insert(taskId);
+    if (!dependencies.insert(taskId).second) return;
+    
+    touch();
+    if (eventBus) {
+        eventBus->publish(DependencyAdded{boardId, this, taskId});
+    }
 }
 
 void Task::removeDependency(int taskId) {
-    dependencies.erase(taskId);
+    if (dependencies.erase(taskId) == 0) return;
+    
+    touch();
+    if (eventBus) {
+        eventBus->publish(DependencyRemoved{boardId, this, taskId});
+    }
 }
 
 bool Task::hasDependency(int taskId) const {
@@ -195,11 +397,16 @@ bool Task::hasDependencies() const {
 void Task::addTag(const string& tag) {
     if (find(tags.begin(), tags.end(), tag) == tags.end()) {
         tags.push_back(tag);
+        publishFieldChanged(TaskField::TAGS);
     }
 }
 
 void Task::removeTag(const string& tag) {
-    tags.erase(remove(tags.begin(), tags.end(), tag), tags.end());
+    auto it = remove(tags.begin(), tags.end(), tag);
+    if (it != tags.end()) {
+        tags.erase(it, tags.end());
+        publishFieldChanged(TaskField::TAGS);
+    }
 }
 
 bool Task::hasTag(const string& tag) const {
@@ -208,32 +415,30 @@ bool Task::hasTag(const string& tag) const {
 
 // Patrón Memento - Control de versiones
 shared_ptr<TaskMemento> Task::createMemento(const string& modifiedBy) {
-    // Usar constructor directo en lugar de make_shared porque el constructor es privado
-    shared_ptr<TaskMemento> memento(new TaskMemento(title, description, state, 
-                                                          assignedUserId, modifiedBy));
-    history.push_back(memento);
-    
-    // Limitar historial a 50 versiones
-    if (history.size() > 50) {
-        history.erase(history.begin());
-    }
-    
-    return memento;
+    recordVersion(modifiedBy);
+    return history.getVersion(history.size() - 1);
+}
+
+void Task::recordVersion(const string& modifiedBy) {
+    history.record(title, description, state, assignedUserId, modifiedBy);
 }
 
 void Task::restoreFromMemento(shared_ptr<TaskMemento> memento) {
     if (memento) {
         this->title = memento->getTitle();
         this->description = memento->getDescription();
-        this->state = memento->getState();
         this->assignedUserId = memento->getAssignedUserId();
+        syncHotRow();
+        
+        // Un cambio de estado es un movimiento: queda registrado y se publica
+        setState(memento->getState(), "Sistema");
         
-        activityLog->addEntry(ActivityEntry("Sistema", "restored", "", "", "",
-                                           "Restauró versión anterior"));
+        recordActivity(ActivityEntry("Sistema", ActivityEntry::Action::RESTORED));
+        publishFieldChanged(TaskField::RESTORED);
     }
 }
 
-const vector<shared_ptr<TaskMemento>>& Task::getHistory() const {
+const TaskHistory& Task::getHistory() const {
     return history;
 }
 
@@ -0,0 +1,169 @@
+#include "models/TaskHistory.h"
+#include <algorithm>
+
+using namespace std;
+
+// Constructor
+TaskHistory::TaskHistory(size_t capacity, size_t keyframeInterval)
+    : capacity(max<size_t>(1, capacity)),
+      keyframeInterval(max<size_t>(1, keyframeInterval)),
+      sinceKeyframe(0) {}
+
+// Agregar versión
+shared_ptr<const string> TaskHistory::shareIfEqual(const shared_ptr<const string>& previous,
+                                                   const string& value) {
+    if (previous && *previous == value) {
+        return previous;
+    }
+    return make_shared<const string>(value);
+}
+
+void TaskHistory::record(const string& title, const string& description, const string& state,
+                         int assignedUserId, const string& modifiedBy) {
+    const Version* previous = versions.empty() ? nullptr : &versions.back();
+
+    Version version;
+    version.title = shareIfEqual(previous ? previous->title : nullptr, title);
+    version.state = shareIfEqual(previous ? previous->state : nullptr, state);
+    version.modifiedBy = shareIfEqual(previous ? previous->modifiedBy : nullptr, modifiedBy);
+    version.assignedUserId = assignedUserId;
+    version.timestampTicks = chrono::system_clock::now().time_since_epoch().count();
+    version.prefixLength = 0;
+    version.suffixLength = 0;
+
+    bool needsKeyframe = !previous || sinceKeyframe + 1 >= keyframeInterval;
+    if (!needsKeyframe) {
+        const string& old = *latestDescription;
+
+        // Prefijo y sufijo comunes, sin solaparse
+        size_t limit = min(old.size(), description.size());
+        size_t prefix = 0;
+        while (prefix < limit && old[prefix] == description[prefix]) {
+            ++prefix;
+        }
+        size_t suffix = 0;
+        while (suffix < limit - prefix &&
+               old[old.size() - 1 - suffix] == description[description.size() - 1 - suffix]) {
+            ++suffix;
+        }
+
+        // Si casi todo cambió, un keyframe cuesta lo mismo y se reconstruye más rápido
+        size_t changed = description.size() - prefix - suffix;
+        if (changed * 2 > description.size()) {
+            needsKeyframe = true;
+        } else {
+            version.prefixLength = static_cast<uint32_t>(prefix);
+            version.suffixLength = static_cast<uint32_t>(suffix);
+            version.middle = description.substr(prefix, changed);
+        }
+    }
+
+    latestDescription = shareIfEqual(latestDescription, description);
+    if (needsKeyframe) {
+        version.keyframe = latestDescription;
+        sinceKeyframe = 0;
+    } else {
+        ++sinceKeyframe;
+    }
+
+    versions.push_back(move(version));
+
+    // Descartar la más antigua; la siguiente debe poder reconstruirse sola
+    if (versions.size() > capacity) {
+        if (!versions[1].isKeyframe()) {
+            versions[1].keyframe = buildDescription(1);
+            versions[1].middle.clear();
+            versions[1].middle.shrink_to_fit();
+        }
+        versions.pop_front();
+    }
+}
+
+shared_ptr<const string> TaskHistory::buildDescription(size_t index) const {
+    if (index + 1 == versions.size()) {
+        return latestDescription;
+    }
+
+    size_t base = index;
+    while (!versions[base].isKeyframe()) {
+        --base;
+    }
+
+    if (base == index) {
+        return versions[index].keyframe;
+    }
+
+    string text = *versions[base].keyframe;
+    for (size_t i = base + 1; i <= index; ++i) {
+        const Version& delta = versions[i];
+        string next;
+        next.reserve(delta.prefixLength + delta.middle.size() + delta.suffixLength);
+        next.append(text, 0, delta.prefixLength);
+        next.append(delta.middle);
+        next.append(text, text.size() - delta.suffixLength, delta.suffixLength);
+        text.swap(next);
+    }
+
+    return make_shared<const string>(move(text));
+}
+
+// Acceso
+shared_ptr<TaskMemento> TaskHistory::getVersion(size_t index) const {
+    if (index >= versions.size()) {
+        return nullptr;
+    }
+
+    const Version& version = versions[index];
+    auto timestamp = chrono::system_clock::time_point(
+        chrono::system_clock::duration(version.timestampTicks));
+
+    // Constructor privado: no se puede usar make_shared
+    return shared_ptr<TaskMemento>(new TaskMemento(version.title, buildDescription(index),
+                                                   version.state, version.assignedUserId,
+                                                   version.modifiedBy, timestamp));
+}
+
+shared_ptr<TaskMemento> TaskHistory::operator[](size_t index) const {
+    return getVersion(index);
+}
+
+chrono::system_clock::time_point TaskHistory::getTimestamp(size_t index) const {
+    return chrono::system_clock::time_point(
+        chrono::system_clock::duration(versions[index].timestampTicks));
+}
+
+const string& TaskHistory::getModifiedBy(size_t index) const {
+    return *versions[index].modifiedBy;
+}
+
+// Métodos de utilidad
+size_t TaskHistory::size() const {
+    return versions.size();
+}
+
+bool TaskHistory::empty() const {
+    return versions.empty();
+}
+
+size_t TaskHistory::getCapacity() const {
+    return capacity;
+}
+
+size_t TaskHistory::getMemoryUsage() const {
+    size_t bytes = versions.size() * sizeof(Version);
+    const string* lastKeyframe = nullptr;
+    for (const auto& version : versions) {
+        bytes += version.middle.capacity();
+        if (version.isKeyframe() && version.keyframe.get() != lastKeyframe) {
+            bytes += version.keyframe->capacity();
+            lastKeyframe = version.keyframe.get();
+        }
+    }
+    return bytes;
+}
+
+void TaskHistory::clear() {
+    versions.clear();
+    latestDescription.reset();
+    sinceKeyframe = 0;
+}
@@ -0,0 +1,198 @@
+#include "models/TaskHotTable.h"
+#include "models/Task.h"
+#include "utils/StringPool.h"
+#include <limits>
+
+using namespace std;
+
+namespace {
+
+// Los filtros de la tabla usan límites exclusivos y el predicado inclusivos;
+// devuelve false si el intervalo abierto (after, before) queda vacío
+bool toInclusive(int64_t after, int64_t before, SelectionKernels::Predicate& predicate) {
+    if (after == numeric_limits<int64_t>::max() || before == numeric_limits<int64_t>::min()) {
+        return false;
+    }
+    predicate.dueFrom = after + 1;
+    predicate.dueTo = before - 1;
+    return predicate.dueFrom <= predicate.dueTo;
+}
+
+} // namespace
+
+// Constructor
+TaskHotTable::TaskHotTable() {}
+
+// Destructor
+TaskHotTable::~TaskHotTable() {
+    clear();
+}
+
+// Filas
+void TaskHotTable::writeRow(Row row, const Task& task) {
+    stateIds[row] = stateIdOf(task.state);
+    priorities[row] = task.priority;
+    assigneeIds[row] = task.assignedUserId;
+    dueTicks[row] = toTicks(task.dueDate);
+}
+
+void TaskHotTable::insert(Task& task) {
+    if (task.hotTable == this) return;
+    if (task.hotTable) {
+        task.hotTable->remove(task);
+    }
+    
+    Row row = static_cast<Row>(tasks.size());
+    stateIds.push_back(0);
+    priorities.push_back(0);
+    assigneeIds.push_back(0);
+    dueTicks.push_back(0);
+    taskIds.push_back(task.id);
+    tasks.push_back(&task);
+    writeRow(row, task);
+    
+    task.hotTable = this;
+    task.hotRow = row;
+}
+
+void TaskHotTable::remove(Task& task) {
+    if (task.hotTable != this) return;
+    
+    // Mover la última fila al hueco
+    Row row = task.hotRow;
+    Row last = static_cast<Row>(tasks.size() - 1);
+    if (row != last) {
+        stateIds[row] = stateIds[last];
+        priorities[row] = priorities[last];
+        assigneeIds[row] = assigneeIds[last];
+        dueTicks[row] = dueTicks[last];
+        taskIds[row] = taskIds[last];
+        tasks[row] = tasks[last];
+        tasks[row]->hotRow = row;
+    }
+    
+    stateIds.pop_back();
+    priorities.pop_back();
+    assigneeIds.pop_back();
+    dueTicks.pop_back();
+    taskIds.pop_back();
+    tasks.pop_back();
+    
+    task.hotTable = nullptr;
+    task.hotRow = 0;
+}
+
+void TaskHotTable::update(const Task& task) {
+    if (task.hotTable == this) {
+        writeRow(task.hotRow, task);
+    }
+}
+
+void TaskHotTable::clear() {
+    for (Task* task : tasks) {
+        task->hotTable = nullptr;
+        task->hotRow = 0;
+    }
+    
+    stateIds.clear();
+    priorities.clear();
+    assigneeIds.clear();
+    dueTicks.clear();
+    taskIds.clear();
+    tasks.clear();
+}
+
+// Columnas
+const vector<uint32_t>& TaskHotTable::getStateIds() const {
+    return stateIds;
+}
+
+const vector<int32_t>& TaskHotTable::getPriorities() const {
+    return priorities;
+}
+
+const vector<int32_t>& TaskHotTable::getAssigneeIds() const {
+    return assigneeIds;
+}
+
+const vector<int64_t>& TaskHotTable::getDueTicks() const {
+    return dueTicks;
+}
+
+const vector<int32_t>& TaskHotTable::getTaskIds() const {
+    return taskIds;
+}
+
+Task* TaskHotTable::getTask(Row row) const {
+    return tasks[row];
+}
+
+size_t TaskHotTable::size() const {
+    return tasks.size();
+}
+
+// Filtros
+SelectionKernels::Columns TaskHotTable::getColumns() const {
+    SelectionKernels::Columns columns;
+    columns.stateIds = stateIds.data();
+    columns.priorities = priorities.data();
+    columns.assigneeIds = assigneeIds.data();
+    columns.dueTicks = dueTicks.data();
+    columns.count = tasks.size();
+    return columns;
+}
+
+void TaskHotTable::select(const SelectionKernels::Predicate& predicate,
+                          vector<uint64_t>& bitmap) const {
+    SelectionKernels::select(getColumns(), predicate, bitmap);
+}
+
+vector<TaskHotTable::Row> TaskHotTable::selectRows(
+    const SelectionKernels::Predicate& predicate) const {
+    vector<uint64_t> bitmap;
+    select(predicate, bitmap);
+    return SelectionKernels::toRows(bitmap);
+}
+
+vector<TaskHotTable::Row> TaskHotTable::selectOverdue(uint32_t doneStateId,
+                                                      int64_t nowTicks) const {
+    SelectionKernels::Predicate predicate;
+    if (nowTicks == numeric_limits<int64_t>::min()) return {};
+    predicate.dueTo = nowTicks - 1;
+    predicate.excludeState = true;
+    predicate.excludedStateId = doneStateId;
+    return selectRows(predicate);
+}
+
+vector<TaskHotTable::Row> TaskHotTable::selectDueBetween(uint32_t doneStateId,
+                                                         int64_t fromTicks,
+                                                         int64_t toTicks) const {
+    SelectionKernels::Predicate predicate;
+    if (!toInclusive(fromTicks, toTicks, predicate)) return {};
+    predicate.excludeState = true;
+    predicate.excludedStateId = doneStateId;
+    return selectRows(predicate);
+}
+
+vector<TaskHotTable::Row> TaskHotTable::selectByAssignee(int32_t userId) const {
+    SelectionKernels::Predicate predicate;
+    predicate.assignees.push_back(userId);
+    return selectRows(predicate);
+}
+
+size_t TaskHotTable::countByState(uint32_t stateId) const {
+    size_t count = 0;
+    for (uint32_t state : stateIds) {
+        count += state == stateId;
+    }
+    return count;
+}
+
+// Conversión
+int64_t TaskHotTable::toTicks(const chrono::system_clock::time_point& tp) {
+    return static_cast<int64_t>(tp.time_since_epoch().count());
+}
+
+uint32_t TaskHotTable::stateIdOf(const string& state) {
+    return StringPool::getInstance().intern(state);
+}
@@ -6,24 +6,24 @@
 using namespace std;
 
 // Constructor
-TaskMemento::TaskMemento(const string& title, const string& description,
-                         const string& state, int assignedUserId,
-                         const string& modifiedBy)
-    : title(title), description(description), state(state), 
-      assignedUserId(assignedUserId), modifiedBy(modifiedBy),
-      timestamp(chrono::system_clock::now()) {}
+TaskMemento::TaskMemento(shared_ptr<const string> title, shared_ptr<const string> description,
+                         shared_ptr<const string> state, int assignedUserId,
+                         shared_ptr<const string> modifiedBy,
+                         const chrono::system_clock::time_point& timestamp)
+    : title(title), description(description), state(state),
+      assignedUserId(assignedUserId), timestamp(timestamp), modifiedBy(modifiedBy) {}
 
 // Getters
 string TaskMemento::getTitle() const {
-    return title;
+    return *title;
 }
 
 string TaskMemento::getDescription() const {
-    return description;
+    return *description;
 }
 
 string TaskMemento::getState() const {
-    return state;
+    return *state;
 }
 
 int TaskMemento::getAssignedUserId() const {
@@ -35,7 +35,7 @@ chrono::system_clock::time_point TaskMemento::getTimestamp() const {
 }
 
 string TaskMemento::getModifiedBy() const {
-    return modifiedBy;
+    return *modifiedBy;
 }
 
 string TaskMemento::toString() const {
@@ -44,10 +44,10 @@ string TaskMemento::toString() const {
     // Convertir timestamp a string
     time_t time = chrono::system_clock::to_time_t(timestamp);
     ss << "Versión del " << put_time(localtime(&time), "%Y-%m-%d %H:%M:%S");
-    ss << " por " << modifiedBy << "\n";
-    ss << "Estado: " << state << "\n";
-    ss << "Título: " << title << "\n";
-    ss << "Descripción: " << description;
+    ss << " por " << *modifiedBy << "\n";
+    ss << "Estado: " << *state << "\n";
+    ss << "Título: " << *title << "\n";
+    ss << "Descripción: " << *description;
     
     return ss.str();
 }
@@ -1,5 +1,6 @@
 #include "ui/BoardWidget.h"
 #include "ui/ColumnWidget.h"
+#include "utils/PerfMonitor.h"
 #include <QScrollBar>
 #include <QMessageBox>
 #include <QGraphicsDropShadowEffect>
@@ -9,8 +10,17 @@ using namespace std;
 BoardWidget::BoardWidget(shared_ptr<Board> board,
                         const string& currentUserName,
                         QWidget *parent)
-    : QWidget(parent), board(board), currentUserName(currentUserName) {
+    : QWidget(parent), board(board), currentUserName(currentUserName),
+      virtualizationThreshold(DEFAULT_VIRTUALIZATION_THRESHOLD) {
+    // Los cambios de un mismo ciclo de eventos se aplican juntos
+    syncTimer = new QTimer(this);
+    syncTimer->setSingleShot(true);
+    syncTimer->setInterval(0);
+    connect(syncTimer, &QTimer::timeout, this, &BoardWidget::applyPendingChanges);
+    
     setupUI();
+    subscribeToBoard();
+    refresh();
 }
 
 BoardWidget::~BoardWidget() {}
@@ -58,7 +68,6 @@ void BoardWidget::setupUI() {
     columnsLayout->setAlignment(Qt::AlignLeft | Qt::AlignTop);
     
     createColumns();
-    populateTasks();
     
     columnsContainer->setLayout(columnsLayout);
     scrollArea->setWidget(columnsContainer);
@@ -101,6 +110,7 @@ void BoardWidget::createColumns() {
         // Conectar señales
         connect(column, &ColumnWidget::taskDropped, this, &BoardWidget::onTaskCardMoved);
         connect(column, &ColumnWidget::addTaskRequested, this, &BoardWidget::onAddTaskClicked);
+        connect(column, &ColumnWidget::taskActivated, this, &BoardWidget::onTaskCardClicked);
         
         columnsLayout->addWidget(column);
         stateColumns[state] = column;
@@ -109,33 +119,183 @@ void BoardWidget::createColumns() {
     columnsLayout->addStretch();
 }
 
-void BoardWidget::populateTasks() {
+void BoardWidget::subscribeToBoard() {
     if (!board) return;
     
-    const auto& states = board->getStates();
+    int boardId = board->getId();
+    subscriptions = EventSubscriptions(board->getEventBus());
     
-    for (const auto& state : states) {
-        auto tasks = board->getTasksByState(state);
-        auto column = stateColumns[state];
+    subscriptions.subscribe<TaskCreated>([this, boardId](const TaskCreated& event) {
+        if (event.boardId == boardId) {
+            markStateDirty(string(event.state));
+        }
+    });
+    subscriptions.subscribe<TaskRemoved>([this, boardId](const TaskRemoved& event) {
+        if (event.boardId == boardId) {
+            markStateDirty(string(event.state));
+        }
+    });
+    subscriptions.subscribe<TaskMoved>([this, boardId](const TaskMoved& event) {
+        if (event.boardId == boardId) {
+            markStateDirty(string(event.fromState));
+            markStateDirty(string(event.toState));
+        }
+    });
+    subscriptions.subscribe<FieldChanged>([this, boardId](const FieldChanged& event) {
+        if (event.boardId == boardId) {
+            markCardDirty(event.task->getId());
+        }
+    });
+    subscriptions.subscribe<DependencyAdded>([this, boardId](const DependencyAdded& event) {
+        if (event.boardId == boardId) {
+            markCardDirty(event.task->getId());
+        }
+    });
+    subscriptions.subscribe<DependencyRemoved>([this, boardId](const DependencyRemoved& event) {
+        if (event.boardId == boardId) {
+            markCardDirty(event.task->getId());
+        }
+    });
+    subscriptions.subscribe<BoardCleared>([this, boardId](const BoardCleared& event) {
+        if (event.boardId == boardId) {
+            for (const auto& state : board->getStates()) {
+                markStateDirty(state);
+            }
+        }
+    });
+}
+
+void BoardWidget::markStateDirty(const string& state) {
+    dirtyStates.insert(state);
+    if (!syncTimer->isActive()) {
+        syncTimer->start();
+    }
+}
+
+void BoardWidget::markCardDirty(int taskId) {
+    dirtyCards.insert(taskId);
+    if (!syncTimer->isActive()) {
+        syncTimer->start();
+    }
+}
+
+TaskCard* BoardWidget::createCard(shared_ptr<Task> task) {
+    TaskCard* card = new TaskCard(task, this);
+    
+    connect(card, &TaskCard::doubleClicked, this, &BoardWidget::onTaskCardClicked);
+    connect(card, &TaskCard::clicked, this, &BoardWidget::onTaskCardClicked);
+    
+    return card;
+}
+
+void BoardWidget::syncColumn(const string& state, vector<TaskCard*>& detached) {
+    auto columnIt = stateColumns.find(state);
+    if (columnIt == stateColumns.end()) return;
+    
+    ColumnWidget* column = columnIt->second;
+    QVBoxLayout* layout = column->getTasksLayout();
+    auto tasks = board->getTasksByState(state);
+    column->setTaskCount(static_cast<int>(tasks.size()));
+    
+    // Columnas grandes en modo virtualizado; vuelven a tarjetas recién por
+    // debajo de la mitad del umbral para no alternar en el límite
+    int count = static_cast<int>(tasks.size());
+    bool virtualize = column->isVirtualized() ? count >= virtualizationThreshold / 2
+                                              : count >= virtualizationThreshold;
+    if (virtualize) {
+        detachCards(layout, 0, detached);
+        column->setVirtualized(true);
+        column->getTaskModel()->setTasks(tasks);
+        return;
+    }
+    column->setVirtualized(false);
+    
+    // Dejar la fila i con la tarjeta de tasks[i]; solo se tocan las que difieren
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const auto& task = tasks[i];
+        TaskCard*& card = taskCards[task->getId()];
+        if (!card) {
+            card = createCard(task);
+        } else if (card->getTask() != task) {
+            card->updateTask(task);  // Id reutilizado (tablero vaciado)
+        }
         
-        if (!column) continue;
+        QLayoutItem* item = layout->itemAt(static_cast<int>(i));
+        if (item && item->widget() == card) {
+            continue;
+        }
         
-        auto layout = column->getTasksLayout();
+        // Sacarla de la columna donde esté (esta u otra) y ubicarla aquí
+        if (QWidget* container = card->parentWidget()) {
+            if (QLayout* current = container->layout()) {
+                current->removeWidget(card);
+            }
+        }
+        layout->insertWidget(static_cast<int>(i), card);
+        card->show();
+    }
+    
+    // Lo que queda antes del stretch ya no pertenece a esta columna
+    detachCards(layout, count, detached);
+}
+
+void BoardWidget::detachCards(QVBoxLayout* layout, int keep, vector<TaskCard*>& detached) {
+    while (layout->count() - 1 > keep) {
+        QWidget* widget = layout->itemAt(keep)->widget();
+        if (!widget) break;
         
-        // Actualizar contador
-        column->setTaskCount(tasks.size());
+        layout->removeWidget(widget);
+        widget->hide();
+        if (TaskCard* card = qobject_cast<TaskCard*>(widget)) {
+            detached.push_back(card);
+        }
+    }
+}
+
+void BoardWidget::applyPendingChanges() {
+    PERF_SCOPE("BoardWidget::applyPendingChanges");
+    syncTimer->stop();
+    if (!board) return;
+    
+    vector<TaskCard*> detached;
+    for (const auto& state : dirtyStates) {
+        syncColumn(state, detached);
+    }
+    dirtyStates.clear();
+    
+    // Las que salieron de una columna sin entrar en otra son de tareas que
+    // ya no están en el tablero o que pasaron a una columna virtualizada.
+    // deleteLater: la tarjeta puede estar en medio de su propio drag
+    for (TaskCard* card : detached) {
+        QWidget* container = card->parentWidget();
+        if (container && container->layout() && container->layout()->indexOf(card) >= 0) {
+            continue;
+        }
         
-        // Agregar tarjetas de tareas
-        for (const auto& task : tasks) {
-            TaskCard* card = new TaskCard(task, this);
-            
-            connect(card, &TaskCard::doubleClicked, this, &BoardWidget::onTaskCardClicked);
-            connect(card, &TaskCard::clicked, this, &BoardWidget::onTaskCardClicked);
-            
-            layout->insertWidget(layout->count() - 1, card);  // Antes del stretch
-            taskCards[task->getId()] = card;
+        int taskId = card->getTask()->getId();
+        auto it = taskCards.find(taskId);
+        if (it != taskCards.end() && it->second == card) {
+            taskCards.erase(it);
         }
+        card->deleteLater();
     }
+    
+    for (int taskId : dirtyCards) {
+        auto task = board->findTaskById(taskId);
+        if (!task) continue;
+        
+        auto it = taskCards.find(taskId);
+        if (it != taskCards.end()) {
+            it->second->updateTask(task);
+            continue;
+        }
+        
+        auto columnIt = stateColumns.find(task->getState());
+        if (columnIt != stateColumns.end() && columnIt->second->isVirtualized()) {
+            columnIt->second->getTaskModel()->refreshTask(taskId);
+        }
+    }
+    dirtyCards.clear();
 }
 
 void BoardWidget::onAddTaskClicked(const string& state) {
@@ -148,8 +308,17 @@ void BoardWidget::onTaskCardClicked(int taskId) {
 
 void BoardWidget::onTaskCardMoved(int taskId, const string& newState) {
     if (board) {
-        board->moveTask(taskId, newState, currentUserName);
-        refresh();
+        if (undoManager) {
+            undoManager->moveTask(board, taskId, newState, currentUserName);
+        } else {
+            board->moveTask(taskId, newState, currentUserName);
+        }
+        
+        auto task = board->findTaskById(taskId);
+        if (task && task->getState() != newState && board->hasState(newState)) {
+            QMessageBox::warning(this, "Error",
+                                 "No se puede mover la tarea: tiene dependencias sin terminar");
+        }
         emit taskMoved(taskId, newState);
     }
 }
@@ -162,22 +331,42 @@ shared_ptr<Board> BoardWidget::getBoard() const {
     return board;
 }
 
+void BoardWidget::setUndoManager(shared_ptr<UndoManager> undoManager) {
+    this->undoManager = undoManager;
+}
+
+void BoardWidget::setVirtualizationThreshold(int threshold) {
+    virtualizationThreshold = max(1, threshold);
+    refresh();
+}
+
+int BoardWidget::getVirtualizationThreshold() const {
+    return virtualizationThreshold;
+}
+
 void BoardWidget::refresh() {
-    // Limpiar todas las tarjetas
-    for (auto& pair : taskCards) {
-        delete pair.second;
-    }
-    taskCards.clear();
+    PERF_SCOPE("BoardWidget::refresh");
+    if (!board) return;
     
-    // Volver a poblar
-    populateTasks();
+    // Revisión completa: todas las columnas y el contenido de cada tarjeta
+    // (el texto de vencimiento depende de la fecha actual)
+    for (const auto& state : board->getStates()) {
+        dirtyStates.insert(state);
+    }
+    for (const auto& pair : taskCards) {
+        dirtyCards.insert(pair.first);
+    }
+    applyPendingChanges();
 }
 
 void BoardWidget::addTask(shared_ptr<Task> task) {
     if (!task || !board) return;
     
-    board->addTask(task, task->getState());
-    refresh();
+    if (undoManager) {
+        undoManager->addTask(board, task, task->getState());
+    } else {
+        board->addTask(task, task->getState());
+    }
 }
 
 void BoardWidget::updateTask(shared_ptr<Task> task) {
@@ -186,20 +375,18 @@ void BoardWidget::updateTask(shared_ptr<Task> task) {
     auto it = taskCards.find(task->getId());
     if (it != taskCards.end()) {
         it->second->updateTask(task);
+    } else {
+        markCardDirty(task->getId());  // Puede estar en una columna virtualizada
     }
 }
 
 void BoardWidget::removeTask(int taskId) {
     if (!board) return;
     
-    board->removeTask(taskId);
-    
-    auto it = taskCards.find(taskId);
-    if (it != taskCards.end()) {
-        delete it->second;
-        taskCards.erase(it);
+    if (undoManager) {
+        undoManager->removeTask(board, taskId);
+    } else {
+        board->removeTask(taskId);
     }
-    
-    refresh();
 }
 
@@ -0,0 +1,195 @@
+#include "ui/CardRenderer.h"
+#include "ui/TaskCard.h"
+#include "utils/DateUtils.h"
+#include "utils/PerfMonitor.h"
+#include <QApplication>
+#include <QFontMetrics>
+#include <QImage>
+#include <QPainterPath>
+#include <QPixmapCache>
+#include <qdrawutil.h>
+#include <algorithm>
+
+using namespace std;
+
+// Constructor
+CardRenderer::CardRenderer(const QFont& baseFont)
+    : titleFont(baseFont), infoFont(baseFont) {
+    titleFont.setPointSize(11);
+    infoFont.setPointSize(9);
+    
+    // Título + información + tags + barra de prioridad
+    QFontMetrics titleMetrics(titleFont);
+    QFontMetrics infoMetrics(infoFont);
+    cardHeight = MARGIN + titleMetrics.height() + SPACING +
+                 MAX_INFO_LINES * infoMetrics.height() + SPACING +
+                 infoMetrics.height() + SPACING + 4 + MARGIN;
+    
+    // El límite por defecto (10 MB) no alcanza para las tarjetas de una pantalla grande
+    QPixmapCache::setCacheLimit(max(QPixmapCache::cacheLimit(), CACHE_LIMIT_KB));
+}
+
+const CardRenderer& CardRenderer::instance() {
+    static CardRenderer renderer(QApplication::font());
+    return renderer;
+}
+
+// Estilo compartido: el mismo para todas las tarjetas, por estado visual
+const CardRenderer::Style& CardRenderer::getStyle(State state) {
+    static const Style styles[static_cast<int>(State::COUNT)] = {
+        {QColor("#ffffff"), QColor("#e0e0e0"), 1, QColor(0, 0, 0, 8), 4, 1},       // NORMAL
+        {QColor("#f5f5f5"), QColor("#0078d4"), 2, QColor(0, 0, 0, 25), 12, 4},     // HOVER
+        {QColor("#ffffff"), QColor("#0078d4"), 2, QColor(0, 0, 0, 8), 4, 1},       // SELECTED
+        {QColor("#fff8e1"), QColor("#FFA500"), 2, QColor(255, 165, 0, 60), 12, 4}  // HIGHLIGHTED
+    };
+    return styles[static_cast<int>(state)];
+}
+
+// Medidas
+int CardRenderer::getHeight() const {
+    return cardHeight + 2 * SHADOW_MARGIN;
+}
+
+// Sombra
+QPixmap CardRenderer::getShadow(State state) {
+    QString key = QStringLiteral("card-shadow:%1").arg(static_cast<int>(state));
+    QPixmap pixmap;
+    if (QPixmapCache::find(key, &pixmap)) {
+        return pixmap;
+    }
+    
+    // Nine-patch: cuatro esquinas y un píxel central por lado que se estira
+    const Style& style = getStyle(state);
+    int corner = SHADOW_MARGIN + RADIUS;
+    int side = 2 * corner + 1;
+    
+    QImage image(side, side, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    
+    // Desenfoque aproximado con capas concéntricas: el alfa se acumula
+    // hacia el borde de la tarjeta
+    int layers = min(style.shadowBlur, SHADOW_MARGIN);
+    int offset = min(style.shadowOffset, SHADOW_MARGIN - 1);
+    QColor color = style.shadow;
+    color.setAlpha(max(1, style.shadow.alpha() / max(1, layers)));
+    painter.setBrush(color);
+    
+    QRectF card(SHADOW_MARGIN, SHADOW_MARGIN + offset, side - 2 * SHADOW_MARGIN,
+                side - 2 * SHADOW_MARGIN);
+    for (int i = layers; i >= 1; --i) {
+        painter.drawRoundedRect(card.adjusted(-i, -i, i, i), RADIUS + i, RADIUS + i);
+    }
+    painter.end();
+    
+    pixmap = QPixmap::fromImage(image);
+    QPixmapCache::insert(key, pixmap);
+    return pixmap;
+}
+
+// Tarjeta
+QPixmap CardRenderer::getCardPixmap(const Task& task, const QSize& size, State state,
+                                    qreal dpr) const {
+    // El texto de vencimiento depende del día y de si la tarea ya venció
+    auto today = DateUtils::startOfDay(chrono::system_clock::now()).time_since_epoch();
+    QString key = QStringLiteral("card:%1:%2x%3:%4:%5:%6:%7")
+                      .arg(static_cast<qulonglong>(task.getContentVersion()))
+                      .arg(size.width())
+                      .arg(size.height())
+                      .arg(static_cast<int>(state))
+                      .arg(dpr)
+                      .arg(static_cast<qlonglong>(chrono::duration_cast<chrono::hours>(today).count()))
+                      .arg(task.isOverdue() ? 1 : 0);
+    
+    QPixmap pixmap;
+    if (QPixmapCache::find(key, &pixmap)) {
+        return pixmap;
+    }
+    
+    PERF_SCOPE("CardRenderer::renderCard");
+    pixmap = QPixmap(size * dpr);
+    pixmap.setDevicePixelRatio(dpr);
+    pixmap.fill(Qt::transparent);
+    
+    QPainter painter(&pixmap);
+    paintCard(&painter, QRect(QPoint(0, 0), size), task, state);
+    painter.end();
+    
+    QPixmapCache::insert(key, pixmap);
+    return pixmap;
+}
+
+void CardRenderer::paintCard(QPainter* painter, const QRect& card, const Task& task,
+                             State state) const {
+    const Style& style = getStyle(state);
+    painter->setRenderHint(QPainter::Antialiasing);
+    
+    // Fondo y borde
+    qreal inset = style.borderWidth / 2.0;
+    QPainterPath path;
+    path.addRoundedRect(QRectF(card).adjusted(inset, inset, -inset, -inset), RADIUS, RADIUS);
+    painter->fillPath(path, style.background);
+    painter->setPen(QPen(style.border, style.borderWidth));
+    painter->drawPath(path);
+    
+    QRect content = card.adjusted(MARGIN, MARGIN, -MARGIN, -MARGIN);
+    int y = content.top();
+    
+    // Título
+    QFontMetrics titleMetrics(titleFont);
+    painter->setFont(titleFont);
+    painter->setPen(QColor("#1a1a1a"));
+    QString title = QString::fromStdString(task.getTitle());
+    painter->drawText(QRect(content.left(), y, content.width(), titleMetrics.height()),
+                      Qt::AlignLeft | Qt::AlignVCenter,
+                      titleMetrics.elidedText(title, Qt::ElideRight, content.width()));
+    y += titleMetrics.height() + SPACING;
+    
+    // Información, una línea por dato
+    QFontMetrics infoMetrics(infoFont);
+    painter->setFont(infoFont);
+    painter->setPen(QColor("#666666"));
+    QStringList lines = TaskCard::getInfoText(task).split('\n');
+    for (int i = 0; i < lines.size() && i < MAX_INFO_LINES; ++i) {
+        painter->drawText(QRect(content.left(), y, content.width(), infoMetrics.height()),
+                          Qt::AlignLeft | Qt::AlignVCenter,
+                          infoMetrics.elidedText(lines[i], Qt::ElideRight, content.width()));
+        y += infoMetrics.height();
+    }
+    y = content.top() + titleMetrics.height() + SPACING +
+        MAX_INFO_LINES * infoMetrics.height() + SPACING;
+    
+    // Tags
+    QString tags = TaskCard::getTagsText(task);
+    if (!tags.isEmpty()) {
+        QRect tagsRect(content.left(), y, content.width(), infoMetrics.height());
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(QColor("#f0f0f0"));
+        painter->drawRoundedRect(tagsRect, 4, 4);
+        painter->setPen(QColor("#4a4a4a"));
+        painter->drawText(tagsRect.adjusted(8, 0, -8, 0), Qt::AlignLeft | Qt::AlignVCenter,
+                          infoMetrics.elidedText(tags, Qt::ElideRight, tagsRect.width() - 16));
+    }
+    
+    // Indicador de prioridad
+    QRect priorityRect(content.left(), content.bottom() - 3, content.width(), 4);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QColor(TaskCard::getPriorityColor(task)));
+    painter->drawRoundedRect(priorityRect, 2, 2);
+}
+
+// Dibujo
+void CardRenderer::paint(QPainter* painter, const QRect& rect, const Task& task,
+                         State state) const {
+    QRect card = rect.adjusted(SHADOW_MARGIN, SHADOW_MARGIN, -SHADOW_MARGIN, -SHADOW_MARGIN);
+    if (card.isEmpty()) return;
+    
+    int corner = SHADOW_MARGIN + RADIUS;
+    qDrawBorderPixmap(painter, rect, QMargins(corner, corner, corner, corner), getShadow(state));
+    
+    qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+    painter->drawPixmap(card.topLeft(), getCardPixmap(task, card.size(), state, dpr));
+}
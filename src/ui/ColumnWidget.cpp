@@ -1,11 +1,12 @@
 #include "ui/ColumnWidget.h"
+#include "ui/TaskCardDelegate.h"
 #include <QGraphicsDropShadowEffect>
 #include <QMimeData>
 
 using namespace std;
 
 ColumnWidget::ColumnWidget(const string& stateName, QWidget *parent)
-    : QWidget(parent), stateName(stateName), isHighlighted(false) {
+    : QWidget(parent), stateName(stateName), isHighlighted(false), virtualized(false) {
     setupUI();
     setAcceptDrops(true);
 }
@@ -74,7 +75,7 @@ void ColumnWidget::setupUI() {
     tasksContainer->setStyleSheet("QWidget { background-color: transparent; }");
     
     tasksLayout = new QVBoxLayout(tasksContainer);
-    tasksLayout->setSpacing(8);
+    tasksLayout->setSpacing(0);  // Las tarjetas ya dejan margen para su sombra
     tasksLayout->setContentsMargins(4, 4, 4, 4);
     tasksLayout->addStretch();
     
@@ -83,6 +84,9 @@ void ColumnWidget::setupUI() {
     
     mainLayout->addWidget(scrollArea, 1);
     
+    setupListView();
+    mainLayout->addWidget(listView, 1);
+    
     // Botón para agregar tarea - minimalista
     addButton = new QPushButton("+ Añadir tarea");
     addButton->setCursor(Qt::PointingHandCursor);
@@ -117,7 +121,7 @@ void ColumnWidget::setupUI() {
     setMaximumWidth(320);
     
     updateHighlight(false);
-
+    
     QGraphicsDropShadowEffect* shadow = new QGraphicsDropShadowEffect(this);
     shadow->setBlurRadius(12);
     shadow->setOffset(0, 4);
@@ -125,6 +129,69 @@ void ColumnWidget::setupUI() {
     setGraphicsEffect(shadow);
 }
 
+void ColumnWidget::setupListView() {
+    taskModel = new TaskListModel(this);
+    
+    listView = new QListView();
+    listView->setModel(taskModel);
+    listView->setItemDelegate(new TaskCardDelegate(listView));
+    
+    // Filas de igual alto: el scroll no mide cada fila
+    listView->setUniformItemSizes(true);
+    listView->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    listView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    listView->setSelectionMode(QAbstractItemView::SingleSelection);
+    listView->setFrameShape(QFrame::NoFrame);
+    listView->setMouseTracking(true);  // Hover en el delegate
+    listView->setCursor(Qt::PointingHandCursor);
+    
+    // Solo arrastrar: los drops siguen llegando a la columna (dropEvent)
+    listView->setDragDropMode(QAbstractItemView::DragOnly);
+    listView->setDefaultDropAction(Qt::MoveAction);
+    listView->setAcceptDrops(false);
+    listView->viewport()->setAcceptDrops(false);
+    
+    listView->setStyleSheet(
+        "QListView { "
+        "  border: none; "
+        "  background: transparent; "
+        "}"
+        "QScrollBar:vertical {"
+        "  border: none;"
+        "  background: #f0f0f0;"
+        "  width: 6px;"
+        "  border-radius: 3px;"
+        "}"
+        "QScrollBar::handle:vertical {"
+        "  background: #c0c0c0;"
+        "  border-radius: 3px;"
+        "  min-height: 30px;"
+        "}"
+        "QScrollBar::handle:vertical:hover {"
+        "  background: #a0a0a0;"
+        "}"
+    );
+    
+    // Un clic abre la tarea, como en TaskCard
+    connect(listView, &QListView::clicked, [this](const QModelIndex& index) {
+        emit taskActivated(index.data(TaskListModel::TaskIdRole).toInt());
+    });
+    
+    listView->hide();
+}
+
+void ColumnWidget::setVirtualized(bool enabled) {
+    if (enabled == virtualized) return;
+    
+    virtualized = enabled;
+    scrollArea->setVisible(!enabled);
+    listView->setVisible(enabled);
+    
+    if (!enabled) {
+        taskModel->setTasks({});
+    }
+}
+
 void ColumnWidget::updateHighlight(bool highlight) {
     isHighlighted = highlight;
     
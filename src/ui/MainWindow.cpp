@@ -1,6 +1,7 @@
 #include "ui/MainWindow.h"
 #include "ui/ProjectDialog.h"
 #include "ui/TaskDialog.h"
+#include "utils/DateUtils.h"
 #include <QMenuBar>
 #include <QToolBar>
 #include <QStatusBar>
@@ -8,6 +9,9 @@
 #include <QCloseEvent>
 #include <QFileDialog>
 #include <QInputDialog>
+#include <QSignalBlocker>
+#include <QVBoxLayout>
+#include <algorithm>
 
 using namespace std;
 
@@ -18,6 +22,11 @@ MainWindow::MainWindow(QWidget *parent)
     projectManager = ProjectManager::getInstance();
     notificationManager = make_shared<NotificationManager>();
     dataPersistence = make_shared<DataPersistence>("data");
+    flowMetrics = make_shared<FlowMetricsManager>();
+    cycleTimes = make_shared<CycleTimeManager>();
+    forecaster = make_shared<ForecastManager>();
+    workloadManager = make_shared<WorkloadManager>();
+    undoManager = make_shared<UndoManager>();
     
     setupUI();
     createMenus();
@@ -29,6 +38,36 @@ MainWindow::MainWindow(QWidget *parent)
     connect(autoSaveTimer, &QTimer::timeout, this, &MainWindow::onAutoSave);
     autoSaveTimer->start(300000);  // 5 minutos en milisegundos
     
+    // Avisos de vencimiento: el timer se rearma cuando aparece uno más próximo
+    dueDateTimer = new QTimer(this);
+    dueDateTimer->setSingleShot(true);
+    connect(dueDateTimer, &QTimer::timeout, this, &MainWindow::onDueDateTimer);
+    notificationManager->getDueDateScheduler()->setDeadlineCallback(
+        [this](const chrono::system_clock::time_point&) { armDueDateTimer(); });
+    
+    // Monitor de rendimiento: el latido mide cuánto se atrasa el ciclo de
+    // eventos; solo corre con el monitor activo
+    perfOverlay = new PerfOverlay(this);
+    perfHeartbeat = new QTimer(this);
+    perfHeartbeat->setInterval(PERF_HEARTBEAT_MS);
+    connect(perfHeartbeat, &QTimer::timeout, this, &MainWindow::onPerfHeartbeat);
+    
+    // Notificaciones en lotes: el hilo de entrega solo encola la actualización
+    // de la interfaz en el hilo principal
+    notificationManager->setBatchCallback([this](const vector<Notification>& batch) {
+        QString summary = batch.size() == 1
+            ? QString::fromStdString(batch.front().title)
+            : QString("%1 notificaciones nuevas").arg(batch.size());
+        QMetaObject::invokeMethod(this, [this, summary]() {
+            updateNotificationBadge();
+            statusLabel->setText("🔔 " + summary);
+        }, Qt::QueuedConnection);
+    });
+    
+    // Notificaciones de sesiones anteriores
+    dataPersistence->loadNotifications(notificationManager);
+    updateNotificationBadge();
+    
     updateWindowTitle();
     
     // Intentar cargar proyecto guardado
@@ -61,7 +100,10 @@ MainWindow::MainWindow(QWidget *parent)
     loadProject(project);
 }
 
-MainWindow::~MainWindow() {}
+MainWindow::~MainWindow() {
+    // Detener el hilo de entrega mientras la ventana sigue completa
+    notificationManager->setBatchCallback(nullptr);
+}
 
 void MainWindow::setupUI() {
     setWindowTitle("Sistema de Gestión de Tareas y Proyectos");
@@ -192,6 +234,21 @@ void MainWindow::createMenus() {
     exitAction->setShortcut(QKeySequence::Quit);
     connect(exitAction, &QAction::triggered, this, &MainWindow::onExit);
     
+    // Menú Editar
+    QMenu* editMenu = menuBar->addMenu("&Editar");
+    
+    undoAction = editMenu->addAction("&Deshacer");
+    undoAction->setShortcut(QKeySequence::Undo);
+    connect(undoAction, &QAction::triggered, this, &MainWindow::onUndo);
+    
+    redoAction = editMenu->addAction("&Rehacer");
+    redoAction->setShortcut(Qt::CTRL | Qt::SHIFT | Qt::Key_Z);
+    connect(redoAction, &QAction::triggered, this, &MainWindow::onRedo);
+    
+    // Las acciones no se deshabilitan para que los atajos sigan activos;
+    // al abrir el menú se muestra qué paso se va a deshacer
+    connect(editMenu, &QMenu::aboutToShow, this, &MainWindow::updateUndoActions);
+    
     // Menú Proyecto
     QMenu* projectMenu = menuBar->addMenu("&Proyecto");
     
@@ -220,6 +277,16 @@ void MainWindow::createMenus() {
     QAction* usersAction = viewMenu->addAction("&Usuarios");
     connect(usersAction, &QAction::triggered, this, &MainWindow::onShowUsers);
     
+    viewMenu->addSeparator();
+    
+    QAction* perfAction = viewMenu->addAction("Monitor de &rendimiento");
+    perfAction->setCheckable(true);
+    perfAction->setShortcut(Qt::Key_F12);
+    connect(perfAction, &QAction::toggled, this, &MainWindow::onTogglePerfMonitor);
+    
+    QAction* perfDumpAction = viewMenu->addAction("&Volcar métricas de rendimiento...");
+    connect(perfDumpAction, &QAction::triggered, this, &MainWindow::onDumpPerfMetrics);
+    
     // Menú Ayuda
     QMenu* helpMenu = menuBar->addMenu("A&yuda");
     
@@ -371,8 +438,7 @@ void MainWindow::onCloseProject() {
     onSaveProject();
     
     // Limpiar tabs
-    tabWidget->clear();
-    boardWidgets.clear();
+    clearBoardTabs();
     
     statusLabel->setText("Proyecto cerrado");
     updateWindowTitle();
@@ -397,36 +463,10 @@ void MainWindow::onNewBoard() {
     
     if (ok && !name.isEmpty()) {
         auto board = project->createBoard(name.toStdString());
+        notificationManager->getDueDateScheduler()->watchBoard(board);
         
-        // Crear widget y tab
-        BoardWidget* boardWidget = new BoardWidget(board, currentUserName, this);
-        tabWidget->addTab(boardWidget, name);
-        boardWidgets[board->getId()] = boardWidget;
-        
-        // Conectar señales
-        connect(boardWidget, &BoardWidget::taskSelected, 
-                [this, board, project](int taskId) {
-                    auto task = board->findTaskById(taskId);
-                    if (task) {
-                        TaskDialog dialog(board, project, task, this);
-                        if (dialog.exec() == QDialog::Accepted) {
-                            refreshCurrentView();
-                        }
-                    }
-                });
-        
-        connect(boardWidget, &BoardWidget::newTaskRequested,
-                [this, board, project](const string& state) {
-                    TaskDialog dialog(board, project, nullptr, this);
-                    if (dialog.exec() == QDialog::Accepted) {
-                        auto task = dialog.getTask();
-                        if (task) {
-                            task->setState(state, currentUserName);
-                            board->addTask(task, state);
-                            refreshCurrentView();
-                        }
-                    }
-                });
+        // El widget se construye al abrir el tab
+        createBoardTab(board);
         
         statusLabel->setText("Tablero creado: " + name);
     }
@@ -441,23 +481,20 @@ void MainWindow::onNewTask() {
     }
     
     // Obtener el board actual
-    int currentIndex = tabWidget->currentIndex();
-    if (currentIndex < 0) {
+    BoardWidget* boardWidget = currentBoardWidget();
+    if (!boardWidget) {
         QMessageBox::warning(this, "Error", "No hay tablero seleccionado");
         return;
     }
     
-    BoardWidget* boardWidget = qobject_cast<BoardWidget*>(tabWidget->widget(currentIndex));
-    if (boardWidget) {
-        auto board = boardWidget->getBoard();
-        TaskDialog dialog(board, project, nullptr, this);
-        
-        if (dialog.exec() == QDialog::Accepted) {
-            auto task = dialog.getTask();
-            if (task) {
-                boardWidget->addTask(task);
-                statusLabel->setText("Tarea creada exitosamente");
-            }
+    auto board = boardWidget->getBoard();
+    TaskDialog dialog(board, project, nullptr, this);
+    
+    if (dialog.exec() == QDialog::Accepted) {
+        auto task = dialog.getTask();
+        if (task) {
+            boardWidget->addTask(task);
+            statusLabel->setText("Tarea creada exitosamente");
         }
     }
 }
@@ -513,13 +550,47 @@ void MainWindow::onShowStatistics() {
             stats += "    " + QString::fromStdString(state) + ": " + 
                     QString::number(board->getTaskCountByState(state)) + "\n";
         }
+        
+        // Throughput y burndown a partir del registro de actividad
+        if (!flowMetrics->isTracking(board->getId())) {
+            flowMetrics->rebuild(board);
+        }
+        const auto& series = flowMetrics->getSeries(board->getId());
+        if (series.getBucketCount() > 0) {
+            size_t buckets = series.getBucketCount();
+            int lastWeek = 0;
+            for (size_t b = (buckets > 7 ? buckets - 7 : 0); b < buckets; ++b) {
+                lastWeek += series.throughput[b];
+            }
+            stats += "  Terminadas últimos 7 días: " + QString::number(lastWeek) + "\n";
+            stats += "  Pendientes hoy: " + QString::number(series.remaining.back()) + "\n";
+        }
+        
+        // Lead time (creación → Terminado)
+        auto leadTime = cycleTimes->getLeadTime(board->getId());
+        if (leadTime.count > 0) {
+            stats += "  Lead time p50/p85/p95: " +
+                    QString::number(leadTime.p50Hours, 'f', 1) + " / " +
+                    QString::number(leadTime.p85Hours, 'f', 1) + " / " +
+                    QString::number(leadTime.p95Hours, 'f', 1) + " h\n";
+        }
+        
+        // Pronóstico de entrega de las tareas abiertas
+        auto forecast = forecaster->forecast(board);
+        if (forecast.valid && forecast.taskCount > 0) {
+            stats += "  Entrega estimada (85%): " +
+                    QString::fromStdString(DateUtils::toDateString(forecast.p85Date)) + "\n";
+        }
     }
     
     QMessageBox::information(this, "Estadísticas", stats);
 }
 
 void MainWindow::onShowNotifications() {
-    auto notifications = notificationManager->getNotificationsByUser(currentUserId);
+    // Solo la página más reciente; las anteriores siguen disponibles
+    const size_t pageSize = 50;
+    auto notifications = notificationManager->getNotificationsPage(currentUserId, 0, pageSize);
+    size_t total = notificationManager->getNotificationCount(currentUserId);
     
     QString text = "=== Notificaciones ===\n\n";
     
@@ -529,10 +600,18 @@ void MainWindow::onShowNotifications() {
         for (const auto& notif : notifications) {
             text += QString::fromStdString(notif.toString()) + "\n\n";
         }
+        if (total > notifications.size()) {
+            text += QString("Mostrando las %1 más recientes de %2")
+                        .arg(notifications.size()).arg(total);
+        }
     }
     
     QMessageBox::information(this, "Notificaciones", text);
-    notificationManager->markAllAsRead(currentUserId);
+    
+    // Marcar como leídas solo las que se mostraron
+    for (const auto& notif : notifications) {
+        notificationManager->markAsRead(notif.id);
+    }
     updateNotificationBadge();
 }
 
@@ -546,12 +625,28 @@ void MainWindow::onShowUsers() {
     
     QString text = "=== Usuarios del Proyecto ===\n\n";
     
-    for (const auto& user : project->getAllUsers()) {
-        text += QString::fromStdString(user->toString()) + "\n";
+    // Carga de todos los usuarios en una sola pasada
+    auto report = workloadManager->buildReport(project);
+    auto users = project->getAllUsers();
+    
+    for (size_t i = 0; i < users.size(); ++i) {
+        const auto& workload = report.users[i];
+        text += QString::fromStdString(users[i]->toString()) + "\n";
+        text += "  Tareas abiertas: " + QString::number(workload.openTasks) +
+                "  (carga " + QString::number(workload.load, 'f', 1) + ")\n\n";
+    }
+    
+    if (!report.suggestions.empty()) {
+        text += "=== Sugerencias de asignación (" +
+                QString::number(report.unassignedTasks) + " sin asignar) ===\n";
         
-        // Contar tareas asignadas
-        auto tasks = project->findTasksByUser(user->getId());
-        text += "  Tareas asignadas: " + QString::number(tasks.size()) + "\n\n";
+        const size_t maxShown = 10;
+        for (size_t i = 0; i < report.suggestions.size() && i < maxShown; ++i) {
+            const auto& suggestion = report.suggestions[i];
+            auto user = project->findUserById(suggestion.userId);
+            text += "  Tarea " + QString::number(suggestion.taskId) + " → " +
+                    QString::fromStdString(user ? user->getName() : "") + "\n";
+        }
     }
     
     QMessageBox::information(this, "Usuarios", text);
@@ -590,71 +685,243 @@ void MainWindow::onAutoSave() {
             statusLabel->setStyleSheet("color: #5e6c84; padding: 4px; font-size: 9pt;");
         }
     }
+    
+    notificationManager->expireNotifications();
+    dataPersistence->saveNotifications(notificationManager);
+}
+
+void MainWindow::onDueDateTimer() {
+    if (notificationManager->processDueDates() > 0) {
+        updateNotificationBadge();
+    }
+    armDueDateTimer();
+}
+
+void MainWindow::armDueDateTimer() {
+    auto next = notificationManager->getNextDueDateCheck();
+    if (next == chrono::system_clock::time_point::max()) {
+        dueDateTimer->stop();
+        return;
+    }
+    
+    // Como máximo una hora: el reloj del sistema puede saltar (suspensión, ajustes)
+    auto wait = chrono::duration_cast<chrono::milliseconds>(next - chrono::system_clock::now());
+    qint64 ms = max<qint64>(0, min<qint64>(wait.count(), 3600000));
+    dueDateTimer->start(static_cast<int>(ms));
+}
+
+void MainWindow::onTogglePerfMonitor(bool enabled) {
+    PerfMonitor::instance().setEnabled(enabled);
+    
+    if (enabled) {
+        lastHeartbeat = chrono::steady_clock::now();
+        perfHeartbeat->start();
+        perfOverlay->show();
+    } else {
+        perfHeartbeat->stop();
+        perfOverlay->hide();
+    }
+}
+
+void MainWindow::onPerfHeartbeat() {
+    auto now = chrono::steady_clock::now();
+    PerfMonitor::instance().recordFrame(now - lastHeartbeat);
+    lastHeartbeat = now;
+}
+
+void MainWindow::onDumpPerfMetrics() {
+    QString filePath = QFileDialog::getSaveFileName(this, "Volcar métricas de rendimiento",
+                                                    "rendimiento.txt",
+                                                    "Texto (*.txt);;Todos (*)");
+    if (filePath.isEmpty()) return;
+    
+    if (PerfMonitor::instance().dump(filePath.toStdString())) {
+        statusLabel->setText("Métricas guardadas en " + filePath);
+    } else {
+        QMessageBox::warning(this, "Error", "No se pudieron guardar las métricas");
+    }
 }
 
 void MainWindow::onTabChanged(int index) {
     if (index >= 0) {
+        if (BoardWidget* boardWidget = ensureBoardWidget(index)) {
+            touchBoard(boardWidget->getBoard()->getId());
+        }
         statusLabel->setText("Vista cambiada");
     }
 }
 
+// Tabs de tableros
+int MainWindow::createBoardTab(shared_ptr<Board> board) {
+    QWidget* page = new QWidget();
+    QVBoxLayout* layout = new QVBoxLayout(page);
+    layout->setContentsMargins(0, 0, 0, 0);
+    page->setProperty("boardId", board->getId());
+    
+    return tabWidget->addTab(page, QString::fromStdString(board->getName()));
+}
+
+void MainWindow::clearBoardTabs() {
+    // Sin señales: quitar un tab cambia el actual y construiría el siguiente
+    QSignalBlocker blocker(tabWidget);
+    while (tabWidget->count() > 0) {
+        QWidget* page = tabWidget->widget(0);
+        tabWidget->removeTab(0);
+        page->deleteLater();
+    }
+    
+    boardWidgets.clear();
+    recentBoards.clear();
+}
+
+BoardWidget* MainWindow::currentBoardWidget() {
+    int index = tabWidget->currentIndex();
+    return index >= 0 ? ensureBoardWidget(index) : nullptr;
+}
+
+BoardWidget* MainWindow::ensureBoardWidget(int index) {
+    auto project = projectManager->getCurrentProject();
+    QWidget* page = tabWidget->widget(index);
+    if (!project || !page) return nullptr;
+    
+    int boardId = page->property("boardId").toInt();
+    auto it = boardWidgets.find(boardId);
+    if (it != boardWidgets.end()) {
+        return it->second;
+    }
+    
+    auto board = project->findBoardById(boardId);
+    if (!board) return nullptr;
+    
+    BoardWidget* boardWidget = new BoardWidget(board, currentUserName, page);
+    boardWidget->setUndoManager(undoManager);
+    page->layout()->addWidget(boardWidget);
+    boardWidgets[boardId] = boardWidget;
+    
+    // Conectar señales
+    connect(boardWidget, &BoardWidget::taskSelected,
+            [this, board, project, boardWidget](int taskId) {
+                auto task = board->findTaskById(taskId);
+                if (task) {
+                    TaskDialog dialog(board, project, task, this);
+                    dialog.setUndoManager(undoManager);
+                    if (dialog.exec() == QDialog::Accepted) {
+                        // Los cambios de subtareas no pasan por la tarea ni por el bus
+                        task->touch();
+                        boardWidget->updateTask(task);
+                    }
+                }
+            });
+    
+    connect(boardWidget, &BoardWidget::newTaskRequested,
+            [this, board, project](const string& state) {
+                TaskDialog dialog(board, project, nullptr, this);
+                if (dialog.exec() == QDialog::Accepted) {
+                    auto task = dialog.getTask();
+                    if (task) {
+                        task->setState(state, currentUserName);
+                        undoManager->addTask(board, task, state);
+                    }
+                }
+            });
+    
+    return boardWidget;
+}
+
+void MainWindow::touchBoard(int boardId) {
+    recentBoards.remove(boardId);
+    recentBoards.push_front(boardId);
+    
+    // Los tableros que salen de la lista liberan todo su árbol de widgets;
+    // el tab queda vacío y se reconstruye si se vuelve a abrir
+    while (recentBoards.size() > MAX_LIVE_BOARDS) {
+        auto it = boardWidgets.find(recentBoards.back());
+        if (it != boardWidgets.end()) {
+            it->second->deleteLater();
+            boardWidgets.erase(it);
+        }
+        recentBoards.pop_back();
+    }
+}
+
 void MainWindow::setCurrentUser(int userId, const string& userName) {
     currentUserId = userId;
     currentUserName = userName;
 }
 
 void MainWindow::loadProject(shared_ptr<Project> project) {
+    PERF_SCOPE("MainWindow::loadProject");
     if (!project) return;
     
     projectManager->setCurrentProject(project);
     
-    // Limpiar tabs existentes
-    tabWidget->clear();
-    boardWidgets.clear();
+    // Liberar los tabs del proyecto anterior
+    clearBoardTabs();
+    undoManager->clear();
+    
+    // Vencimientos del nuevo proyecto
+    notificationManager->getDueDateScheduler()->clear();
+    notificationManager->watchProject(project);
     
-    // Agregar tabs para cada tablero
+    // Las métricas de flujo se reconstruyen al consultarlas y desde ahí
+    // siguen los eventos del proyecto
+    flowMetrics->clear();
+    flowMetrics->attach(project->getEventBus());
+    
+    // Los tiempos de ciclo recorren el historial una sola vez, al cargar
+    cycleTimes->clear();
     for (const auto& board : project->getBoards()) {
-        BoardWidget* boardWidget = new BoardWidget(board, currentUserName, this);
-        tabWidget->addTab(boardWidget, QString::fromStdString(board->getName()));
-        boardWidgets[board->getId()] = boardWidget;
-        
-        // Conectar señales
-        connect(boardWidget, &BoardWidget::taskSelected,
-                [this, board, project](int taskId) {
-                    auto task = board->findTaskById(taskId);
-                    if (task) {
-                        TaskDialog dialog(board, project, task, this);
-                        if (dialog.exec() == QDialog::Accepted) {
-                            refreshCurrentView();
-                        }
-                    }
-                });
-        
-        connect(boardWidget, &BoardWidget::newTaskRequested,
-                [this, board, project](const string& state) {
-                    TaskDialog dialog(board, project, nullptr, this);
-                    if (dialog.exec() == QDialog::Accepted) {
-                        auto task = dialog.getTask();
-                        if (task) {
-                            task->setState(state, currentUserName);
-                            board->addTask(task, state);
-                            refreshCurrentView();
-                        }
-                    }
-                });
+        cycleTimes->rebuild(board);
+    }
+    cycleTimes->attach(project->getEventBus());
+    
+    // Un tab por tablero; solo se construye el que queda abierto
+    for (const auto& board : project->getBoards()) {
+        createBoardTab(board);
     }
     
     updateWindowTitle();
     statusLabel->setText("Proyecto cargado: " + QString::fromStdString(project->getName()));
+    
+    // Los avisos ya vencidos se emiten en la próxima vuelta del ciclo de eventos
+    dueDateTimer->start(0);
+}
+
+void MainWindow::onUndo() {
+    string description = undoManager->getUndoDescription();
+    if (undoManager->undo()) {
+        statusLabel->setText("Deshecho: " + QString::fromStdString(description));
+    } else {
+        statusLabel->setText("Nada que deshacer");
+    }
+}
+
+void MainWindow::onRedo() {
+    string description = undoManager->getRedoDescription();
+    if (undoManager->redo()) {
+        statusLabel->setText("Rehecho: " + QString::fromStdString(description));
+    } else {
+        statusLabel->setText("Nada que rehacer");
+    }
+}
+
+void MainWindow::updateUndoActions() {
+    QString undoText = "&Deshacer";
+    if (undoManager->canUndo()) {
+        undoText += " " + QString::fromStdString(undoManager->getUndoDescription());
+    }
+    undoAction->setText(undoText);
+    
+    QString redoText = "&Rehacer";
+    if (undoManager->canRedo()) {
+        redoText += " " + QString::fromStdString(undoManager->getRedoDescription());
+    }
+    redoAction->setText(redoText);
 }
 
 void MainWindow::refreshCurrentView() {
-    int currentIndex = tabWidget->currentIndex();
-    if (currentIndex >= 0) {
-        BoardWidget* boardWidget = qobject_cast<BoardWidget*>(tabWidget->widget(currentIndex));
-        if (boardWidget) {
-            boardWidget->refresh();
-        }
+    if (BoardWidget* boardWidget = currentBoardWidget()) {
+        boardWidget->refresh();
     }
 }
 
@@ -680,5 +947,10 @@ void MainWindow::closeEvent(QCloseEvent *event) {
     } else {
         event->accept();
     }
+    
+    // Las notificaciones se guardan siempre al salir
+    if (event->isAccepted()) {
+        dataPersistence->saveNotifications(notificationManager);
+    }
 }
 
@@ -0,0 +1,137 @@
+#include "ui/PerfOverlay.h"
+#include <QPainter>
+#include <QFontMetrics>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+PerfOverlay::PerfOverlay(QWidget *parent)
+    : QWidget(parent), snapshot(PerfMonitor::instance().getSnapshot(MAX_OPERATIONS)) {
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setFixedSize(380, 300);
+    
+    refreshTimer = new QTimer(this);
+    refreshTimer->setInterval(REFRESH_INTERVAL_MS);
+    connect(refreshTimer, &QTimer::timeout, this, &PerfOverlay::onRefresh);
+    
+    hide();
+}
+
+PerfOverlay::~PerfOverlay() {}
+
+void PerfOverlay::reposition() {
+    if (QWidget* container = parentWidget()) {
+        move(container->width() - width() - 16, 80);
+    }
+}
+
+void PerfOverlay::onRefresh() {
+    snapshot = PerfMonitor::instance().getSnapshot(MAX_OPERATIONS);
+    reposition();
+    raise();
+    update();
+}
+
+void PerfOverlay::showEvent(QShowEvent *event) {
+    onRefresh();
+    refreshTimer->start();
+    QWidget::showEvent(event);
+}
+
+void PerfOverlay::hideEvent(QHideEvent *event) {
+    refreshTimer->stop();
+    QWidget::hideEvent(event);
+}
+
+void PerfOverlay::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event);
+    
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(20, 20, 20, 215));
+    painter.drawRoundedRect(rect(), 8, 8);
+    
+    QFont font = painter.font();
+    font.setPointSize(9);
+    painter.setFont(font);
+    QFontMetrics metrics(font);
+    int lineHeight = metrics.height();
+    int left = 12;
+    int contentWidth = width() - 2 * left;
+    int y = 10;
+    
+    // Resumen de frames
+    painter.setPen(Qt::white);
+    painter.drawText(left, y + metrics.ascent(),
+                     QString("Frames: %1  p50 %2 ms  p95 %3 ms  máx %4 ms")
+                         .arg(snapshot.frameCount)
+                         .arg(snapshot.frameP50Ms, 0, 'f', 1)
+                         .arg(snapshot.frameP95Ms, 0, 'f', 1)
+                         .arg(snapshot.frameMaxMs, 0, 'f', 0));
+    y += lineHeight;
+    
+    painter.setPen(snapshot.stalls.empty() ? QColor("#9e9e9e") : QColor("#ff8a65"));
+    QString stallText = QString("Bloqueos: %1").arg(snapshot.stalls.size());
+    if (!snapshot.stalls.empty()) {
+        stallText += QString(" (último %1 ms)").arg(snapshot.stalls.back().durationMs, 0, 'f', 0);
+    }
+    painter.drawText(left, y + metrics.ascent(), stallText);
+    y += lineHeight + 6;
+    
+    // Histograma de tiempos de frame (escala logarítmica para ver la cola)
+    const int histogramHeight = 60;
+    int slot = contentWidth / static_cast<int>(PerfMonitor::FRAME_BUCKET_COUNT);
+    uint64_t maxCount = *max_element(snapshot.frameHistogram.begin(),
+                                     snapshot.frameHistogram.end());
+    double scale = maxCount > 0 ? log1p(static_cast<double>(maxCount)) : 1.0;
+    
+    for (size_t i = 0; i < PerfMonitor::FRAME_BUCKET_COUNT; ++i) {
+        int x = left + static_cast<int>(i) * slot;
+        double limit = PerfMonitor::getFrameBucketLimit(i);
+        int barHeight = static_cast<int>(histogramHeight *
+                                         log1p(static_cast<double>(snapshot.frameHistogram[i])) /
+                                         scale);
+        
+        QColor color = limit <= 16.7 ? QColor("#66bb6a")
+                     : limit <= 50.0 ? QColor("#ffca28")
+                                     : QColor("#ef5350");
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(color);
+        painter.drawRect(x + 2, y + histogramHeight - barHeight, slot - 4, barHeight);
+        
+        QString label = std::isinf(limit)
+            ? QString(">%1").arg(PerfMonitor::getFrameBucketLimit(i - 1), 0, 'f', 0)
+            : QString("≤%1").arg(limit, 0, 'f', 0);
+        painter.setPen(QColor("#bdbdbd"));
+        painter.drawText(QRect(x, y + histogramHeight + 2, slot, lineHeight),
+                         Qt::AlignHCenter | Qt::AlignTop, label);
+    }
+    y += histogramHeight + lineHeight + 10;
+    
+    // Operaciones más lentas
+    int countColumn = left + contentWidth - 150;
+    painter.setPen(QColor("#bdbdbd"));
+    painter.drawText(left, y + metrics.ascent(), "Operación");
+    painter.drawText(QRect(countColumn, y, 50, lineHeight), Qt::AlignRight, "n");
+    painter.drawText(QRect(countColumn + 50, y, 50, lineHeight), Qt::AlignRight, "p95");
+    painter.drawText(QRect(countColumn + 100, y, 50, lineHeight), Qt::AlignRight, "máx");
+    y += lineHeight;
+    
+    painter.setPen(Qt::white);
+    for (const auto& operation : snapshot.operations) {
+        if (y + lineHeight > height() - 8) break;
+        
+        QString name = metrics.elidedText(QString::fromStdString(operation.name),
+                                          Qt::ElideMiddle, countColumn - left - 8);
+        painter.drawText(left, y + metrics.ascent(), name);
+        painter.drawText(QRect(countColumn, y, 50, lineHeight), Qt::AlignRight,
+                         QString::number(operation.count));
+        painter.drawText(QRect(countColumn + 50, y, 50, lineHeight), Qt::AlignRight,
+                         QString::number(operation.p95Ms, 'f', 1));
+        painter.drawText(QRect(countColumn + 100, y, 50, lineHeight), Qt::AlignRight,
+                         QString::number(operation.maxMs, 'f', 1));
+        y += lineHeight;
+    }
+}
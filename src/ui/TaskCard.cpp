@@ -1,10 +1,8 @@
 #include "ui/TaskCard.h"
 #include "utils/DateUtils.h"
-#include <QFrame>
+#include "utils/PerfMonitor.h"
 #include <QApplication>
 #include <QPainter>
-#include <QStyleOption>
-#include <QGraphicsDropShadowEffect>
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
 #include <QEnterEvent>
 #endif
@@ -12,7 +10,8 @@
 using namespace std;
 
 TaskCard::TaskCard(shared_ptr<Task> task, QWidget *parent)
-    : QWidget(parent), task(task), isDragging(false) {
+    : QWidget(parent), task(task), renderer(CardRenderer::instance()),
+      isDragging(false), isHovered(false), isHighlighted(false) {
     setupUI();
     setAcceptDrops(true);
 }
@@ -20,64 +19,9 @@ TaskCard::TaskCard(shared_ptr<Task> task, QWidget *parent)
 TaskCard::~TaskCard() {}
 
 void TaskCard::setupUI() {
-    layout = new QVBoxLayout(this);
-    layout->setContentsMargins(10, 10, 10, 10);
-    layout->setSpacing(6);
-    
-    // Título - estilo Trello
-    titleLabel = new QLabel(this);
-    titleLabel->setWordWrap(true);
-    QFont titleFont = titleLabel->font();
-    titleFont.setBold(false);
-    titleFont.setPointSize(11);
-    titleLabel->setFont(titleFont);
-    titleLabel->setStyleSheet("color: #1a1a1a; background: transparent;");
-    layout->addWidget(titleLabel);
-    
-    // Información
-    infoLabel = new QLabel(this);
-    QFont infoFont = infoLabel->font();
-    infoFont.setPointSize(9);
-    infoLabel->setFont(infoFont);
-    infoLabel->setStyleSheet("color: #666666; background: transparent;");
-    layout->addWidget(infoLabel);
-    
-    // Tags
-    tagsLabel = new QLabel(this);
-    QFont tagsFont = tagsLabel->font();
-    tagsFont.setPointSize(9);
-    tagsLabel->setFont(tagsFont);
-    tagsLabel->setStyleSheet(
-        "background-color: #f0f0f0; "
-        "padding: 4px 8px; "
-        "border-radius: 4px; "
-        "color: #4a4a4a;"
-    );
-    layout->addWidget(tagsLabel);
-    
-    // Prioridad (badge discreto en esquina)
-    priorityLabel = new QLabel(this);
-    priorityLabel->setFixedHeight(4);
-    priorityLabel->setStyleSheet("border-radius: 2px; background: transparent;");
-    layout->addWidget(priorityLabel);
-    
-    setLayout(layout);
-    
-    setStyleSheet(
-        "TaskCard {"
-        "  background-color: #ffffff;"
-        "  border: 1px solid #e0e0e0;"
-        "  border-radius: 8px;"
-        "}"
-    );
-    
-    QGraphicsDropShadowEffect* shadow = new QGraphicsDropShadowEffect();
-    shadow->setBlurRadius(4);
-    shadow->setColor(QColor(0, 0, 0, 8));
-    shadow->setOffset(0, 1);
-    setGraphicsEffect(shadow);
-    
-    setMinimumHeight(100);
+    // Todas las tarjetas miden lo mismo; el título largo se recorta y se
+    // ve completo en el tooltip
+    setFixedHeight(renderer.getHeight());
     setMaximumWidth(320);
     setCursor(Qt::PointingHandCursor);
     
@@ -85,46 +29,33 @@ void TaskCard::setupUI() {
 }
 
 void TaskCard::updateDisplay() {
+    PERF_SCOPE("TaskCard::updateDisplay");
     if (!task) return;
     
-    // Actualizar título
-    titleLabel->setText(QString::fromStdString(task->getTitle()));
-    
-    // Actualizar información
-    QString info;
-    info += "ID: " + QString::number(task->getId()) + "\n";
-    info += getDueDateText() + "\n";
-    info += getAssignedUserText();
-    
-    if (task->hasDependencies()) {
-        info += "\n⚠ Tiene dependencias (" + 
-                QString::number(task->getDependencies().size()) + ")";
-    }
-    
-    if (!task->getSubtasks().empty()) {
-        info += "\n☑ Subtareas: " + 
-                QString::number(static_cast<int>(task->getSubtaskCompletionPercentage())) + "%";
-    }
-    
-    infoLabel->setText(info);
-    
-    // Actualizar tags
-    QString tagsText;
-    const auto& tags = task->getTags();
-    for (const auto& tag : tags) {
-        tagsText += "🏷 " + QString::fromStdString(tag) + " ";
-    }
-    tagsLabel->setText(tagsText);
-    tagsLabel->setVisible(!tags.empty());
-    
-    // Actualizar indicador de prioridad
-    priorityLabel->setStyleSheet("background-color: " + getPriorityColor() + ";");
+    setToolTip(QString::fromStdString(task->getTitle()));
+    update();
+}
+
+CardRenderer::State TaskCard::getVisualState() const {
+    if (isHighlighted) return CardRenderer::State::HIGHLIGHTED;
+    if (isHovered) return CardRenderer::State::HOVER;
+    return CardRenderer::State::NORMAL;
+}
+
+QSize TaskCard::sizeHint() const {
+    return QSize(280, renderer.getHeight());
 }
 
-QString TaskCard::getPriorityColor() const {
-    if (!task) return "#e0e0e0";
+void TaskCard::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event);
+    if (!task) return;
     
-    switch (task->getPriority()) {
+    QPainter painter(this);
+    renderer.paint(&painter, rect(), *task, getVisualState());
+}
+
+QString TaskCard::getPriorityColor(const Task& task) {
+    switch (task.getPriority()) {
         case 5: return "#E53935";  // Rojo intenso - Muy alta
         case 4: return "#FF6F00";  // Naranja oscuro - Alta
         case 3: return "#FFA000";  // Amarillo/oro - Media
@@ -134,10 +65,8 @@ QString TaskCard::getPriorityColor() const {
     }
 }
 
-QString TaskCard::getDueDateText() const {
-    if (!task) return "";
-    
-    auto dueDate = task->getDueDate();
+QString TaskCard::getDueDateText(const Task& task) {
+    auto dueDate = task.getDueDate();
     auto now = chrono::system_clock::now();
     
     if (dueDate <= now) {
@@ -145,11 +74,11 @@ QString TaskCard::getDueDateText() const {
     }
     
     string dateStr = DateUtils::toDateString(dueDate);
-    int daysLeft = task->getDaysUntilDue();
+    int daysLeft = task.getDaysUntilDue();
     
     QString text = "📅 Vence: " + QString::fromStdString(dateStr);
     
-    if (task->isOverdue()) {
+    if (task.isOverdue()) {
         text += " (¡VENCIDA!)";
     } else if (daysLeft <= 1) {
         text += " (¡HOY/MAÑANA!)";
@@ -160,10 +89,8 @@ QString TaskCard::getDueDateText() const {
     return text;
 }
 
-QString TaskCard::getAssignedUserText() const {
-    if (!task) return "";
-    
-    int userId = task->getAssignedUserId();
+QString TaskCard::getAssignedUserText(const Task& task) {
+    int userId = task.getAssignedUserId();
     if (userId < 0) {
         return "👤 Sin asignar";
     }
@@ -171,6 +98,33 @@ QString TaskCard::getAssignedUserText() const {
     return "👤 Usuario ID: " + QString::number(userId);
 }
 
+QString TaskCard::getInfoText(const Task& task) {
+    QString info;
+    info += "ID: " + QString::number(task.getId()) + "\n";
+    info += getDueDateText(task) + "\n";
+    info += getAssignedUserText(task);
+    
+    if (task.hasDependencies()) {
+        info += "\n⚠ Tiene dependencias (" + 
+                QString::number(task.getDependencies().size()) + ")";
+    }
+    
+    if (!task.getSubtasks().empty()) {
+        info += "\n☑ Subtareas: " + 
+                QString::number(static_cast<int>(task.getSubtaskCompletionPercentage())) + "%";
+    }
+    
+    return info;
+}
+
+QString TaskCard::getTagsText(const Task& task) {
+    QString tagsText;
+    for (const auto& tag : task.getTags()) {
+        tagsText += "🏷 " + QString::fromStdString(tag) + " ";
+    }
+    return tagsText;
+}
+
 void TaskCard::mousePressEvent(QMouseEvent *event) {
     if (event->button() == Qt::LeftButton) {
         dragStartPosition = event->pos();
@@ -198,6 +152,7 @@ void TaskCard::mouseMoveEvent(QMouseEvent *event) {
     
     // Crear pixmap del widget para mostrar durante el drag
     QPixmap pixmap(size());
+    pixmap.fill(Qt::transparent);
     render(&pixmap);
     drag->setPixmap(pixmap.scaled(250, 150, Qt::KeepAspectRatio, Qt::SmoothTransformation));
     drag->setHotSpot(QPoint(pixmap.width() / 2, pixmap.height() / 2));
@@ -249,39 +204,15 @@ void TaskCard::enterEvent(QEnterEvent *event) {
 #else
 void TaskCard::enterEvent(QEvent *event) {
 #endif
-    setStyleSheet(
-        "TaskCard {"
-        "  background-color: #f5f5f5;"
-        "  border: 2px solid #0078d4;"
-        "  border-radius: 8px;"
-        "}"
-    );
-    
-    // Sombra más pronunciada en hover
-    QGraphicsDropShadowEffect* shadow = new QGraphicsDropShadowEffect();
-    shadow->setBlurRadius(12);
-    shadow->setColor(QColor(0, 0, 0, 25));
-    shadow->setOffset(0, 4);
-    setGraphicsEffect(shadow);
+    isHovered = true;
+    update();
     
     QWidget::enterEvent(event);
 }
 
 void TaskCard::leaveEvent(QEvent *event) {
-    setStyleSheet(
-        "TaskCard {"
-        "  background-color: #ffffff;"
-        "  border: 1px solid #e0e0e0;"
-        "  border-radius: 8px;"
-        "}"
-    );
-    
-    // Volver a sombra sutil
-    QGraphicsDropShadowEffect* shadow = new QGraphicsDropShadowEffect();
-    shadow->setBlurRadius(4);
-    shadow->setColor(QColor(0, 0, 0, 8));
-    shadow->setOffset(0, 1);
-    setGraphicsEffect(shadow);
+    isHovered = false;
+    update();
     
     QWidget::leaveEvent(event);
 }
@@ -296,34 +227,8 @@ void TaskCard::updateTask(shared_ptr<Task> newTask) {
 }
 
 void TaskCard::setHighlighted(bool highlighted) {
-    if (highlighted) {
-        setStyleSheet(
-            "TaskCard {"
-            "  background-color: #fff8e1;"
-            "  border: 2px solid #FFA500;"
-            "  border-radius: 8px;"
-            "}"
-        );
-        
-        QGraphicsDropShadowEffect* shadow = new QGraphicsDropShadowEffect();
-        shadow->setBlurRadius(12);
-        shadow->setColor(QColor(255, 165, 0, 60));
-        shadow->setOffset(0, 4);
-        setGraphicsEffect(shadow);
-    } else {
-        setStyleSheet(
-            "TaskCard {"
-            "  background-color: #ffffff;"
-            "  border: 1px solid #e0e0e0;"
-            "  border-radius: 8px;"
-            "}"
-        );
-        
-        QGraphicsDropShadowEffect* shadow = new QGraphicsDropShadowEffect();
-        shadow->setBlurRadius(4);
-        shadow->setColor(QColor(0, 0, 0, 8));
-        shadow->setOffset(0, 1);
-        setGraphicsEffect(shadow);
-    }
+    if (highlighted == isHighlighted) return;
+    
+    isHighlighted = highlighted;
+    update();
 }
-
@@ -0,0 +1,32 @@
+#include "ui/TaskCardDelegate.h"
+#include "ui/TaskListModel.h"
+#include <QStyle>
+
+using namespace std;
+
+TaskCardDelegate::TaskCardDelegate(QObject *parent)
+    : QStyledItemDelegate(parent), renderer(CardRenderer::instance()) {}
+
+TaskCardDelegate::~TaskCardDelegate() {}
+
+void TaskCardDelegate::paint(QPainter *painter, const QStyleOptionViewItem& option,
+                             const QModelIndex& index) const {
+    const TaskListModel* model = qobject_cast<const TaskListModel*>(index.model());
+    shared_ptr<Task> task = model ? model->getTaskAt(index.row()) : nullptr;
+    if (!task) return;
+    
+    CardRenderer::State state = CardRenderer::State::NORMAL;
+    if (option.state.testFlag(QStyle::State_MouseOver)) {
+        state = CardRenderer::State::HOVER;
+    } else if (option.state.testFlag(QStyle::State_Selected)) {
+        state = CardRenderer::State::SELECTED;
+    }
+    
+    renderer.paint(painter, option.rect, *task, state);
+}
+
+QSize TaskCardDelegate::sizeHint(const QStyleOptionViewItem& option,
+                                 const QModelIndex& index) const {
+    Q_UNUSED(index);
+    return QSize(option.rect.width(), renderer.getHeight());
+}
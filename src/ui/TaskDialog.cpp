@@ -1,5 +1,6 @@
 #include "ui/TaskDialog.h"
 #include "utils/DateUtils.h"
+#include "utils/PerfMonitor.h"
 #include <QVBoxLayout>
 #include <QFormLayout>
 #include <QMessageBox>
@@ -14,10 +15,11 @@ TaskDialog::TaskDialog(shared_ptr<Board> board,
                       QWidget *parent)
     : QDialog(parent), task(task), board(board), project(project),
       isNewTask(task == nullptr) {
+    PERF_SCOPE("TaskDialog::TaskDialog");
     
     if (isNewTask && board) {
         // Crear nueva tarea
-        this->task = make_shared<Task>(0, "", "");
+        this->task = board->allocateTask(0, "", "");
     }
     
     setupUI();
@@ -351,12 +353,12 @@ void TaskDialog::loadHistory() {
     
     versionsList->clear();
     
+    // Solo fecha y autor: no hace falta reconstruir cada descripción
     const auto& history = task->getHistory();
     for (size_t i = 0; i < history.size(); ++i) {
-        auto memento = history[i];
         QString item = "Versión " + QString::number(i + 1) + " - " +
-                      QString::fromStdString(DateUtils::toDateTimeString(memento->getTimestamp())) +
-                      " por " + QString::fromStdString(memento->getModifiedBy());
+                      QString::fromStdString(DateUtils::toDateTimeString(history.getTimestamp(i))) +
+                      " por " + QString::fromStdString(history.getModifiedBy(i));
         versionsList->addItem(item);
     }
 }
@@ -364,13 +366,10 @@ void TaskDialog::loadHistory() {
 void TaskDialog::loadActivityLog() {
     if (!task) return;
     
-    auto log = task->getActivityLog();
-    if (!log) return;
-    
     QString html = "<html><body style='font-family: monospace; font-size: 10pt;'>";
     html += "<h3>Registro de Actividad</h3>";
     
-    for (const auto& entry : log->getEntries()) {
+    for (const auto& entry : task->getActivityEntries()) {
         html += "<p>" + QString::fromStdString(entry.toString()) + "</p>";
     }
     
@@ -380,23 +379,46 @@ void TaskDialog::loadActivityLog() {
 }
 
 void TaskDialog::onSave() {
+    PERF_SCOPE("TaskDialog::onSave");
     if (titleEdit->text().trimmed().isEmpty()) {
         QMessageBox::warning(this, "Error", "El título no puede estar vacío");
         return;
     }
     
-    // Actualizar tarea
-    task->setTitle(titleEdit->text().toStdString(), "Usuario Actual");
-    task->setDescription(descriptionEdit->toPlainText().toStdString(), "Usuario Actual");
-    task->setState(stateCombo->currentText().toStdString(), "Usuario Actual");
-    
+    string title = titleEdit->text().toStdString();
+    string description = descriptionEdit->toPlainText().toStdString();
+    string state = stateCombo->currentText().toStdString();
     int userId = userCombo->currentData().toInt();
-    task->setAssignedUserId(userId, "Usuario Actual");
-    
     time_t time = dueDateEdit->dateTime().toSecsSinceEpoch();
-    task->setDueDate(chrono::system_clock::from_time_t(time));
-    
-    task->setPriority(prioritySpinBox->value());
+    auto dueDate = chrono::system_clock::from_time_t(time);
+    
+    bool onBoard = board && board->findTaskById(task->getId()) == task;
+    bool moved = true;
+    
+    if (undoManager && !isNewTask) {
+        // Guardar es un solo paso deshacible
+        undoManager->beginGroup();
+        undoManager->setTitle(task, title, "Usuario Actual");
+        undoManager->setDescription(task, description, "Usuario Actual");
+        if (onBoard) {
+            moved = task->getState() == state ||
+                    undoManager->moveTask(board, task->getId(), state, "Usuario Actual");
+        } else {
+            task->setState(state, "Usuario Actual");
+        }
+        undoManager->setAssignedUserId(task, userId, "Usuario Actual");
+        undoManager->setDueDate(task, dueDate, "Usuario Actual");
+        undoManager->setPriority(task, prioritySpinBox->value(), "Usuario Actual");
+        undoManager->endGroup();
+    } else {
+        // Actualizar tarea
+        task->setTitle(title, "Usuario Actual");
+        task->setDescription(description, "Usuario Actual");
+        task->setState(state, "Usuario Actual");
+        task->setAssignedUserId(userId, "Usuario Actual");
+        task->setDueDate(dueDate);
+        task->setPriority(prioritySpinBox->value());
+    }
     
     // Tags
     QStringList tagsList = tagsEdit->text().split(",", Qt::SkipEmptyParts);
@@ -404,6 +426,13 @@ void TaskDialog::onSave() {
         task->addTag(tag.trimmed().toStdString());
     }
     
+    // El resto se guardó; el diálogo sigue abierto para elegir otro estado
+    if (!moved) {
+        QMessageBox::warning(this, "Error",
+                             "No se puede mover la tarea: tiene dependencias sin terminar");
+        return;
+    }
+    
     accept();
 }
 
@@ -428,8 +457,12 @@ void TaskDialog::onAddSubtask() {
                                          QLineEdit::Normal, "", &ok);
     if (ok && !title.isEmpty()) {
         // Agregar subtarea
-        auto subtask = make_shared<Subtask>(0, title.toStdString());
-        task->addSubtask(subtask);
+        auto subtask = task->allocateSubtask(title.toStdString());
+        if (undoManager && !isNewTask) {
+            undoManager->addSubtask(task, subtask);
+        } else {
+            task->addSubtask(subtask);
+        }
         loadSubtasks();
     }
 }
@@ -437,8 +470,12 @@ void TaskDialog::onAddSubtask() {
 void TaskDialog::onRemoveSubtask() {
     int row = subtasksList->currentRow();
     if (row >= 0) {
-        // Eliminar subtarea
-        // Implementación simplificada
+        // Las filas siguen el orden de las subtareas de primer nivel
+        if (undoManager && !isNewTask) {
+            undoManager->removeSubtaskAt(task, static_cast<size_t>(row));
+        } else {
+            task->removeSubtaskAt(static_cast<size_t>(row));
+        }
         loadSubtasks();
     }
 }
@@ -446,7 +483,11 @@ void TaskDialog::onRemoveSubtask() {
 void TaskDialog::onAddDependency() {
     int taskId = availableTasksCombo->currentData().toInt();
     if (taskId > 0) {
-        task->addDependency(taskId);
+        if (undoManager && !isNewTask) {
+            undoManager->addDependency(task, taskId);
+        } else {
+            task->addDependency(taskId);
+        }
         loadDependencies();
     }
 }
@@ -457,7 +498,11 @@ void TaskDialog::onRemoveDependency() {
         // Extraer ID y eliminar dependencia
         QString text = dependenciesList->currentItem()->text();
         int taskId = text.split(":")[0].toInt();
-        task->removeDependency(taskId);
+        if (undoManager && !isNewTask) {
+            undoManager->removeDependency(task, taskId);
+        } else {
+            task->removeDependency(taskId);
+        }
         loadDependencies();
     }
 }
@@ -481,7 +526,11 @@ void TaskDialog::onRestoreVersion() {
         if (reply == QMessageBox::Yes) {
             const auto& history = task->getHistory();
             if (row < static_cast<int>(history.size())) {
-                task->restoreFromMemento(history[row]);
+                if (board && board->findTaskById(task->getId()) == task) {
+                    board->restoreTaskVersion(task->getId(), history[row], "Usuario Actual");
+                } else {
+                    task->restoreFromMemento(history[row]);
+                }
                 loadTaskData();
             }
         }
@@ -492,6 +541,10 @@ shared_ptr<Task> TaskDialog::getTask() const {
     return task;
 }
 
+void TaskDialog::setUndoManager(shared_ptr<UndoManager> undoManager) {
+    this->undoManager = undoManager;
+}
+
 bool TaskDialog::wasAccepted() const {
     return result() == QDialog::Accepted;
 }
@@ -0,0 +1,122 @@
+#include "ui/TaskListModel.h"
+#include "ui/TaskCard.h"
+
+using namespace std;
+
+TaskListModel::TaskListModel(QObject *parent)
+    : QAbstractListModel(parent) {}
+
+TaskListModel::~TaskListModel() {}
+
+int TaskListModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(tasks.size());
+}
+
+QVariant TaskListModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() < 0 || index.row() >= rowCount()) {
+        return QVariant();
+    }
+    
+    const Task& task = *tasks[index.row()];
+    switch (role) {
+        case Qt::DisplayRole:
+        case TitleRole:
+            return QString::fromStdString(task.getTitle());
+        case TaskIdRole:
+            return task.getId();
+        case InfoRole:
+            return TaskCard::getInfoText(task);
+        case TagsRole:
+            return TaskCard::getTagsText(task);
+        case PriorityColorRole:
+            return TaskCard::getPriorityColor(task);
+        default:
+            return QVariant();
+    }
+}
+
+Qt::ItemFlags TaskListModel::flags(const QModelIndex& index) const {
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsDragEnabled;
+}
+
+QStringList TaskListModel::mimeTypes() const {
+    return QStringList() << "application/x-task-id";
+}
+
+QMimeData* TaskListModel::mimeData(const QModelIndexList& indexes) const {
+    if (indexes.isEmpty() || !indexes.first().isValid()) {
+        return nullptr;
+    }
+    
+    // Igual que TaskCard: una tarea por arrastre
+    int taskId = tasks[indexes.first().row()]->getId();
+    QMimeData *mimeData = new QMimeData;
+    mimeData->setText(QString::number(taskId));
+    mimeData->setData("application/x-task-id", QString::number(taskId).toUtf8());
+    return mimeData;
+}
+
+Qt::DropActions TaskListModel::supportedDragActions() const {
+    return Qt::MoveAction;
+}
+
+void TaskListModel::setTasks(const vector<shared_ptr<Task>>& newTasks) {
+    size_t oldSize = tasks.size();
+    size_t newSize = newTasks.size();
+    
+    // Prefijo y sufijo comunes; lo del medio es lo único que cambió
+    size_t prefix = 0;
+    while (prefix < oldSize && prefix < newSize && tasks[prefix] == newTasks[prefix]) {
+        ++prefix;
+    }
+    size_t suffix = 0;
+    while (suffix < oldSize - prefix && suffix < newSize - prefix &&
+           tasks[oldSize - 1 - suffix] == newTasks[newSize - 1 - suffix]) {
+        ++suffix;
+    }
+    
+    size_t removed = oldSize - prefix - suffix;
+    size_t inserted = newSize - prefix - suffix;
+    
+    if (removed > 0) {
+        beginRemoveRows(QModelIndex(), static_cast<int>(prefix),
+                        static_cast<int>(prefix + removed - 1));
+        tasks.erase(tasks.begin() + prefix, tasks.begin() + prefix + removed);
+        endRemoveRows();
+    }
+    
+    if (inserted > 0) {
+        beginInsertRows(QModelIndex(), static_cast<int>(prefix),
+                        static_cast<int>(prefix + inserted - 1));
+        tasks.insert(tasks.begin() + prefix,
+                     newTasks.begin() + prefix, newTasks.begin() + prefix + inserted);
+        endInsertRows();
+    }
+}
+
+void TaskListModel::refreshTask(int taskId) {
+    int row = findRow(taskId);
+    if (row >= 0) {
+        QModelIndex changed = index(row);
+        emit dataChanged(changed, changed);
+    }
+}
+
+shared_ptr<Task> TaskListModel::getTaskAt(int row) const {
+    if (row < 0 || row >= rowCount()) {
+        return nullptr;
+    }
+    return tasks[row];
+}
+
+int TaskListModel::findRow(int taskId) const {
+    for (size_t row = 0; row < tasks.size(); ++row) {
+        if (tasks[row]->getId() == taskId) {
+            return static_cast<int>(row);
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,124 @@
+#include "utils/CompactString.h"
+#include <cstring>
+
+using namespace std;
+
+// Constructores
+CompactString::CompactString() {
+    bytes[0] = '\0';
+    bytes[INLINE_CAPACITY] = 0;
+}
+
+CompactString::CompactString(string_view value) {
+    assign(value);
+}
+
+CompactString::CompactString(const string& value) {
+    assign(string_view(value));
+}
+
+CompactString::CompactString(const char* value) {
+    assign(string_view(value));
+}
+
+CompactString::CompactString(const CompactString& other) {
+    assign(other.view());
+}
+
+CompactString::CompactString(CompactString&& other) noexcept {
+    // Mover es copiar los 16 bytes y dejar el origen vacío
+    memcpy(bytes, other.bytes, sizeof(bytes));
+    other.bytes[0] = '\0';
+    other.bytes[INLINE_CAPACITY] = 0;
+}
+
+// Destructor
+CompactString::~CompactString() {
+    release();
+}
+
+CompactString& CompactString::operator=(const CompactString& other) {
+    if (this != &other) {
+        release();
+        assign(other.view());
+    }
+    return *this;
+}
+
+CompactString& CompactString::operator=(CompactString&& other) noexcept {
+    if (this != &other) {
+        release();
+        memcpy(bytes, other.bytes, sizeof(bytes));
+        other.bytes[0] = '\0';
+        other.bytes[INLINE_CAPACITY] = 0;
+    }
+    return *this;
+}
+
+// Representación interna
+bool CompactString::isHeap() const {
+    return static_cast<unsigned char>(bytes[INLINE_CAPACITY]) == HEAP_TAG;
+}
+
+const char* CompactString::heapData() const {
+    const char* data;
+    memcpy(&data, bytes, sizeof(data));
+    return data;
+}
+
+uint32_t CompactString::heapSize() const {
+    uint32_t size;
+    memcpy(&size, bytes + sizeof(char*), sizeof(size));
+    return size;
+}
+
+void CompactString::assign(string_view value) {
+    if (value.size() <= INLINE_CAPACITY) {
+        memcpy(bytes, value.data(), value.size());
+        bytes[INLINE_CAPACITY] = static_cast<char>(value.size());
+        return;
+    }
+
+    char* data = new char[value.size()];
+    memcpy(data, value.data(), value.size());
+
+    uint32_t size = static_cast<uint32_t>(value.size());
+    memcpy(bytes, &data, sizeof(data));
+    memcpy(bytes + sizeof(char*), &size, sizeof(size));
+    bytes[INLINE_CAPACITY] = static_cast<char>(HEAP_TAG);
+}
+
+void CompactString::release() {
+    if (isHeap()) {
+        delete[] heapData();
+        bytes[INLINE_CAPACITY] = 0;
+    }
+}
+
+// Acceso
+string_view CompactString::view() const {
+    if (isHeap()) {
+        return string_view(heapData(), heapSize());
+    }
+    return string_view(bytes, static_cast<unsigned char>(bytes[INLINE_CAPACITY]));
+}
+
+string CompactString::str() const {
+    return string(view());
+}
+
+size_t CompactString::size() const {
+    return isHeap() ? heapSize() : static_cast<unsigned char>(bytes[INLINE_CAPACITY]);
+}
+
+bool CompactString::empty() const {
+    return size() == 0;
+}
+
+bool CompactString::operator==(string_view other) const {
+    return view() == other;
+}
+
+bool CompactString::operator!=(string_view other) const {
+    return view() != other;
+}
@@ -1,5 +1,6 @@
 #include "utils/DataPersistence.h"
 #include "utils/DateUtils.h"
+#include "utils/PerfMonitor.h"
 #include <fstream>
 #include <sstream>
 #include <filesystem>
@@ -157,8 +158,24 @@ string DataPersistence::serializeProject(shared_ptr<Project> project) const {
     return ss.str();
 }
 
+// El mensaje va al final: puede contener '|' (títulos de tareas)
+string DataPersistence::serializeNotification(const Notification& notification) const {
+    stringstream ss;
+    ss << "NOTIFICATION|" << notification.id << "|"
+       << static_cast<int>(notification.type) << "|"
+       << notification.taskId << "|"
+       << notification.userId << "|"
+       << DateUtils::toDateTimeString(notification.timestamp) << "|"
+       << (notification.read ? 1 : 0) << "|"
+       << escapeJson(notification.title) << "|"
+       << escapeJson(notification.message) << "\n";
+    
+    return ss.str();
+}
+
 // Guardar
 bool DataPersistence::saveProject(shared_ptr<Project> project) {
+    PERF_SCOPE("DataPersistence::saveProject");
     if (!project) return false;
     
     string filePath = getProjectFilePath(project->getId());
@@ -189,6 +206,22 @@ bool DataPersistence::saveAllProjects(shared_ptr<ProjectManager> manager) {
     return true;
 }
 
+bool DataPersistence::saveNotifications(shared_ptr<NotificationManager> manager) {
+    if (!manager) return false;
+    
+    ofstream file(getNotificationsFilePath());
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    for (const auto& notification : manager->getAllNotifications()) {
+        file << serializeNotification(notification);
+    }
+    file.close();
+    
+    return true;
+}
+
 bool DataPersistence::createBackup(int projectId) {
     string originalPath = getProjectFilePath(projectId);
     string backupPath = originalPath + ".backup";
@@ -269,7 +302,7 @@ shared_ptr<Project> DataPersistence::loadProject(int projectId) {
             int userId = stoi(userIdStr);
             int priority = stoi(priorityStr);
             
-            auto task = make_shared<Task>(taskId, title, desc);
+            auto task = currentBoard->allocateTask(taskId, title, desc);
             task->setPriority(priority);
             if (userId >= 0) {
                 task->setAssignedUserId(userId, "System");
@@ -310,6 +343,50 @@ bool DataPersistence::loadAllProjects(shared_ptr<ProjectManager> manager) {
     return true;
 }
 
+bool DataPersistence::loadNotifications(shared_ptr<NotificationManager> manager) {
+    if (!manager) return false;
+    
+    ifstream file(getNotificationsFilePath());
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    string line;
+    while (getline(file, line)) {
+        if (line.empty()) continue;
+        
+        stringstream ss(line);
+        string type, idStr, typeStr, taskIdStr, userIdStr, timestamp, readStr, title, message;
+        getline(ss, type, '|');
+        if (type != "NOTIFICATION") continue;
+        
+        getline(ss, idStr, '|');
+        getline(ss, typeStr, '|');
+        getline(ss, taskIdStr, '|');
+        getline(ss, userIdStr, '|');
+        getline(ss, timestamp, '|');
+        getline(ss, readStr, '|');
+        getline(ss, title, '|');
+        getline(ss, message);  // Resto de la línea
+        
+        try {
+            Notification notification(static_cast<Notification::Type>(stoi(typeStr)),
+                                      unescapeJson(title), unescapeJson(message),
+                                      stoi(taskIdStr), stoi(userIdStr));
+            notification.id = stoull(idStr);
+            notification.timestamp = DateUtils::stringToTimePoint(timestamp);
+            notification.read = readStr == "1";
+            manager->restoreNotification(notification);
+        } catch (...) {
+            // Línea dañada: se ignora
+        }
+    }
+    
+    // Descartar las que vencieron mientras la aplicación estaba cerrada
+    manager->expireNotifications();
+    return true;
+}
+
 // Eliminar
 bool DataPersistence::deleteProject(int projectId) {
     string filePath = getProjectFilePath(projectId);
@@ -392,3 +469,7 @@ string DataPersistence::getProjectsIndexPath() const {
     return dataDirectory + "/projects_index.txt";
 }
 
+string DataPersistence::getNotificationsFilePath() const {
+    return dataDirectory + "/notifications.txt";
+}
+
@@ -67,6 +67,30 @@ chrono::system_clock::time_point DateUtils::addHours(
     return tp + chrono::hours(hours);
 }
 
+chrono::system_clock::time_point DateUtils::startOfDay(
+    const chrono::system_clock::time_point& tp) {
+    time_t time = chrono::system_clock::to_time_t(tp);
+    tm tm = *localtime(&time);
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_isdst = -1;
+    return chrono::system_clock::from_time_t(mktime(&tm));
+}
+
+chrono::system_clock::time_point DateUtils::startOfWeek(
+    const chrono::system_clock::time_point& tp) {
+    time_t time = chrono::system_clock::to_time_t(tp);
+    tm tm = *localtime(&time);
+    int daysSinceMonday = (tm.tm_wday + 6) % 7;  // tm_wday: 0 = Domingo
+    tm.tm_mday -= daysSinceMonday;
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_isdst = -1;
+    return chrono::system_clock::from_time_t(mktime(&tm));
+}
+
 // Comparaciones
 bool DateUtils::isToday(const chrono::system_clock::time_point& tp) {
     auto now = chrono::system_clock::now();
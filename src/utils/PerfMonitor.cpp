@@ -0,0 +1,185 @@
+#include "utils/PerfMonitor.h"
+#include "utils/DateUtils.h"
+#include <fstream>
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace {
+
+// Límites superiores de los intervalos del histograma de frames (ms)
+const double FRAME_BUCKET_LIMITS[PerfMonitor::FRAME_BUCKET_COUNT] = {
+    8.0, 16.7, 33.3, 50.0, 100.0, 250.0, 500.0, numeric_limits<double>::infinity()
+};
+
+const double DEFAULT_STALL_THRESHOLD_MS = 100.0;
+
+double toMilliseconds(chrono::steady_clock::duration duration) {
+    return chrono::duration<double, milli>(duration).count();
+}
+
+double quantileOf(const QuantileSketch& sketch, double quantile) {
+    return sketch.isEmpty() ? 0.0 : sketch.getQuantile(quantile);
+}
+
+} // namespace
+
+atomic<bool> PerfMonitor::enabled(false);
+
+// Constructor
+PerfMonitor::PerfMonitor()
+    : samples(MAX_SAMPLES), stalls(MAX_STALLS),
+      stallThresholdMs(DEFAULT_STALL_THRESHOLD_MS),
+      origin(chrono::steady_clock::now()) {
+    frameHistogram.fill(0);
+}
+
+PerfMonitor& PerfMonitor::instance() {
+    static PerfMonitor monitor;
+    return monitor;
+}
+
+// Activación
+void PerfMonitor::setEnabled(bool enable) {
+    enabled.store(enable, memory_order_relaxed);
+}
+
+// Registro
+void PerfMonitor::record(const char* name, chrono::steady_clock::duration duration) {
+    double ms = toMilliseconds(duration);
+    auto start = chrono::steady_clock::now() - duration;
+    
+    lock_guard<mutex> lock(dataMutex);
+    
+    auto it = operations.find(string_view(name));
+    if (it == operations.end()) {
+        it = operations.emplace(name, Operation()).first;
+    }
+    it->second.count++;
+    it->second.totalMs += ms;
+    it->second.sketch.add(ms);
+    
+    samples.push(Sample{name, start, ms});
+}
+
+void PerfMonitor::recordFrame(chrono::steady_clock::duration interval) {
+    double ms = toMilliseconds(interval);
+    
+    lock_guard<mutex> lock(dataMutex);
+    
+    size_t bucket = 0;
+    while (ms > FRAME_BUCKET_LIMITS[bucket]) {
+        ++bucket;
+    }
+    frameHistogram[bucket]++;
+    frameSketch.add(ms);
+    
+    if (ms >= stallThresholdMs) {
+        stalls.push(Stall{chrono::system_clock::now(), ms});
+    }
+}
+
+// Configuración
+void PerfMonitor::setStallThreshold(chrono::milliseconds threshold) {
+    lock_guard<mutex> lock(dataMutex);
+    stallThresholdMs = static_cast<double>(threshold.count());
+}
+
+chrono::milliseconds PerfMonitor::getStallThreshold() const {
+    lock_guard<mutex> lock(dataMutex);
+    return chrono::milliseconds(static_cast<long long>(stallThresholdMs));
+}
+
+// Consultas
+PerfMonitor::Snapshot PerfMonitor::getSnapshot(size_t maxOperations) const {
+    lock_guard<mutex> lock(dataMutex);
+    
+    Snapshot snapshot;
+    snapshot.frameHistogram = frameHistogram;
+    snapshot.frameCount = frameSketch.getCount();
+    snapshot.frameP50Ms = quantileOf(frameSketch, 0.50);
+    snapshot.frameP95Ms = quantileOf(frameSketch, 0.95);
+    snapshot.frameMaxMs = frameSketch.isEmpty() ? 0.0 : frameSketch.getMax();
+    
+    for (const auto& entry : operations) {
+        const Operation& operation = entry.second;
+        snapshot.operations.push_back({entry.first, operation.count, operation.totalMs,
+                                       quantileOf(operation.sketch, 0.50),
+                                       quantileOf(operation.sketch, 0.95),
+                                       operation.sketch.getMax()});
+    }
+    
+    // Las más lentas primero; solo se ordenan las que se devuelven
+    size_t keep = min(maxOperations, snapshot.operations.size());
+    partial_sort(snapshot.operations.begin(), snapshot.operations.begin() + keep,
+                 snapshot.operations.end(),
+                 [](const OperationStats& a, const OperationStats& b) {
+                     return a.maxMs > b.maxMs;
+                 });
+    snapshot.operations.resize(keep);
+    
+    snapshot.stalls.assign(stalls.begin(), stalls.end());
+    return snapshot;
+}
+
+double PerfMonitor::getFrameBucketLimit(size_t bucket) {
+    return bucket < FRAME_BUCKET_COUNT ? FRAME_BUCKET_LIMITS[bucket]
+                                       : numeric_limits<double>::infinity();
+}
+
+// Métodos de utilidad
+bool PerfMonitor::dump(const string& filePath) const {
+    Snapshot snapshot = getSnapshot(numeric_limits<size_t>::max());
+    
+    ofstream file(filePath);
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    file << "# Volcado de rendimiento " << DateUtils::toDateTimeString(chrono::system_clock::now())
+         << "\n";
+    
+    file << "\n[frames]\n";
+    file << "count=" << snapshot.frameCount << " p50_ms=" << snapshot.frameP50Ms
+         << " p95_ms=" << snapshot.frameP95Ms << " max_ms=" << snapshot.frameMaxMs << "\n";
+    file << "limit_ms,count\n";
+    for (size_t i = 0; i < FRAME_BUCKET_COUNT; ++i) {
+        file << getFrameBucketLimit(i) << "," << snapshot.frameHistogram[i] << "\n";
+    }
+    
+    file << "\n[operations]\n";
+    file << "name,count,total_ms,p50_ms,p95_ms,max_ms\n";
+    for (const auto& operation : snapshot.operations) {
+        file << operation.name << "," << operation.count << "," << operation.totalMs << ","
+             << operation.p50Ms << "," << operation.p95Ms << "," << operation.maxMs << "\n";
+    }
+    
+    file << "\n[stalls]\n";
+    file << "when,duration_ms\n";
+    for (const auto& stall : snapshot.stalls) {
+        file << DateUtils::toDateTimeString(stall.when) << "," << stall.durationMs << "\n";
+    }
+    
+    // Muestras individuales, en milisegundos desde el inicio del monitor
+    file << "\n[samples]\n";
+    file << "start_ms,name,duration_ms\n";
+    {
+        lock_guard<mutex> lock(dataMutex);
+        for (const auto& sample : samples) {
+            file << toMilliseconds(sample.start - origin) << "," << sample.name << ","
+                 << sample.durationMs << "\n";
+        }
+    }
+    
+    return file.good();
+}
+
+void PerfMonitor::reset() {
+    lock_guard<mutex> lock(dataMutex);
+    operations.clear();
+    samples.clear();
+    stalls.clear();
+    frameHistogram.fill(0);
+    frameSketch.clear();
+}
@@ -0,0 +1,68 @@
+#include "utils/PoolAllocator.h"
+#include <algorithm>
+#include <new>
+
+using namespace std;
+
+// Constructor
+SlabPoolResource::SlabPoolResource(size_t slabSize)
+    : freeLists(), cursor(nullptr), limit(nullptr),
+      slabSize(max(slabSize, MAX_BLOCK)) {}
+
+// Destructor: devuelve todos los bloques de una vez
+SlabPoolResource::~SlabPoolResource() {
+    for (void* slab : slabs) {
+        ::operator delete(slab);
+    }
+}
+
+// Reserva
+void* SlabPoolResource::do_allocate(size_t bytes, size_t alignment) {
+    if (bytes > MAX_BLOCK || alignment > GRANULE) {
+        return ::operator new(bytes, align_val_t(alignment));
+    }
+    
+    size_t sizeClass = classOf(bytes);
+    lock_guard<mutex> lock(poolMutex);
+    
+    if (FreeBlock* block = freeLists[sizeClass]) {
+        freeLists[sizeClass] = block->next;
+        return block;
+    }
+    
+    size_t size = (sizeClass + 1) * GRANULE;
+    if (static_cast<size_t>(limit - cursor) < size) {
+        // El resto del bloque anterior se pierde hasta destruir el pool
+        cursor = static_cast<char*>(::operator new(slabSize));
+        limit = cursor + slabSize;
+        slabs.push_back(cursor);
+    }
+    
+    void* pointer = cursor;
+    cursor += size;
+    return pointer;
+}
+
+void SlabPoolResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    if (bytes > MAX_BLOCK || alignment > GRANULE) {
+        ::operator delete(pointer, align_val_t(alignment));
+        return;
+    }
+    
+    size_t sizeClass = classOf(bytes);
+    lock_guard<mutex> lock(poolMutex);
+    
+    auto* block = static_cast<FreeBlock*>(pointer);
+    block->next = freeLists[sizeClass];
+    freeLists[sizeClass] = block;
+}
+
+bool SlabPoolResource::do_is_equal(const pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+// Estadísticas
+size_t SlabPoolResource::getSlabCount() {
+    lock_guard<mutex> lock(poolMutex);
+    return slabs.size();
+}
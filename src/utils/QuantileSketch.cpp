@@ -0,0 +1,120 @@
+#include "utils/QuantileSketch.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+// Por debajo de este valor se considera cero (evita log de valores diminutos)
+const double MIN_INDEXABLE_VALUE = 1e-9;
+
+} // namespace
+
+// Constructor
+QuantileSketch::QuantileSketch(double relativeAccuracy)
+    : relativeAccuracy(relativeAccuracy),
+      gamma((1.0 + relativeAccuracy) / (1.0 - relativeAccuracy)),
+      logGamma(log((1.0 + relativeAccuracy) / (1.0 - relativeAccuracy))),
+      zeroCount(0), count(0), minValue(0.0), maxValue(0.0) {}
+
+int QuantileSketch::indexOf(double value) const {
+    return static_cast<int>(ceil(log(value) / logGamma));
+}
+
+double QuantileSketch::valueOf(int index) const {
+    // Punto del intervalo (gamma^(i-1), gamma^i] con error relativo mínimo
+    return 2.0 * pow(gamma, index) / (gamma + 1.0);
+}
+
+// Agregar valores
+void QuantileSketch::add(double value) {
+    if (value < 0.0) {
+        value = 0.0;
+    }
+
+    if (count == 0) {
+        minValue = maxValue = value;
+    } else {
+        minValue = min(minValue, value);
+        maxValue = max(maxValue, value);
+    }
+    ++count;
+
+    if (value < MIN_INDEXABLE_VALUE) {
+        ++zeroCount;
+    } else {
+        ++buckets[indexOf(value)];
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.count == 0) {
+        return;
+    }
+
+    if (count == 0) {
+        minValue = other.minValue;
+        maxValue = other.maxValue;
+    } else {
+        minValue = min(minValue, other.minValue);
+        maxValue = max(maxValue, other.maxValue);
+    }
+
+    count += other.count;
+    zeroCount += other.zeroCount;
+    for (const auto& pair : other.buckets) {
+        buckets[pair.first] += pair.second;
+    }
+}
+
+// Consultas
+double QuantileSketch::getQuantile(double quantile) const {
+    if (count == 0) {
+        return 0.0;
+    }
+
+    quantile = min(1.0, max(0.0, quantile));
+    if (quantile == 0.0) return minValue;
+    if (quantile == 1.0) return maxValue;
+
+    uint64_t rank = static_cast<uint64_t>(quantile * (count - 1));
+    if (rank < zeroCount) {
+        return 0.0;
+    }
+
+    uint64_t seen = zeroCount;
+    for (const auto& pair : buckets) {
+        seen += pair.second;
+        if (seen > rank) {
+            return min(maxValue, max(minValue, valueOf(pair.first)));
+        }
+    }
+
+    return maxValue;
+}
+
+uint64_t QuantileSketch::getCount() const {
+    return count;
+}
+
+double QuantileSketch::getMin() const {
+    return minValue;
+}
+
+double QuantileSketch::getMax() const {
+    return maxValue;
+}
+
+bool QuantileSketch::isEmpty() const {
+    return count == 0;
+}
+
+// Métodos de utilidad
+void QuantileSketch::clear() {
+    buckets.clear();
+    zeroCount = 0;
+    count = 0;
+    minValue = 0.0;
+    maxValue = 0.0;
+}
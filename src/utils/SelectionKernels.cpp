@@ -0,0 +1,243 @@
+#include "utils/SelectionKernels.h"
+#include <algorithm>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SELECTION_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+const size_t BITS_PER_WORD = 64;
+
+// Posición del bit encendido más bajo (word != 0)
+unsigned lowestBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned bit = 0;
+    while (((word >> bit) & 1) == 0) ++bit;
+    return bit;
+#endif
+}
+
+bool matchesRow(const SelectionKernels::Columns& columns,
+                const SelectionKernels::Predicate& predicate, size_t row) {
+    int64_t due = columns.dueTicks[row];
+    if (due < predicate.dueFrom || due > predicate.dueTo) return false;
+    if (columns.priorities[row] < predicate.minPriority) return false;
+    if (predicate.excludeState && columns.stateIds[row] == predicate.excludedStateId) return false;
+    
+    if (predicate.assignees.empty()) return true;
+    for (int32_t assignee : predicate.assignees) {
+        if (columns.assigneeIds[row] == assignee) return true;
+    }
+    return false;
+}
+
+// Filas [firstRow, count) fila por fila; firstRow es múltiplo de 64
+void selectScalarFrom(const SelectionKernels::Columns& columns,
+                      const SelectionKernels::Predicate& predicate,
+                      uint64_t* words, size_t firstRow) {
+    for (size_t base = firstRow; base < columns.count; base += BITS_PER_WORD) {
+        size_t end = min(columns.count, base + BITS_PER_WORD);
+        uint64_t word = 0;
+        for (size_t row = base; row < end; ++row) {
+            word |= static_cast<uint64_t>(matchesRow(columns, predicate, row)) << (row - base);
+        }
+        words[base / BITS_PER_WORD] = word;
+    }
+}
+
+#ifdef SELECTION_KERNELS_X86
+
+// 4 filas por paso: 32 bits en un registro de 128, vencimientos de a 2
+__attribute__((target("sse4.2")))
+void selectSse42(const SelectionKernels::Columns& columns,
+                 const SelectionKernels::Predicate& predicate, uint64_t* words) {
+    const __m128i from = _mm_set1_epi64x(predicate.dueFrom);
+    const __m128i to = _mm_set1_epi64x(predicate.dueTo);
+    const __m128i minPriority = _mm_set1_epi32(predicate.minPriority);
+    const __m128i excluded = _mm_set1_epi32(static_cast<int32_t>(predicate.excludedStateId));
+    const __m128i allOnes = _mm_set1_epi32(-1);
+    
+    size_t fullWords = columns.count / BITS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w) {
+        uint64_t word = 0;
+        for (size_t step = 0; step < BITS_PER_WORD / 4; ++step) {
+            size_t row = w * BITS_PER_WORD + step * 4;
+            
+            __m128i priority = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.priorities + row));
+            __m128i pass = _mm_andnot_si128(_mm_cmpgt_epi32(minPriority, priority), allOnes);
+            
+            if (predicate.excludeState) {
+                __m128i state = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.stateIds + row));
+                pass = _mm_andnot_si128(_mm_cmpeq_epi32(state, excluded), pass);
+            }
+            
+            if (!predicate.assignees.empty()) {
+                __m128i assignee = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.assigneeIds + row));
+                __m128i any = _mm_setzero_si128();
+                for (int32_t value : predicate.assignees) {
+                    any = _mm_or_si128(any, _mm_cmpeq_epi32(assignee, _mm_set1_epi32(value)));
+                }
+                pass = _mm_and_si128(pass, any);
+            }
+            
+            __m128i due0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.dueTicks + row));
+            __m128i due1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.dueTicks + row + 2));
+            // Límites inclusivos: se marca lo que queda fuera y se invierte
+            __m128i outside0 = _mm_or_si128(_mm_cmpgt_epi64(from, due0), _mm_cmpgt_epi64(due0, to));
+            __m128i outside1 = _mm_or_si128(_mm_cmpgt_epi64(from, due1), _mm_cmpgt_epi64(due1, to));
+            
+            unsigned mask32 = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(pass)));
+            unsigned mask64 = ~(static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(outside0)))
+                              | (static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(outside1))) << 2));
+            word |= static_cast<uint64_t>(mask32 & mask64) << (step * 4);
+        }
+        words[w] = word;
+    }
+    
+    selectScalarFrom(columns, predicate, words, fullWords * BITS_PER_WORD);
+}
+
+// 8 filas por paso: 32 bits en un registro de 256, vencimientos de a 4
+__attribute__((target("avx2")))
+void selectAvx2(const SelectionKernels::Columns& columns,
+                const SelectionKernels::Predicate& predicate, uint64_t* words) {
+    const __m256i from = _mm256_set1_epi64x(predicate.dueFrom);
+    const __m256i to = _mm256_set1_epi64x(predicate.dueTo);
+    const __m256i minPriority = _mm256_set1_epi32(predicate.minPriority);
+    const __m256i excluded = _mm256_set1_epi32(static_cast<int32_t>(predicate.excludedStateId));
+    const __m256i allOnes = _mm256_set1_epi32(-1);
+    
+    size_t fullWords = columns.count / BITS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w) {
+        uint64_t word = 0;
+        for (size_t step = 0; step < BITS_PER_WORD / 8; ++step) {
+            size_t row = w * BITS_PER_WORD + step * 8;
+            
+            __m256i priority = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.priorities + row));
+            __m256i pass = _mm256_andnot_si256(_mm256_cmpgt_epi32(minPriority, priority), allOnes);
+            
+            if (predicate.excludeState) {
+                __m256i state = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.stateIds + row));
+                pass = _mm256_andnot_si256(_mm256_cmpeq_epi32(state, excluded), pass);
+            }
+            
+            if (!predicate.assignees.empty()) {
+                __m256i assignee = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.assigneeIds + row));
+                __m256i any = _mm256_setzero_si256();
+                for (int32_t value : predicate.assignees) {
+                    any = _mm256_or_si256(any, _mm256_cmpeq_epi32(assignee, _mm256_set1_epi32(value)));
+                }
+                pass = _mm256_and_si256(pass, any);
+            }
+            
+            __m256i due0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.dueTicks + row));
+            __m256i due1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.dueTicks + row + 4));
+            // Límites inclusivos: se marca lo que queda fuera y se invierte
+            __m256i outside0 = _mm256_or_si256(_mm256_cmpgt_epi64(from, due0), _mm256_cmpgt_epi64(due0, to));
+            __m256i outside1 = _mm256_or_si256(_mm256_cmpgt_epi64(from, due1), _mm256_cmpgt_epi64(due1, to));
+            
+            unsigned mask32 = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(pass)));
+            unsigned mask64 = ~(static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(outside0)))
+                              | (static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(outside1))) << 4));
+            word |= static_cast<uint64_t>(mask32 & mask64) << (step * 8);
+        }
+        words[w] = word;
+    }
+    
+    selectScalarFrom(columns, predicate, words, fullWords * BITS_PER_WORD);
+}
+
+#endif // SELECTION_KERNELS_X86
+
+SelectionKernels::Isa computeBestIsa() {
+#ifdef SELECTION_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SelectionKernels::Isa::AVX2;
+    if (__builtin_cpu_supports("sse4.2")) return SelectionKernels::Isa::SSE42;
+#endif
+    return SelectionKernels::Isa::SCALAR;
+}
+
+} // namespace
+
+// Selección
+void SelectionKernels::select(const Columns& columns, const Predicate& predicate,
+                              vector<uint64_t>& bitmap) {
+    select(columns, predicate, bitmap, detectIsa());
+}
+
+void SelectionKernels::select(const Columns& columns, const Predicate& predicate,
+                              vector<uint64_t>& bitmap, Isa isa) {
+    bitmap.assign((columns.count + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+    if (columns.count == 0) return;
+    
+    if (!isSupported(isa)) {
+        isa = Isa::SCALAR;
+    }
+    
+    switch (isa) {
+#ifdef SELECTION_KERNELS_X86
+        case Isa::AVX2:
+            selectAvx2(columns, predicate, bitmap.data());
+            break;
+        case Isa::SSE42:
+            selectSse42(columns, predicate, bitmap.data());
+            break;
+#endif
+        default:
+            selectScalarFrom(columns, predicate, bitmap.data(), 0);
+            break;
+    }
+}
+
+// Mapas de bits
+vector<uint32_t> SelectionKernels::toRows(const vector<uint64_t>& bitmap) {
+    vector<uint32_t> rows;
+    rows.reserve(countBits(bitmap));
+    
+    for (size_t w = 0; w < bitmap.size(); ++w) {
+        uint64_t word = bitmap[w];
+        while (word != 0) {
+            rows.push_back(static_cast<uint32_t>(w * BITS_PER_WORD + lowestBit(word)));
+            word &= word - 1;  // Apagar el bit más bajo
+        }
+    }
+    
+    return rows;
+}
+
+size_t SelectionKernels::countBits(const vector<uint64_t>& bitmap) {
+    size_t count = 0;
+    for (uint64_t word : bitmap) {
+#if defined(__GNUC__) || defined(__clang__)
+        count += static_cast<size_t>(__builtin_popcountll(word));
+#else
+        for (; word != 0; word &= word - 1) ++count;
+#endif
+    }
+    return count;
+}
+
+// CPU
+SelectionKernels::Isa SelectionKernels::detectIsa() {
+    static const Isa best = computeBestIsa();
+    return best;
+}
+
+bool SelectionKernels::isSupported(Isa isa) {
+    return static_cast<int>(isa) <= static_cast<int>(detectIsa());
+}
+
+const char* SelectionKernels::isaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX2:  return "AVX2";
+        case Isa::SSE42: return "SSE4.2";
+        default:         return "escalar";
+    }
+}
@@ -0,0 +1,61 @@
+#include "utils/StringPool.h"
+#include <mutex>
+
+using namespace std;
+
+// Constructor
+StringPool::StringPool() {
+    strings.emplace_back();
+    ids[strings.back()] = EMPTY_ID;
+}
+
+// Singleton
+StringPool& StringPool::getInstance() {
+    static StringPool instance;
+    return instance;
+}
+
+uint32_t StringPool::intern(const string& value) {
+    if (value.empty()) {
+        return EMPTY_ID;
+    }
+
+    {
+        shared_lock<shared_mutex> lock(mutex);
+        auto it = ids.find(value);
+        if (it != ids.end()) {
+            return it->second;
+        }
+    }
+
+    unique_lock<shared_mutex> lock(mutex);
+    auto it = ids.find(value);  // Otro hilo pudo agregarla mientras tanto
+    if (it != ids.end()) {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(strings.size());
+    strings.push_back(value);
+    ids.emplace(value, id);
+    return id;
+}
+
+bool StringPool::find(const string& value, uint32_t& id) const {
+    shared_lock<shared_mutex> lock(mutex);
+    auto it = ids.find(value);
+    if (it == ids.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+const string& StringPool::lookup(uint32_t id) const {
+    shared_lock<shared_mutex> lock(mutex);
+    return id < strings.size() ? strings[id] : strings[EMPTY_ID];
+}
+
+size_t StringPool::size() const {
+    shared_lock<shared_mutex> lock(mutex);
+    return strings.size();
+}
@@ -0,0 +1,39 @@
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Soporte mínimo para las pruebas: cada ejecutable corre sus casos
+ * con RUN_TEST y devuelve el resultado de testResult() desde main, que
+ * es lo que lee ctest
+ */
+namespace testing {
+    inline int failures = 0;
+    inline int checks = 0;
+}
+
+// Verifica una condición sin abortar el caso, para ver todas las fallas
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        ++testing::checks;                                                      \
+        if (!(condition)) {                                                     \
+            ++testing::failures;                                                \
+            cerr << __FILE__ << ":" << __LINE__ << ": falló " #condition "\n";  \
+        }                                                                       \
+    } while (0)
+
+#define RUN_TEST(test)                      \
+    do {                                    \
+        cout << "[ caso ] " #test << endl;  \
+        test();                             \
+    } while (0)
+
+inline int testResult() {
+    cout << testing::checks << " verificaciones, " << testing::failures << " fallas" << endl;
+    return testing::failures == 0 ? 0 : 1;
+}
+
+#endif // TEST_SUPPORT_H
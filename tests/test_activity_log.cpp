@@ -0,0 +1,294 @@
+#include "TestSupport.h"
+#include "models/ActivityLog.h"
+#include "utils/StringPool.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <atomic>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+string tempPath(const string& name) {
+    return (filesystem::temp_directory_path() / name).string();
+}
+
+size_t countLines(const string& path) {
+    ifstream file(path);
+    size_t lines = 0;
+    string line;
+    while (getline(file, line)) {
+        ++lines;
+    }
+    return lines;
+}
+
+void testRingBufferWrapsAround() {
+    RingBuffer<int> ring(4);
+    for (int i = 0; i < 10; ++i) {
+        ring.push(i);
+    }
+
+    CHECK(ring.full());
+    CHECK(ring.size() == 4);
+    CHECK(ring.front() == 6);
+    CHECK(ring.back() == 9);
+
+    int expected = 6;
+    for (int value : ring) {
+        CHECK(value == expected++);
+    }
+    CHECK(ring.end() - ring.begin() == 4);
+
+    ring.clear();
+    CHECK(ring.empty());
+    ring.push(42);
+    CHECK(ring.front() == 42 && ring.back() == 42);
+
+    // Sin capacidad está vacío y lleno a la vez: no hay front() que leer
+    RingBuffer<int> none(0);
+    none.push(1);
+    CHECK(none.empty() && none.full());
+    CHECK(none.begin() == none.end());
+}
+
+void testCompactStringInlineAndHeap() {
+    CompactString shortValue("En Progreso");
+    CompactString longValue(string(200, 'x'));
+    CompactString empty;
+
+    CHECK(shortValue == "En Progreso");
+    CHECK(longValue.size() == 200);
+    CHECK(longValue.str() == string(200, 'x'));
+    CHECK(empty.empty());
+
+    // Copias y movimientos conservan el valor en ambos modos
+    CompactString copy = longValue;
+    CompactString moved = move(copy);
+    CHECK(moved == longValue.view());
+    shortValue = longValue;
+    CHECK(shortValue.size() == 200);
+    longValue = "corto";
+    CHECK(longValue == "corto");
+}
+
+void testCompactEntryFields() {
+    // Marca de tiempo, dos ids, dos valores de 16 bytes y la acción
+    CHECK(sizeof(ActivityEntry) <= 56);
+
+    ActivityEntry moved("ana", ActivityEntry::Action::MOVED, "estado", "Pendiente",
+                        "En Progreso");
+    CHECK(moved.getUserName() == "ana");
+    CHECK(moved.getFieldModified() == "estado");
+    CHECK(moved.getOldValue() == "Pendiente");
+    CHECK(moved.getNewValue() == "En Progreso");
+    CHECK(moved.getActionType() == "moved");
+    CHECK(moved.getDescription() == "Movió de Pendiente a En Progreso");
+    CHECK(moved.toString().find("ana - moved (estado: 'Pendiente' → 'En Progreso')") !=
+          string::npos);
+
+    // Usuarios y campos repetidos comparten el mismo id internado
+    ActivityEntry other("ana", ActivityEntry::Action::UPDATED, "estado");
+    CHECK(other.userId == moved.userId);
+    CHECK(other.fieldId == moved.fieldId);
+    CHECK(StringPool::getInstance().lookup(other.userId) == "ana");
+
+    string description(5000, 'd');
+    ActivityEntry edited("luis", ActivityEntry::Action::UPDATED, "descripcion", "", description);
+    CHECK(edited.getNewValue() == description);
+    CHECK(edited.getDescription() == "Actualizó descripcion");
+}
+
+void testActionNamesRoundTrip() {
+    for (auto action : {ActivityEntry::Action::CREATED, ActivityEntry::Action::MOVED,
+                        ActivityEntry::Action::UPDATED, ActivityEntry::Action::ASSIGNED,
+                        ActivityEntry::Action::DELETED, ActivityEntry::Action::RESTORED}) {
+        ActivityEntry::Action parsed;
+        CHECK(ActivityEntry::actionFromString(ActivityEntry::actionToString(action), parsed));
+        CHECK(parsed == action);
+    }
+
+    ActivityEntry::Action parsed;
+    CHECK(!ActivityEntry::actionFromString("renamed", parsed));
+}
+
+void testLogKeepsNewestEntries() {
+    ActivityLog log(5);
+    for (int i = 0; i < 12; ++i) {
+        log.logMove("ana", "s" + to_string(i), "s" + to_string(i + 1));
+    }
+
+    CHECK(log.getSize() == 5);
+
+    // Quedan las cinco más recientes, en orden cronológico
+    vector<StateTransition> transitions = log.getStateTransitions();
+    CHECK(transitions.size() == 5);
+    for (size_t i = 0; i < transitions.size(); ++i) {
+        CHECK(transitions[i].fromState == "s" + to_string(7 + i));
+    }
+}
+
+void testEvictedEntriesSpillToArchive() {
+    string path = tempPath("activity_log_spill_test.log");
+    remove(path.c_str());
+
+    {
+        ActivityLog log(10);
+        log.setArchivePath(path);
+        for (int i = 0; i < 210; ++i) {
+            log.logUpdate("luis", "titulo", "v" + to_string(i), "v" + to_string(i + 1));
+        }
+
+        CHECK(log.getSize() == 10);
+        CHECK(log.flushArchive());
+        CHECK(log.getArchivedCount() == 200);
+    }
+
+    CHECK(countLines(path) == 200);
+
+    // La primera línea es la entrada más antigua
+    ifstream file(path);
+    string first;
+    getline(file, first);
+    CHECK(first.rfind("ENTRY|", 0) == 0);
+    CHECK(first.find("|v0|v1|") != string::npos);
+
+    file.close();
+    remove(path.c_str());
+}
+
+void testWithoutArchiveEvictionDrops() {
+    ActivityLog log(3);
+    for (int i = 0; i < 100; ++i) {
+        log.logDeletion("ana");
+    }
+    CHECK(log.getSize() == 3);
+    CHECK(log.getArchivedCount() == 0);
+}
+
+// Capacidad 0: nada queda en memoria; con archivo, todo va directo a él
+void testZeroCapacityLog() {
+    ActivityLog dropping(0);
+    dropping.logDeletion("ana");
+    CHECK(dropping.getSize() == 0);
+    CHECK(dropping.getEntries().empty());
+
+    string path = tempPath("activity_log_zero_test.log");
+    remove(path.c_str());
+    {
+        ActivityLog log(0);
+        log.setArchivePath(path);
+        for (int i = 0; i < 5; ++i) {
+            log.logUpdate("luis", "titulo", "v" + to_string(i), "v" + to_string(i + 1));
+        }
+        CHECK(log.getSize() == 0);
+        CHECK(log.flushArchive());
+        CHECK(log.getArchivedCount() == 5);
+    }
+    CHECK(countLines(path) == 5);
+    remove(path.c_str());
+}
+
+void testDateRangeQueries() {
+    ActivityLog log(100);
+    auto base = chrono::system_clock::now();
+    for (int i = 0; i < 100; ++i) {
+        log.addEntry(ActivityEntry(base + chrono::minutes(i), 0, 0,
+                                   ActivityEntry::Action::UPDATED, "", ""));
+    }
+    CHECK(log.isSortedByTime());
+
+    // Extremos incluidos
+    auto start = base + chrono::minutes(10);
+    auto end = base + chrono::minutes(19);
+    CHECK(log.countByDateRange(start, end) == 10);
+    CHECK(log.getEntriesByDateRange(start, end).size() == 10);
+
+    int64_t previous = 0;
+    size_t visited = 0;
+    log.forEachInDateRange(start, end, [&](const ActivityEntry& entry) {
+        CHECK(entry.getTimestamp() >= start && entry.getTimestamp() <= end);
+        CHECK(entry.timestampTicks >= previous);
+        previous = entry.timestampTicks;
+        ++visited;
+    });
+    CHECK(visited == 10);
+
+    // Una entrada fuera de orden pasa al recorrido lineal con el mismo resultado
+    log.addEntry(ActivityEntry(base + chrono::minutes(15), 0, 0,
+                               ActivityEntry::Action::UPDATED, "", ""));
+    CHECK(!log.isSortedByTime());
+    CHECK(log.countByDateRange(start, end) == 11);  // Se desalojó la del minuto 0, fuera del rango
+}
+
+void testQueriesDuringConcurrentAppends() {
+    const size_t capacity = 256;
+    const int writers = 3;
+    const int appendsPerWriter = 20000;
+
+    ActivityLog log(static_cast<int>(capacity));
+    auto start = chrono::system_clock::now() - chrono::hours(1);
+    auto end = chrono::system_clock::now() + chrono::hours(1);
+
+    atomic<bool> done(false);
+    atomic<int> badReads(0);
+
+    vector<thread> threads;
+    for (int w = 0; w < writers; ++w) {
+        threads.emplace_back([&log]() {
+            for (int i = 0; i < appendsPerWriter; ++i) {
+                log.logUpdate("escritor", "campo", "", "valor");
+            }
+        });
+    }
+
+    // Lectores: cada consulta ve un estado consistente del buffer
+    for (int r = 0; r < 2; ++r) {
+        threads.emplace_back([&]() {
+            while (!done.load()) {
+                size_t counted = log.countByDateRange(start, end);
+                size_t visited = 0;
+                log.forEachInDateRange(start, end, [&visited](const ActivityEntry& entry) {
+                    if (entry.getNewValue() == "valor") ++visited;
+                });
+                vector<ActivityEntry> copy = log.getEntries();
+                if (counted > capacity || visited > capacity || copy.size() > capacity) {
+                    badReads++;
+                }
+                for (const auto& entry : copy) {
+                    if (entry.getFieldModified() != "campo") badReads++;
+                }
+            }
+        });
+    }
+
+    for (int w = 0; w < writers; ++w) {
+        threads[w].join();
+    }
+    done = true;
+    for (size_t t = writers; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    CHECK(badReads.load() == 0);
+    CHECK(log.getSize() == capacity);
+    CHECK(log.countByDateRange(start, end) == capacity);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testRingBufferWrapsAround);
+    RUN_TEST(testCompactStringInlineAndHeap);
+    RUN_TEST(testCompactEntryFields);
+    RUN_TEST(testActionNamesRoundTrip);
+    RUN_TEST(testLogKeepsNewestEntries);
+    RUN_TEST(testEvictedEntriesSpillToArchive);
+    RUN_TEST(testWithoutArchiveEvictionDrops);
+    RUN_TEST(testZeroCapacityLog);
+    RUN_TEST(testDateRangeQueries);
+    RUN_TEST(testQueriesDuringConcurrentAppends);
+    return testResult();
+}
@@ -0,0 +1,95 @@
+#include "TestSupport.h"
+#include "ui/CardRenderer.h"
+#include "ui/TaskCard.h"
+#include "utils/PerfMonitor.h"
+#include <QApplication>
+#include <QEvent>
+#include <QImage>
+#include <QPixmapCache>
+
+using namespace std;
+
+namespace {
+
+uint64_t renderCount() {
+    for (const auto& operation : PerfMonitor::instance().getSnapshot(100).operations) {
+        if (operation.name == "CardRenderer::renderCard") return operation.count;
+    }
+    return 0;
+}
+
+QImage paintCard(const Task& task, CardRenderer::State state) {
+    const CardRenderer& renderer = CardRenderer::instance();
+    QImage image(280, renderer.getHeight(), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    renderer.paint(&painter, image.rect(), task, state);
+    return image;
+}
+
+// La tarjeta se dibuja una vez por versión de contenido, tamaño y estado
+void testCardIsRenderedOncePerVersion() {
+    PerfMonitor::instance().reset();
+    QPixmapCache::clear();
+    Task task(1, "Revisar informe");
+
+    QImage first = paintCard(task, CardRenderer::State::NORMAL);
+    QImage second = paintCard(task, CardRenderer::State::NORMAL);
+    CHECK(renderCount() == 1);
+    CHECK(first == second);
+
+    task.setTitle("Revisar informe final", "prueba");
+    QImage edited = paintCard(task, CardRenderer::State::NORMAL);
+    CHECK(renderCount() == 2);
+    CHECK(edited != first);
+
+    QImage hovered = paintCard(task, CardRenderer::State::HOVER);
+    CHECK(renderCount() == 3);
+    CHECK(hovered != edited);
+
+    // Volver al estado anterior sale de la caché
+    paintCard(task, CardRenderer::State::NORMAL);
+    CHECK(renderCount() == 3);
+}
+
+// Sin caché el resultado es el mismo: la caché no cambia lo que se ve
+void testCachedMatchesUncached() {
+    Task task(2, "Tarea con etiquetas");
+    task.addTag("backend");
+    task.setPriority(4);
+
+    QPixmapCache::clear();
+    QImage cold = paintCard(task, CardRenderer::State::SELECTED);
+    QImage warm = paintCard(task, CardRenderer::State::SELECTED);
+    CHECK(cold == warm);
+}
+
+// Hover no crea efectos ni hojas de estilo por tarjeta
+void testTaskCardUsesSharedStyle() {
+    auto task = make_shared<Task>(3, "Tarjeta");
+    TaskCard card(task);
+    card.resize(card.sizeHint());
+
+    QEvent enter(QEvent::Enter);
+    QEvent leave(QEvent::Leave);
+    for (int i = 0; i < 10; ++i) {
+        QApplication::sendEvent(&card, &enter);
+        card.grab();
+        QApplication::sendEvent(&card, &leave);
+        card.grab();
+    }
+    CHECK(card.graphicsEffect() == nullptr);
+    CHECK(card.styleSheet().isEmpty());
+    CHECK(card.findChildren<QWidget*>().isEmpty());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    QApplication app(argc, argv);
+    PerfMonitor::instance().setEnabled(true);
+    RUN_TEST(testCardIsRenderedOncePerVersion);
+    RUN_TEST(testCachedMatchesUncached);
+    RUN_TEST(testTaskCardUsesSharedStyle);
+    return testResult();
+}
@@ -0,0 +1,113 @@
+#include "TestSupport.h"
+#include "managers/CycleTimeManager.h"
+#include "models/Project.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+shared_ptr<Project> makeProject(int taskCount) {
+    auto project = make_shared<Project>(1, "Ciclos");
+    auto board = project->createBoard("Tablero");
+    for (int i = 0; i < taskCount; ++i) {
+        auto task = board->createTask("Tarea " + to_string(i), "");
+        if (i % 2 == 0) {
+            board->moveTask(task->getId(), "En Progreso", "prueba");
+            board->moveTask(task->getId(), "Terminado", "prueba");
+        }
+    }
+    return project;
+}
+
+void testMovesUpdateWithoutRebuild() {
+    auto project = makeProject(10);
+    auto board = project->getBoards().front();
+    int boardId = board->getId();
+
+    CycleTimeManager cycles;
+    cycles.rebuild(board);
+    cycles.attach(project->getEventBus());
+    CHECK(cycles.getLeadTime(boardId).count == 5);
+
+    board->moveTask(2, "En Progreso", "prueba");
+    board->moveTask(2, "Terminado", "prueba");
+    auto created = board->createTask("Nueva", "");
+    board->moveTask(created->getId(), "Terminado", "prueba");
+
+    CHECK(cycles.getLeadTime(boardId).count == 7);
+    CHECK(cycles.getCycleTime(boardId, "En Progreso").count == 6);
+    CHECK(cycles.getCycleTime(boardId, "Pendiente").count == 7);
+
+    // El resultado incremental coincide con recorrer el historial de nuevo
+    CycleTimeManager fresh;
+    fresh.rebuild(board);
+    CHECK(fresh.getLeadTime(boardId).count == cycles.getLeadTime(boardId).count);
+    CHECK(fresh.getCycleTime(boardId, "En Progreso").count ==
+          cycles.getCycleTime(boardId, "En Progreso").count);
+    CHECK(fresh.getCycleTime(boardId, "Pendiente").count ==
+          cycles.getCycleTime(boardId, "Pendiente").count);
+}
+
+void testRestoredTaskKeepsMeasuredTimes() {
+    auto project = makeProject(4);
+    auto board = project->getBoards().front();
+    int boardId = board->getId();
+
+    CycleTimeManager cycles;
+    cycles.rebuild(board);
+    cycles.attach(project->getEventBus());
+
+    auto task = board->findTaskById(1);
+    board->removeTask(1);
+    board->addTask(task, task->getState());
+
+    // Restaurar no vuelve a contar los movimientos anteriores
+    CHECK(cycles.getLeadTime(boardId).count == 2);
+    CHECK(cycles.getCycleTime(boardId, "En Progreso").count == 2);
+}
+
+void testBoardEvents() {
+    auto project = makeProject(4);
+    CycleTimeManager cycles;
+    for (const auto& board : project->getBoards()) {
+        cycles.rebuild(board);
+    }
+    cycles.attach(project->getEventBus());
+
+    auto added = project->createBoard("Otro");
+    CHECK(cycles.isTracking(added->getId()));
+    auto task = added->createTask("Tarea", "");
+    added->moveTask(task->getId(), "Terminado", "prueba");
+    CHECK(cycles.getLeadTime(added->getId()).count == 1);
+
+    added->clearAllTasks();
+    CHECK(cycles.isTracking(added->getId()));
+    CHECK(cycles.getLeadTime(added->getId()).count == 0);
+
+    project->removeBoard(added->getId());
+    CHECK(!cycles.isTracking(added->getId()));
+}
+
+void testDetachStopsUpdates() {
+    auto project = makeProject(4);
+    auto board = project->getBoards().front();
+
+    CycleTimeManager cycles;
+    cycles.rebuild(board);
+    cycles.attach(project->getEventBus());
+    cycles.detach();
+
+    board->moveTask(2, "Terminado", "prueba");
+    CHECK(cycles.getLeadTime(board->getId()).count == 2);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testMovesUpdateWithoutRebuild);
+    RUN_TEST(testRestoredTaskKeepsMeasuredTimes);
+    RUN_TEST(testBoardEvents);
+    RUN_TEST(testDetachStopsUpdates);
+    return testResult();
+}
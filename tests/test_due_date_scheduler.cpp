@@ -0,0 +1,130 @@
+#include "TestSupport.h"
+#include "managers/NotificationManager.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+using Clock = chrono::system_clock;
+using Type = Notification::Type;
+
+const Clock::duration TICK(1);
+const Clock::duration LEAD = chrono::hours(48);
+
+// Fecha límite fija y lejana, para no depender del reloj real
+Clock::time_point dueDate() {
+    return Clock::time_point(chrono::hours(24 * 365 * 60));
+}
+
+struct Fixture {
+    shared_ptr<Board> board = make_shared<Board>(1, "Vencimientos");
+    NotificationManager manager;
+    shared_ptr<Task> task;
+
+    Fixture() {
+        task = board->createTask("Con fecha", "");
+        task->setAssignedUserId(1, "ana");
+        task->setDueDate(dueDate());
+        manager.getDueDateScheduler()->watchBoard(board);
+    }
+
+    Type lastType() {
+        return manager.getNotificationsByUser(1).back().type;
+    }
+};
+
+// Cada aviso sale exactamente en su umbral, ni un tick antes
+void testAlertsFireAtThresholds() {
+    Fixture fixture;
+    auto& manager = fixture.manager;
+    CHECK(manager.getNextDueDateCheck() == dueDate() - LEAD);
+
+    CHECK(manager.processDueDates(dueDate() - LEAD - TICK) == 0);
+    CHECK(manager.processDueDates(dueDate() - LEAD) == 1);
+    CHECK(fixture.lastType() == Type::TASK_DUE_SOON);
+    CHECK(manager.processDueDates(dueDate() - LEAD) == 0);
+
+    // En la fecha límite todavía no está vencida
+    CHECK(manager.getNextDueDateCheck() == dueDate() + TICK);
+    CHECK(manager.processDueDates(dueDate()) == 0);
+    CHECK(manager.processDueDates(dueDate() + TICK) == 1);
+    CHECK(fixture.lastType() == Type::TASK_OVERDUE);
+    CHECK(manager.getNextDueDateCheck() == Clock::time_point::max());
+}
+
+void testSetDueDateReschedules() {
+    Fixture fixture;
+    auto& manager = fixture.manager;
+    auto later = dueDate() + chrono::hours(24 * 5);
+
+    fixture.task->setDueDate(later);
+    CHECK(manager.getNextDueDateCheck() == later - LEAD);
+    CHECK(manager.processDueDates(dueDate() + TICK) == 0);
+    CHECK(manager.processDueDates(later - LEAD) == 1);
+
+    // Una fecha nueva vuelve a habilitar el aviso ya emitido; como el
+    // anterior sigue sin leer, la bandeja lo deduplica
+    fixture.task->setDueDate(dueDate());
+    CHECK(manager.processDueDates(dueDate() - LEAD) == 1);
+    CHECK(manager.getNotificationCount(1) == 1);
+    CHECK(manager.getDeduplicatedCount() == 1);
+}
+
+// Las entradas de generaciones anteriores no producen avisos
+void testStaleEntriesAreDiscarded() {
+    Fixture fixture;
+    auto& manager = fixture.manager;
+
+    for (int i = 1; i <= 1000; ++i) {
+        fixture.task->setDueDate(dueDate() + chrono::minutes(i));
+    }
+    auto last = dueDate() + chrono::minutes(1000);
+    CHECK(manager.getNextDueDateCheck() == last - LEAD);
+    CHECK(manager.getDueDateScheduler()->getScheduledTaskCount() == 1);
+
+    // Más allá de todas: solo el aviso de vencida de la última fecha
+    CHECK(manager.processDueDates(last + chrono::hours(1)) == 1);
+    CHECK(fixture.lastType() == Type::TASK_OVERDUE);
+    CHECK(!manager.getDueDateScheduler()->hasPending());
+}
+
+void testMoveToDoneCancelsAlerts() {
+    Fixture fixture;
+    auto& manager = fixture.manager;
+
+    fixture.board->moveTask(fixture.task->getId(), "Terminado", "ana");
+    CHECK(!manager.getDueDateScheduler()->hasPending());
+    CHECK(manager.getNextDueDateCheck() == Clock::time_point::max());
+    CHECK(manager.processDueDates(dueDate() + chrono::hours(1)) == 0);
+
+    // Reabierta con la misma fecha vuelve a programarse
+    fixture.board->moveTask(fixture.task->getId(), "Pendiente", "ana");
+    CHECK(manager.getNextDueDateCheck() == dueDate() - LEAD);
+}
+
+void testClearDropsEverything() {
+    Fixture fixture;
+    auto& manager = fixture.manager;
+    auto scheduler = manager.getDueDateScheduler();
+
+    scheduler->clear();
+    CHECK(manager.getNextDueDateCheck() == Clock::time_point::max());
+    CHECK(scheduler->getScheduledTaskCount() == 0);
+
+    // Sin suscripciones, los cambios ya no programan nada
+    fixture.task->setDueDate(dueDate() + chrono::hours(1));
+    CHECK(manager.getNextDueDateCheck() == Clock::time_point::max());
+    CHECK(manager.processDueDates(dueDate() + chrono::hours(2)) == 0);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testAlertsFireAtThresholds);
+    RUN_TEST(testSetDueDateReschedules);
+    RUN_TEST(testStaleEntriesAreDiscarded);
+    RUN_TEST(testMoveToDoneCancelsAlerts);
+    RUN_TEST(testClearDropsEverything);
+    return testResult();
+}
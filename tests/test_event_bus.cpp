@@ -0,0 +1,112 @@
+#include "TestSupport.h"
+#include "AllocationCounter.h"
+#include "models/EventBus.h"
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+size_t liveBytes() {
+    return allocation::liveBytes.load();
+}
+
+void testDeliveryAndUnsubscribe() {
+    EventBus bus;
+    int received = 0;
+    auto subscription = bus.subscribe<BoardCleared>([&](const BoardCleared& event) {
+        received += event.boardId;
+    });
+
+    bus.publish(BoardCleared{3});
+    CHECK(received == 3);
+    CHECK(bus.getSubscriberCount(ModelEventType::BOARD_CLEARED) == 1);
+
+    CHECK(bus.unsubscribe(subscription));
+    CHECK(!bus.unsubscribe(subscription));
+    bus.publish(BoardCleared{3});
+    CHECK(received == 3);
+    CHECK(!bus.hasSubscribers<BoardCleared>());
+}
+
+// Cada cambio de suscripción reemplaza la lista; las viejas se liberan
+void testSubscribeLoopKeepsMemoryFlat() {
+    EventBus bus;
+    auto keep = bus.subscribe<TaskMoved>([](const TaskMoved&) {});
+    int received = 0;
+
+    auto cycle = [&]() {
+        auto subscription = bus.subscribe<TaskMoved>([&](const TaskMoved&) { ++received; });
+        bus.publish(TaskMoved{});
+        bus.unsubscribe(subscription);
+    };
+    for (int i = 0; i < 100; ++i) cycle();
+
+    size_t before = liveBytes();
+    for (int i = 0; i < 100000; ++i) cycle();
+    size_t after = liveBytes();
+
+    CHECK(received == 100100);
+    CHECK(after <= before);
+    bus.unsubscribe(keep);
+}
+
+// Desuscribirse durante la entrega: la lista en uso se libera al terminar
+void testUnsubscribeDuringDelivery() {
+    EventBus bus;
+    bus.unsubscribe(bus.subscribe<FieldChanged>([](const FieldChanged&) {}));
+    size_t before = liveBytes();
+
+    for (int i = 0; i < 10000; ++i) {
+        EventBus::Subscription self;
+        int calls = 0;
+        self = bus.subscribe<FieldChanged>([&](const FieldChanged&) {
+            ++calls;
+            bus.unsubscribe(self);
+        });
+        bus.publish(FieldChanged{});
+        bus.publish(FieldChanged{});
+        CHECK(calls == 1);
+    }
+
+    CHECK(bus.getSubscriberCount(ModelEventType::FIELD_CHANGED) == 0);
+    CHECK(liveBytes() <= before);
+}
+
+// Un hilo publica sin parar mientras otro suscribe y desuscribe
+void testConcurrentPublishReclaims() {
+    EventBus bus;
+    atomic<bool> stop(false);
+    atomic<long> delivered(0);
+    auto keep = bus.subscribe<TaskCreated>([&](const TaskCreated&) { delivered++; });
+
+    thread publisher([&]() {
+        while (!stop.load()) {
+            bus.publish(TaskCreated{});
+        }
+    });
+
+    size_t before = liveBytes();
+    for (int i = 0; i < 20000; ++i) {
+        auto subscription = bus.subscribe<TaskCreated>([](const TaskCreated&) {});
+        bus.unsubscribe(subscription);
+    }
+    stop = true;
+    publisher.join();
+
+    // Lo que quedó retirado por una publicación en curso sale en el próximo cambio
+    bus.unsubscribe(bus.subscribe<TaskCreated>([](const TaskCreated&) {}));
+    CHECK(liveBytes() <= before);
+    CHECK(delivered.load() > 0);
+    bus.unsubscribe(keep);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testDeliveryAndUnsubscribe);
+    RUN_TEST(testSubscribeLoopKeepsMemoryFlat);
+    RUN_TEST(testUnsubscribeDuringDelivery);
+    RUN_TEST(testConcurrentPublishReclaims);
+    return testResult();
+}
@@ -0,0 +1,175 @@
+#include "TestSupport.h"
+#include "models/Project.h"
+#include "models/EventStore.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+shared_ptr<Board> makeBoard(shared_ptr<Project> project, int taskCount) {
+    auto board = project->createBoard("Tablero");
+    for (int i = 0; i < taskCount; ++i) {
+        auto task = board->createTask("Tarea " + to_string(i), "");
+        board->moveTask(task->getId(), "En Progreso", "ana");
+        board->moveTask(task->getId(), "Terminado", "luis");
+    }
+    return board;
+}
+
+void testClearedBoardDoesNotLeakHistory() {
+    auto project = make_shared<Project>(1, "Store");
+    auto board = makeBoard(project, 3);
+    auto oldTask = board->findTaskById(1);
+    CHECK(oldTask->getStateTransitions().size() == 2);
+
+    board->clearAllTasks();
+    auto fresh = board->createTask("Nueva", "");
+
+    // Mismo tablero y mismo id, pero sin la historia de la tarea anterior
+    CHECK(fresh->getId() == 1);
+    CHECK(fresh->getStateTransitions().empty());
+    CHECK(fresh->getActivityCount() == 0);
+
+    // La tarea quitada conserva la suya y el store no pierde filas
+    CHECK(oldTask->getStateTransitions().size() == 2);
+    CHECK(project->getEventStore()->getRowsByAction(ActivityEntry::Action::MOVED).size() == 6);
+}
+
+void testRemovedIdReuseStartsEmpty() {
+    auto project = make_shared<Project>(1, "Store");
+    auto board = makeBoard(project, 2);
+
+    board->removeTask(2);
+    auto reused = board->allocateTask(2, "Reutilizada");
+    board->addTask(reused, "Pendiente");
+
+    CHECK(reused->getStateTransitions().empty());
+    board->moveTask(2, "En Progreso", "ana");
+    CHECK(reused->getStateTransitions().size() == 1);
+}
+
+void testRestoredTaskKeepsHistory() {
+    auto project = make_shared<Project>(1, "Store");
+    auto board = makeBoard(project, 2);
+
+    // Como deshacer una eliminación: el mismo objeto vuelve al tablero
+    auto task = board->findTaskById(1);
+    board->removeTask(1);
+    board->addTask(task, task->getState());
+
+    CHECK(task->getStateTransitions().size() == 2);
+    board->moveTask(1, "Pendiente", "ana");
+    CHECK(task->getStateTransitions().size() == 3);
+}
+
+void testStreamsAreKeyedPerBoard() {
+    EventStore store;
+    auto a = store.registerStream(1, 7);
+    auto b = store.registerStream(2, 7);
+    CHECK(a != b);
+    CHECK(store.registerStream(1, 7) == a);
+
+    store.releaseStream(1, 7);
+    auto c = store.registerStream(1, 7);
+    CHECK(c != a);
+    CHECK(store.getStreamOwner(a) == make_pair(1, 7));
+    CHECK(store.getStreamOwner(c) == make_pair(1, 7));
+}
+
+void testCrossTaskQueries() {
+    auto project = make_shared<Project>(1, "Store");
+    makeBoard(project, 4);
+    auto store = project->getEventStore();
+
+    CHECK(store->getRowsByUser("ana").size() == 4);
+    CHECK(store->getRowsByUser("nadie").empty());
+
+    auto start = chrono::system_clock::now() - chrono::hours(1);
+    auto end = chrono::system_clock::now() + chrono::hours(1);
+    CHECK(store->countByDateRange(start, end) == store->getSize());
+    CHECK(store->countByDateRange(end, end + chrono::hours(1)) == 0);
+}
+
+// Las consultas devuelven copias: un cambio posterior no aparece en ellas
+void testActivityEntriesAreSnapshots() {
+    Task loose(1, "Suelta");
+    CHECK(loose.getActivityEntries().empty());
+    loose.setTitle("Cambiada", "ana");
+    CHECK(loose.getActivityCount() == 1);
+
+    auto project = make_shared<Project>(1, "Store");
+    auto board = makeBoard(project, 1);
+    auto task = board->findTaskById(1);
+    auto before = task->getActivityEntries();
+    board->moveTask(1, "Pendiente", "ana");
+    CHECK(task->getActivityEntries().size() == before.size() + 1);
+    CHECK(task->getActivityCount() == before.size() + 1);
+}
+
+void testCompactionDropsReleasedStreams() {
+    auto project = make_shared<Project>(1, "Store");
+    auto board = makeBoard(project, 4);
+    auto store = project->getEventStore();
+    auto kept = board->findTaskById(3);
+    size_t keptEvents = kept->getActivityCount();
+    size_t total = store->getSize();
+
+    board->removeTask(1);
+    board->removeTask(2);
+    CHECK(store->getReleasedRowCount() == total / 2);
+    CHECK(store->compact() == total / 2);
+    CHECK(store->getSize() == total / 2);
+    CHECK(store->getReleasedRowCount() == 0);
+
+    // Lo que queda sigue consultable, con los índices renumerados
+    CHECK(kept->getActivityCount() == keptEvents);
+    CHECK(kept->getStateTransitions().size() == 2);
+    CHECK(store->getRowsByUser("ana").size() == 2);
+    CHECK(store->getRowsByAction(ActivityEntry::Action::MOVED).size() == 4);
+    auto start = chrono::system_clock::now() - chrono::hours(1);
+    CHECK(store->countByDateRange(start, start + chrono::hours(2)) == store->getSize());
+    for (auto row : store->getRowsByUser("luis")) {
+        CHECK(store->getEntry(row).getUserName() == "luis");
+    }
+
+    board->moveTask(3, "Pendiente", "ana");
+    CHECK(kept->getStateTransitions().size() == 3);
+}
+
+// Crear y quitar tareas sin fin no hace crecer el store sin límite
+void testRetentionBoundsLongSessions() {
+    auto project = make_shared<Project>(1, "Store");
+    auto board = project->createBoard("Tablero");
+    auto store = project->getEventStore();
+    store->setCompactionMinRows(100);
+    auto live = board->createTask("Viva", "");
+
+    size_t peak = 0;
+    for (int i = 0; i < 2000; ++i) {
+        auto task = board->createTask("Temporal", "");
+        board->moveTask(task->getId(), "En Progreso", "ana");
+        board->moveTask(task->getId(), "Terminado", "ana");
+        board->removeTask(task->getId());
+        board->moveTask(live->getId(), i % 2 ? "Pendiente" : "En Progreso", "luis");
+        peak = max(peak, store->getSize());
+    }
+
+    // Basura como mucho igual a lo vivo (más el mínimo)
+    CHECK(peak <= 2 * (2000 + 200));
+    CHECK(live->getStateTransitions().size() == 2000);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testClearedBoardDoesNotLeakHistory);
+    RUN_TEST(testRemovedIdReuseStartsEmpty);
+    RUN_TEST(testRestoredTaskKeepsHistory);
+    RUN_TEST(testStreamsAreKeyedPerBoard);
+    RUN_TEST(testCrossTaskQueries);
+    RUN_TEST(testActivityEntriesAreSnapshots);
+    RUN_TEST(testCompactionDropsReleasedStreams);
+    RUN_TEST(testRetentionBoundsLongSessions);
+    return testResult();
+}
@@ -0,0 +1,111 @@
+#include "TestSupport.h"
+#include "managers/FlowMetricsManager.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+// Tablero con tareas repartidas entre los tres estados
+shared_ptr<Board> makeBoard(int taskCount) {
+    auto board = make_shared<Board>(1, "Flujo");
+    for (int i = 0; i < taskCount; ++i) {
+        auto task = board->createTask("Tarea " + to_string(i), "");
+        if (i % 2 == 1) {
+            board->moveTask(task->getId(), "En Progreso", "prueba");
+        }
+        if (i % 4 == 1) {
+            board->moveTask(task->getId(), "Terminado", "prueba");
+        }
+    }
+    return board;
+}
+
+bool sameSeries(const FlowSeries& a, const FlowSeries& b) {
+    return a.states == b.states && a.bucketStarts == b.bucketStarts &&
+           a.cumulativeByState == b.cumulativeByState && a.remaining == b.remaining &&
+           a.throughput == b.throughput;
+}
+
+FlowSeries rebuiltSeries(shared_ptr<Board> board, unsigned int threads = 1) {
+    FlowMetricsManager fresh;
+    fresh.rebuild(board, threads);
+    return fresh.getSeries(board->getId());
+}
+
+void testParallelRebuildMatchesSerial() {
+    auto board = makeBoard(3000);
+    FlowSeries serial = rebuiltSeries(board, 1);
+    FlowSeries parallel = rebuiltSeries(board, 4);
+
+    CHECK(sameSeries(serial, parallel));
+    CHECK(serial.throughput.back() == 750);
+    CHECK(serial.remaining.back() == 2250);
+}
+
+void testIncrementalMovesMatchRebuild() {
+    auto board = makeBoard(200);
+    FlowMetricsManager flow;
+    flow.rebuild(board);
+    flow.attach(board->getEventBus());
+
+    board->moveTask(2, "En Progreso", "prueba");
+    board->moveTask(2, "Terminado", "prueba");
+    auto created = board->createTask("Nueva", "");
+    board->moveTask(created->getId(), "Terminado", "prueba");
+
+    CHECK(sameSeries(flow.getSeries(1), rebuiltSeries(board)));
+}
+
+void testRemovalDropsWholeHistory() {
+    auto board = makeBoard(200);
+    FlowMetricsManager flow;
+    flow.rebuild(board);
+    flow.attach(board->getEventBus());
+
+    int throughputBefore = flow.getSeries(1).throughput.back();
+
+    // Terminada: también debe desaparecer su finalización, como en rebuild()
+    board->removeTask(2);
+    // En progreso y pendiente
+    board->removeTask(4);
+    board->removeTask(5);
+
+    const FlowSeries& incremental = flow.getSeries(1);
+    CHECK(incremental.throughput.back() == throughputBefore - 1);
+    CHECK(sameSeries(incremental, rebuiltSeries(board)));
+}
+
+void testRestoredTaskReplaysHistory() {
+    auto board = makeBoard(50);
+    FlowMetricsManager flow;
+    flow.rebuild(board);
+    flow.attach(board->getEventBus());
+
+    auto task = board->findTaskById(2);
+    board->removeTask(2);
+    board->addTask(task, task->getState());
+
+    CHECK(sameSeries(flow.getSeries(1), rebuiltSeries(board)));
+}
+
+void testUntrackedBoardIgnored() {
+    auto board = makeBoard(10);
+    FlowMetricsManager flow;
+    flow.attach(board->getEventBus());
+
+    board->removeTask(1);
+    CHECK(!flow.isTracking(1));
+    CHECK(flow.getSeries(1).getBucketCount() == 0);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testParallelRebuildMatchesSerial);
+    RUN_TEST(testIncrementalMovesMatchRebuild);
+    RUN_TEST(testRemovalDropsWholeHistory);
+    RUN_TEST(testRestoredTaskReplaysHistory);
+    RUN_TEST(testUntrackedBoardIgnored);
+    return testResult();
+}
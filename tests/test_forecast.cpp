@@ -0,0 +1,93 @@
+#include "TestSupport.h"
+#include "managers/ForecastManager.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+vector<shared_ptr<Task>> makeTasks(int count) {
+    vector<shared_ptr<Task>> tasks;
+    for (int i = 1; i <= count; ++i) {
+        tasks.push_back(make_shared<Task>(i, "Tarea " + to_string(i)));
+    }
+    return tasks;
+}
+
+bool sameResult(const ForecastResult& a, const ForecastResult& b) {
+    return a.valid == b.valid && a.blockedTrials == b.blockedTrials &&
+           a.p50Days == b.p50Days && a.p85Days == b.p85Days && a.p95Days == b.p95Days;
+}
+
+void testSeedReproducibleAcrossThreadCounts() {
+    auto tasks = makeTasks(200);
+    for (int i = 10; i < 200; i += 10) {
+        tasks[i]->addDependency(i - 5);
+    }
+    vector<int> history = {0, 3, 1, 7, 2, 0, 5, 4, 9, 1, 0, 2};
+
+    ForecastManager serial(1);
+    ForecastResult reference = serial.forecast(tasks, history, 20000, 1234);
+    CHECK(reference.valid);
+    CHECK(reference.p50Days <= reference.p85Days);
+    CHECK(reference.p85Days <= reference.p95Days);
+
+    for (unsigned int threads : {2u, 3u, 8u}) {
+        ForecastManager parallel(threads);
+        CHECK(sameResult(reference, parallel.forecast(tasks, history, 20000, 1234)));
+    }
+
+    // Misma semilla, mismo resultado al repetir
+    CHECK(sameResult(reference, serial.forecast(tasks, history, 20000, 1234)));
+}
+
+void testConstantThroughputIsExact() {
+    ForecastManager forecaster(4);
+    ForecastResult result = forecaster.forecast(makeTasks(10), {2, 2, 2}, 1000, 7);
+
+    CHECK(result.valid);
+    CHECK(result.p50Days == 5);
+    CHECK(result.p95Days == 5);
+    CHECK(result.blockedTrials == 0);
+}
+
+void testDependencyChainTakesOneDayPerLink() {
+    auto tasks = makeTasks(5);
+    for (int i = 1; i < 5; ++i) {
+        tasks[i]->addDependency(i);  // La tarea i+1 depende de la i
+    }
+
+    ForecastManager forecaster(2);
+    ForecastResult result = forecaster.forecast(tasks, {10}, 500, 1);
+    CHECK(result.p50Days == 5);
+    CHECK(result.p95Days == 5);
+}
+
+void testCycleBlocksEveryTrial() {
+    auto tasks = makeTasks(3);
+    tasks[0]->addDependency(2);
+    tasks[1]->addDependency(1);
+
+    ForecastManager forecaster(2, 30, 365);
+    ForecastResult result = forecaster.forecast(tasks, {1, 2}, 600, 3);
+    CHECK(result.valid);
+    CHECK(result.blockedTrials == 600);
+    CHECK(result.p50Days == 365);
+}
+
+void testNoHistoryIsInvalid() {
+    ForecastManager forecaster;
+    CHECK(!forecaster.forecast(makeTasks(3), {0, 0, 0}, 100, 1).valid);
+    CHECK(!forecaster.forecast(makeTasks(3), {}, 100, 1).valid);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testSeedReproducibleAcrossThreadCounts);
+    RUN_TEST(testConstantThroughputIsExact);
+    RUN_TEST(testDependencyChainTakesOneDayPerLink);
+    RUN_TEST(testCycleBlocksEveryTrial);
+    RUN_TEST(testNoHistoryIsInvalid);
+    return testResult();
+}
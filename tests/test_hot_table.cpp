@@ -0,0 +1,117 @@
+#include "TestSupport.h"
+#include "models/Board.h"
+#include <algorithm>
+#include <random>
+
+using namespace std;
+
+namespace {
+
+const char* STATES[] = {"Pendiente", "En Progreso", "Terminado"};
+
+// Cada fila de la tabla coincide con los campos de su tarea
+bool rowsMatchTasks(const Board& board) {
+    const TaskHotTable& table = board.getHotTable();
+    if (table.size() != static_cast<size_t>(board.getTotalTaskCount())) return false;
+
+    for (TaskHotTable::Row row = 0; row < table.size(); ++row) {
+        const Task* task = table.getTask(row);
+        if (!task || board.findTaskById(table.getTaskIds()[row]).get() != task) return false;
+        if (table.getStateIds()[row] != TaskHotTable::stateIdOf(task->getState())) return false;
+        if (table.getPriorities()[row] != task->getPriority()) return false;
+        if (table.getAssigneeIds()[row] != task->getAssignedUserId()) return false;
+        if (table.getDueTicks()[row] != TaskHotTable::toTicks(task->getDueDate())) return false;
+    }
+    return true;
+}
+
+vector<int> idsOf(const vector<shared_ptr<Task>>& tasks) {
+    vector<int> ids;
+    for (const auto& task : tasks) {
+        ids.push_back(task->getId());
+    }
+    return ids;
+}
+
+// Los filtros sobre la tabla dan lo mismo que recorrer las tareas
+bool queriesMatchScan(const Board& board) {
+    auto now = chrono::system_clock::now();
+    vector<int> overdue, assigned;
+    for (const auto& task : board.getAllTasks()) {
+        if (task->getDueDate() < now && task->getState() != "Terminado") {
+            overdue.push_back(task->getId());
+        }
+        if (task->getAssignedUserId() == 2) {
+            assigned.push_back(task->getId());
+        }
+    }
+    sort(overdue.begin(), overdue.end());
+    sort(assigned.begin(), assigned.end());
+
+    if (idsOf(board.getOverdueTasks()) != overdue) return false;
+    if (idsOf(board.getTasksByUser(2)) != assigned) return false;
+
+    const TaskHotTable& table = board.getHotTable();
+    for (const char* state : STATES) {
+        if (table.countByState(TaskHotTable::stateIdOf(state)) !=
+            static_cast<size_t>(board.getTaskCountByState(state))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testTableFollowsTaskChanges() {
+    Board board(1, "Columnas");
+    mt19937 rng(9);
+    auto now = chrono::system_clock::now();
+
+    for (int i = 0; i < 2000; ++i) {
+        board.createTask("Tarea", "");
+    }
+    CHECK(rowsMatchTasks(board));
+
+    for (int round = 0; round < 20; ++round) {
+        for (int op = 0; op < 200; ++op) {
+            auto tasks = board.getAllTasks();
+            auto task = tasks[rng() % tasks.size()];
+            switch (rng() % 6) {
+                case 0: board.moveTask(task->getId(), STATES[rng() % 3], "prueba"); break;
+                case 1: task->setPriority(static_cast<int>(rng() % 5)); break;
+                case 2: task->setAssignedUserId(static_cast<int>(rng() % 4) - 1, "prueba"); break;
+                case 3: task->setDueDate(now + chrono::hours(static_cast<int>(rng() % 200) - 100)); break;
+                case 4: board.removeTask(task->getId()); break;
+                case 5: board.createTask("Nueva", ""); break;
+            }
+        }
+        CHECK(rowsMatchTasks(board));
+        CHECK(queriesMatchScan(board));
+    }
+}
+
+void testRemovedTaskLeavesTable() {
+    Board board(1, "Columnas");
+    auto first = board.createTask("Primera", "");
+    auto second = board.createTask("Segunda", "");
+
+    board.removeTask(first->getId());
+    CHECK(board.getHotTable().size() == 1);
+    CHECK(board.getHotTable().getTask(0) == second.get());
+
+    // Una tarea quitada ya no escribe en la tabla
+    first->setPriority(4);
+    CHECK(rowsMatchTasks(board));
+
+    board.clearAllTasks();
+    CHECK(board.getHotTable().size() == 0);
+    second->setPriority(3);
+    CHECK(board.getHotTable().size() == 0);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testTableFollowsTaskChanges);
+    RUN_TEST(testRemovedTaskLeavesTable);
+    return testResult();
+}
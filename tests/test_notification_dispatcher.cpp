@@ -0,0 +1,166 @@
+#include "TestSupport.h"
+#include "managers/NotificationDispatcher.h"
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+using Type = Notification::Type;
+
+// Ventana larga: nada se entrega solo mientras corre la prueba
+const chrono::milliseconds LONG_WINDOW(60000);
+
+// Junta los lotes que llegan desde el hilo de entrega
+struct Collector {
+    mutex lock;
+    vector<vector<Notification>> batches;
+
+    NotificationDispatcher::BatchCallback callback() {
+        return [this](const vector<Notification>& batch) {
+            lock_guard<mutex> guard(lock);
+            batches.push_back(batch);
+        };
+    }
+
+    size_t batchCount() {
+        lock_guard<mutex> guard(lock);
+        return batches.size();
+    }
+};
+
+Notification overdue(int taskId, int userId, const string& message = "Vencida") {
+    return Notification(Type::TASK_OVERDUE, "Tarea vencida", message, taskId, userId);
+}
+
+// La misma clave dentro de la ventana reemplaza a la pendiente
+void testSameKeyCoalesces() {
+    Collector collector;
+    NotificationDispatcher dispatcher(collector.callback(), LONG_WINDOW);
+
+    CHECK(dispatcher.submit(overdue(1, 1, "primera")));
+    CHECK(dispatcher.submit(overdue(1, 1, "segunda")));
+    CHECK(dispatcher.submit(overdue(1, 1, "tercera")));
+    CHECK(dispatcher.submit(overdue(1, 2)));
+    CHECK(dispatcher.submit(overdue(2, 1)));
+    CHECK(dispatcher.submit(Notification(Type::TASK_DUE_SOON, "Por vencer", "", 1, 1)));
+    CHECK(dispatcher.getPendingCount() == 4);
+
+    dispatcher.flush();
+    CHECK(collector.batchCount() == 1);
+    const auto& batch = collector.batches[0];
+    CHECK(batch.size() == 4);
+    CHECK(batch[0].taskId == 1 && batch[0].userId == 1);
+    CHECK(batch[0].message == "tercera");
+
+    auto stats = dispatcher.getStats();
+    CHECK(stats.submitted == 6);
+    CHECK(stats.coalesced == 2);
+    CHECK(stats.delivered == 4);
+
+    // Entregada la primera, la misma clave vuelve a encolarse
+    dispatcher.submit(overdue(1, 1, "cuarta"));
+    CHECK(dispatcher.getPendingCount() == 1);
+}
+
+void testBatchDeliveryAndFlush() {
+    Collector collector;
+    NotificationDispatcher dispatcher(collector.callback(), LONG_WINDOW);
+
+    for (int task = 0; task < 5; ++task) {
+        dispatcher.submit(overdue(task, 1));
+    }
+    CHECK(collector.batchCount() == 0);
+
+    dispatcher.flush();
+    CHECK(dispatcher.getPendingCount() == 0);
+    CHECK(collector.batchCount() == 1);
+    for (int task = 0; task < 5; ++task) {
+        CHECK(collector.batches[0][task].taskId == task);
+    }
+    auto stats = dispatcher.getStats();
+    CHECK(stats.batches == 1 && stats.delivered == 5);
+
+    // Flush sin nada pendiente no bloquea ni entrega un lote vacío
+    dispatcher.flush();
+    CHECK(collector.batchCount() == 1);
+
+    // Con una ventana corta el lote sale solo
+    Collector timed;
+    NotificationDispatcher quick(timed.callback(), chrono::milliseconds(10));
+    quick.submit(overdue(1, 1));
+    quick.submit(overdue(2, 1));
+    for (int i = 0; i < 500 && timed.batchCount() == 0; ++i) {
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    CHECK(timed.batchCount() == 1);
+    CHECK(quick.getStats().delivered == 2);
+}
+
+void testDropsWhenFull() {
+    Collector collector;
+    NotificationDispatcher dispatcher(collector.callback(), LONG_WINDOW, 3);
+
+    CHECK(dispatcher.submit(overdue(1, 1)));
+    CHECK(dispatcher.submit(overdue(2, 1)));
+    CHECK(dispatcher.submit(overdue(3, 1)));
+    CHECK(!dispatcher.submit(overdue(4, 1)));
+    CHECK(!dispatcher.submit(overdue(5, 1)));
+
+    // Reemplazar una pendiente no ocupa lugar
+    CHECK(dispatcher.submit(overdue(2, 1, "nueva")));
+
+    auto stats = dispatcher.getStats();
+    CHECK(stats.dropped == 2);
+    CHECK(stats.coalesced == 1);
+    CHECK(dispatcher.getPendingCount() == 3);
+
+    dispatcher.flush();
+    CHECK(collector.batches[0].size() == 3);
+    CHECK(dispatcher.submit(overdue(4, 1)));
+}
+
+// Quitar el callback de lotes entrega lo encolado y vuelve al síncrono
+void testManagerShutdownDeliversPending() {
+    Collector collector;
+    NotificationManager manager;
+    size_t synchronous = 0;
+    manager.setNotificationCallback([&synchronous](const Notification&) { ++synchronous; });
+    manager.setBatchCallback(collector.callback(), LONG_WINDOW);
+
+    manager.addNotification(overdue(1, 1));
+    manager.addNotification(overdue(2, 1));
+    manager.addNotification(overdue(3, 2));
+    CHECK(manager.getDispatcher()->getPendingCount() == 3);
+    CHECK(synchronous == 0);
+
+    manager.setBatchCallback(nullptr);
+    CHECK(!manager.getDispatcher());
+    CHECK(collector.batchCount() == 1);
+    CHECK(collector.batches[0].size() == 3);
+
+    manager.addNotification(overdue(4, 1));
+    manager.flushNotifications();
+    CHECK(synchronous == 1);
+    CHECK(collector.batchCount() == 1);
+
+    // Detener a mano también entrega, y después no se aceptan más
+    Collector stopped;
+    NotificationDispatcher dispatcher(stopped.callback(), LONG_WINDOW);
+    dispatcher.submit(overdue(1, 1));
+    dispatcher.stop();
+    CHECK(stopped.batchCount() == 1);
+    CHECK(!dispatcher.submit(overdue(2, 1)));
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testSameKeyCoalesces);
+    RUN_TEST(testBatchDeliveryAndFlush);
+    RUN_TEST(testDropsWhenFull);
+    RUN_TEST(testManagerShutdownDeliversPending);
+    return testResult();
+}
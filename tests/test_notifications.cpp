@@ -0,0 +1,232 @@
+#include "TestSupport.h"
+#include "managers/NotificationManager.h"
+#include "utils/DataPersistence.h"
+#include <filesystem>
+
+using namespace std;
+
+namespace {
+
+using Type = Notification::Type;
+
+Notification overdue(int taskId, int userId, const string& message = "Vencida") {
+    return Notification(Type::TASK_OVERDUE, "Tarea vencida", message, taskId, userId);
+}
+
+void testPendingDuplicateOnlyUpdatesText() {
+    NotificationManager manager;
+    uint64_t first = manager.addNotification(overdue(7, 1, "ayer"));
+    uint64_t again = manager.addNotification(overdue(7, 1, "hoy"));
+
+    CHECK(again == first);
+    CHECK(manager.getNotificationCount() == 1);
+    CHECK(manager.getDeduplicatedCount() == 1);
+    CHECK(manager.getAllNotifications()[0].message == "hoy");
+
+    // Otra tarea, otro usuario u otro tipo no son duplicados
+    manager.addNotification(overdue(8, 1));
+    manager.addNotification(overdue(7, 2));
+    manager.addNotification(Notification(Type::TASK_DUE_SOON, "Por vencer", "", 7, 1));
+    CHECK(manager.getNotificationCount() == 4);
+
+    // Una vez leída, el aviso siguiente vuelve a entrar
+    manager.markAsRead(first);
+    CHECK(manager.addNotification(overdue(7, 1)) != first);
+    CHECK(manager.getNotificationCount() == 5);
+}
+
+void testQuotaEvictsOldestOfUser() {
+    NotificationManager manager;
+    manager.setRetention(3, chrono::hours(24));
+
+    vector<uint64_t> ids;
+    for (int task = 0; task < 5; ++task) {
+        ids.push_back(manager.addNotification(overdue(task, 1)));
+    }
+    manager.addNotification(overdue(0, 2));
+
+    auto inbox = manager.getNotificationsByUser(1);
+    CHECK(inbox.size() == 3);
+    CHECK(inbox.front().id == ids[2]);
+    CHECK(manager.getNotificationCount(2) == 1);
+    CHECK(manager.getEvictedCount() == 2);
+    CHECK(manager.getUnreadCount(1) == 3);
+}
+
+void testTtlExpiresWithinBudget() {
+    NotificationManager manager;
+    manager.setRetention(1000, chrono::hours(1));
+    auto now = chrono::system_clock::now();
+
+    // Restauradas con la fecha original, sin pasar por la cola de vencimientos
+    for (int task = 0; task < 10; ++task) {
+        Notification old = overdue(task, 1);
+        old.id = static_cast<uint64_t>(task + 1);
+        old.timestamp = now - chrono::hours(2);
+        manager.restoreNotification(old);
+    }
+    CHECK(manager.getNotificationCount() == 10);
+
+    // Cada alta vence unas pocas (8); el resto queda para las siguientes
+    manager.addNotification(overdue(100, 1));
+    CHECK(manager.getNotificationCount() == 3);
+
+    CHECK(manager.expireNotifications(now, 1) == 1);
+    CHECK(manager.expireNotifications(now) == 1);
+    CHECK(manager.getNotificationCount() == 1);
+    CHECK(manager.getAllNotifications()[0].taskId == 100);
+    CHECK(manager.getEvictedCount() == 10);
+}
+
+// Página 0 es la más reciente; los límites se recortan sin fallar
+void testPagesNewestFirst() {
+    NotificationManager manager;
+    vector<uint64_t> ids;
+    for (int task = 0; task < 10; ++task) {
+        ids.push_back(manager.addNotification(overdue(task, 1)));
+        manager.addNotification(overdue(task, 2));
+    }
+
+    auto first = manager.getNotificationsPage(1, 0, 3);
+    CHECK(first.size() == 3);
+    CHECK(first[0].id == ids[9] && first[1].id == ids[8] && first[2].id == ids[7]);
+
+    auto tail = manager.getNotificationsPage(1, 8, 5);
+    CHECK(tail.size() == 2);
+    CHECK(tail[0].id == ids[1] && tail[1].id == ids[0]);
+
+    auto all = manager.getNotificationsPage(1, 0, SIZE_MAX);
+    CHECK(all.size() == 10);
+    for (size_t i = 0; i < all.size(); ++i) {
+        CHECK(all[i].id == ids[9 - i] && all[i].userId == 1);
+    }
+
+    CHECK(manager.getNotificationsPage(1, 10, 5).empty());
+    CHECK(manager.getNotificationsPage(1, 0, 0).empty());
+    CHECK(manager.getNotificationsPage(3, 0, 5).empty());
+}
+
+// Después de limpiar o desalojar, cada id sigue apuntando a su notificación
+void testMarkAsReadAfterRemovals() {
+    NotificationManager manager;
+    auto now = chrono::system_clock::now();
+
+    for (int task = 0; task < 3; ++task) {
+        Notification old = overdue(task, 1);
+        old.id = static_cast<uint64_t>(task + 1);
+        old.timestamp = now - chrono::hours(24 * 10);
+        old.read = true;
+        manager.restoreNotification(old);
+    }
+    uint64_t a = manager.addNotification(overdue(10, 1));
+    uint64_t b = manager.addNotification(overdue(11, 1));
+
+    manager.clearOldNotifications(7);
+    CHECK(manager.getNotificationCount(1) == 2);
+    CHECK(!manager.markAsRead(2));
+    CHECK(manager.markAsRead(b));
+    auto inbox = manager.getNotificationsByUser(1);
+    CHECK(inbox[0].id == a && !inbox[0].read);
+    CHECK(inbox[1].id == b && inbox[1].read);
+
+    // Cuota de 2: entran c y d, salen a y b
+    manager.setRetention(2, chrono::hours(24));
+    uint64_t c = manager.addNotification(overdue(12, 1));
+    uint64_t d = manager.addNotification(overdue(13, 1));
+    CHECK(!manager.markAsRead(a));
+    CHECK(!manager.markAsRead(b));
+    CHECK(manager.markAsRead(c));
+    inbox = manager.getNotificationsByUser(1);
+    CHECK(inbox.size() == 2);
+    CHECK(inbox[0].id == c && inbox[0].read);
+    CHECK(inbox[1].id == d && !inbox[1].read);
+}
+
+// El contador O(1) coincide con la bandeja tras cada operación
+void testUnreadCountStaysExact() {
+    NotificationManager manager;
+    manager.setRetention(4, chrono::hours(1));
+    auto matches = [&manager](int userId) {
+        return manager.getUnreadCount(userId) ==
+               static_cast<int>(manager.getUnreadNotifications(userId).size());
+    };
+
+    uint64_t first = manager.addNotification(overdue(1, 1));
+    manager.addNotification(overdue(2, 1));
+    manager.addNotification(overdue(3, 1));
+    CHECK(manager.getUnreadCount(1) == 3 && matches(1));
+
+    // Duplicada no leída: no suma
+    manager.addNotification(overdue(2, 1, "otra vez"));
+    CHECK(manager.getUnreadCount(1) == 3 && matches(1));
+
+    // Leída dos veces: resta una sola
+    manager.markAsRead(first);
+    manager.markAsRead(first);
+    CHECK(manager.getUnreadCount(1) == 2 && matches(1));
+
+    // Desalojo por cuota de una leída y de una no leída
+    manager.addNotification(overdue(4, 1));
+    manager.addNotification(overdue(5, 1));
+    CHECK(manager.getUnreadCount(1) == 4 && matches(1));
+    manager.addNotification(overdue(6, 1));
+    CHECK(manager.getNotificationCount(1) == 4);
+    CHECK(manager.getUnreadCount(1) == 4 && matches(1));
+
+    // Vencimiento por ttl
+    CHECK(manager.expireNotifications(chrono::system_clock::now() + chrono::hours(2)) == 4);
+    CHECK(manager.getUnreadCount(1) == 0 && matches(1));
+
+    manager.addNotification(overdue(7, 1));
+    manager.markAllAsRead(1);
+    CHECK(manager.getUnreadCount(1) == 0 && matches(1));
+}
+
+void testNotificationsSurviveRestart() {
+    auto directory = filesystem::temp_directory_path() / "test_notifications";
+    filesystem::remove_all(directory);
+    DataPersistence persistence(directory.string());
+
+    auto saved = make_shared<NotificationManager>();
+    uint64_t read = saved->addNotification(overdue(1, 1, "Tarea \"A|B\""));
+    uint64_t unread = saved->addNotification(overdue(2, 1));
+    saved->addNotification(Notification(Type::TASK_ASSIGNED, "Asignada", "", 3, 2));
+    Notification expired = overdue(4, 2);
+    expired.id = 99;
+    expired.timestamp = chrono::system_clock::now() - chrono::hours(24 * 60);
+    saved->restoreNotification(expired);
+    saved->markAsRead(read);
+    CHECK(persistence.saveNotifications(saved));
+
+    auto loaded = make_shared<NotificationManager>();
+    CHECK(persistence.loadNotifications(loaded));
+
+    // La vencida mientras la aplicación estaba cerrada no vuelve
+    auto all = loaded->getAllNotifications();
+    CHECK(all.size() == 3);
+    CHECK(all[0].id == read && all[0].read);
+    CHECK(all[0].message == "Tarea \"A|B\"");
+    CHECK(all[1].id == unread && !all[1].read);
+    CHECK(loaded->getUnreadCount(1) == 1);
+    CHECK(loaded->getNotificationCount(2) == 1);
+
+    // Los ids siguen después de los restaurados y la clave de duplicado se conserva
+    CHECK(loaded->addNotification(overdue(2, 1)) == unread);
+    CHECK(loaded->addNotification(overdue(5, 1)) > 99);
+
+    filesystem::remove_all(directory);
+    CHECK(!persistence.loadNotifications(loaded));
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testPendingDuplicateOnlyUpdatesText);
+    RUN_TEST(testQuotaEvictsOldestOfUser);
+    RUN_TEST(testTtlExpiresWithinBudget);
+    RUN_TEST(testPagesNewestFirst);
+    RUN_TEST(testMarkAsReadAfterRemovals);
+    RUN_TEST(testUnreadCountStaysExact);
+    RUN_TEST(testNotificationsSurviveRestart);
+    return testResult();
+}
@@ -0,0 +1,137 @@
+#include "TestSupport.h"
+#include "utils/PerfMonitor.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
+using namespace std;
+
+namespace {
+
+using chrono::milliseconds;
+using chrono::microseconds;
+
+PerfMonitor& freshMonitor(bool enable) {
+    PerfMonitor& monitor = PerfMonitor::instance();
+    monitor.reset();
+    monitor.setEnabled(enable);
+    monitor.setStallThreshold(milliseconds(100));
+    return monitor;
+}
+
+// Desactivado, PERF_SCOPE no deja rastro
+void testDisabledScopeRecordsNothing() {
+    PerfMonitor& monitor = freshMonitor(false);
+    {
+        PERF_SCOPE("apagado");
+    }
+    CHECK(monitor.getSnapshot().operations.empty());
+
+    monitor.setEnabled(true);
+    for (int i = 0; i < 3; ++i) {
+        PERF_SCOPE("encendido");
+    }
+    auto operations = monitor.getSnapshot().operations;
+    CHECK(operations.size() == 1);
+    CHECK(operations[0].name == "encendido");
+    CHECK(operations[0].count == 3);
+
+    // Lo que decide es el estado al empezar la medición
+    {
+        PERF_SCOPE("empezado");
+        monitor.setEnabled(false);
+    }
+    CHECK(monitor.getSnapshot().operations.size() == 2);
+}
+
+void testSlowestOperationsFirst() {
+    PerfMonitor& monitor = freshMonitor(true);
+    monitor.record("a", milliseconds(1));
+    monitor.record("b", milliseconds(5));
+    monitor.record("c", milliseconds(3));
+    monitor.record("a", milliseconds(10));
+
+    auto operations = monitor.getSnapshot().operations;
+    CHECK(operations.size() == 3);
+    CHECK(operations[0].name == "a" && operations[1].name == "b" && operations[2].name == "c");
+    CHECK(operations[0].count == 2);
+    CHECK(fabs(operations[0].totalMs - 11.0) < 1e-6);
+    CHECK(fabs(operations[0].maxMs - 10.0) < 0.5);
+
+    // Pedir menos devuelve las más lentas
+    auto top = monitor.getSnapshot(2).operations;
+    CHECK(top.size() == 2);
+    CHECK(top[0].name == "a" && top[1].name == "b");
+}
+
+// Cada límite es inclusivo: un frame de 8 ms cae en el primer intervalo
+void testFrameHistogramBuckets() {
+    PerfMonitor& monitor = freshMonitor(true);
+    const microseconds frames[] = {
+        microseconds(8000),    // 0: <= 8
+        microseconds(8500),    // 1: <= 16.7
+        microseconds(16000),   // 1
+        microseconds(17000),   // 2: <= 33.3
+        microseconds(50000),   // 3: <= 50
+        microseconds(100000),  // 4: <= 100, bloqueo
+        microseconds(300000),  // 6: <= 500, bloqueo
+        microseconds(1000000)  // 7: infinito, bloqueo
+    };
+    for (auto frame : frames) {
+        monitor.recordFrame(frame);
+    }
+
+    auto snapshot = monitor.getSnapshot();
+    const uint64_t expected[PerfMonitor::FRAME_BUCKET_COUNT] = {1, 2, 1, 1, 1, 0, 1, 1};
+    for (size_t i = 0; i < PerfMonitor::FRAME_BUCKET_COUNT; ++i) {
+        CHECK(snapshot.frameHistogram[i] == expected[i]);
+    }
+    CHECK(snapshot.frameCount == 8);
+    CHECK(snapshot.stalls.size() == 3);
+    CHECK(fabs(snapshot.stalls.back().durationMs - 1000.0) < 1e-6);
+    CHECK(isinf(PerfMonitor::getFrameBucketLimit(PerfMonitor::FRAME_BUCKET_COUNT - 1)));
+    CHECK(PerfMonitor::getFrameBucketLimit(0) == 8.0);
+
+    monitor.reset();
+    CHECK(monitor.getSnapshot().frameCount == 0);
+}
+
+void testDumpWritesAllSections() {
+    PerfMonitor& monitor = freshMonitor(true);
+    monitor.record("volcada", milliseconds(4));
+    monitor.recordFrame(milliseconds(20));
+    monitor.recordFrame(milliseconds(150));
+
+    auto path = filesystem::temp_directory_path() / "test_perf_monitor.txt";
+    CHECK(monitor.dump(path.string()));
+
+    ifstream file(path);
+    stringstream contents;
+    contents << file.rdbuf();
+    string text = contents.str();
+    CHECK(text.find("[frames]\ncount=2 ") != string::npos);
+    CHECK(text.find("\n33.3,1\n") != string::npos);
+    CHECK(text.find("\n250,1\n") != string::npos);
+    CHECK(text.find("[operations]\nname,count,total_ms,p50_ms,p95_ms,max_ms\nvolcada,1,4,")
+          != string::npos);
+    CHECK(text.find("[stalls]\nwhen,duration_ms\n") != string::npos);
+    CHECK(text.find(",150\n") != string::npos);
+    CHECK(text.find(",volcada,4\n") != string::npos);
+
+    filesystem::remove(path);
+    CHECK(!monitor.dump((path / "sin_directorio" / "x.txt").string()));
+
+    monitor.setEnabled(false);
+    monitor.reset();
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testDisabledScopeRecordsNothing);
+    RUN_TEST(testSlowestOperationsFirst);
+    RUN_TEST(testFrameHistogramBuckets);
+    RUN_TEST(testDumpWritesAllSections);
+    return testResult();
+}
@@ -0,0 +1,99 @@
+#include "TestSupport.h"
+#include "utils/PoolAllocator.h"
+#include "models/Board.h"
+#include <cstdint>
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+void testFreedBlocksAreReused() {
+    SlabPoolResource pool(4096);
+
+    void* first = pool.allocate(48, 8);
+    void* second = pool.allocate(48, 8);
+    CHECK(first != second);
+
+    // Misma clase de tamaño: el bloque liberado vuelve en la próxima reserva
+    pool.deallocate(first, 48, 8);
+    CHECK(pool.allocate(40, 8) == first);
+
+    pool.deallocate(second, 48, 8);
+}
+
+void testSlabsGrowAndAlignment() {
+    SlabPoolResource pool(4096);
+    CHECK(pool.getSlabCount() == 0);
+
+    vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i) {
+        void* block = pool.allocate(24, 8);
+        CHECK(reinterpret_cast<uintptr_t>(block) % 16 == 0);
+        blocks.push_back(block);
+    }
+    // 1000 bloques de 32 bytes no entran en un bloque de 4 KB
+    CHECK(pool.getSlabCount() >= 8);
+
+    // Los grandes o sobrealineados no pasan por las listas del pool
+    size_t slabs = pool.getSlabCount();
+    void* large = pool.allocate(4000, 8);
+    void* aligned = pool.allocate(64, 64);
+    CHECK(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+    CHECK(pool.getSlabCount() == slabs);
+    pool.deallocate(large, 4000, 8);
+    pool.deallocate(aligned, 64, 64);
+
+    for (void* block : blocks) {
+        pool.deallocate(block, 24, 8);
+    }
+}
+
+void testPoolAllocatorWithContainers() {
+    auto pool = make_shared<SlabPoolResource>();
+    PoolAllocator<int> allocator(pool);
+
+    vector<int, PoolAllocator<int>> values(allocator);
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+    CHECK(values.size() == 100 && values[99] == 99);
+    CHECK(PoolAllocator<double>(allocator) == allocator);
+    CHECK(PoolAllocator<int>(make_shared<SlabPoolResource>()) != allocator);
+}
+
+void testTasksOutliveClearedBoard() {
+    auto board = make_shared<Board>(1, "Pool");
+    auto kept = board->createTask("Conservada", "descripción");
+    kept->addSubtask(kept->allocateSubtask("Subtarea"));
+    for (int i = 0; i < 500; ++i) {
+        auto task = board->createTask("Tarea", "");
+        task->addSubtask(task->allocateSubtask("Subtarea"));
+    }
+
+    // El vaciado cambia de pool; la tarea retenida mantiene vivo el anterior
+    board->clearAllTasks();
+    CHECK(board->getTotalTaskCount() == 0);
+    CHECK(kept->getTitle() == "Conservada");
+    CHECK(kept->getSubtasks().size() == 1);
+    kept->addSubtask(kept->allocateSubtask("Otra"));
+    CHECK(kept->getSubtaskIndex().size() == 2);
+
+    // Y el tablero sigue funcionando con el pool nuevo
+    auto fresh = board->createTask("Nueva", "");
+    CHECK(fresh->getId() == 1);
+    CHECK(board->getTotalTaskCount() == 1);
+
+    board.reset();
+    CHECK(kept->getDescription() == "descripción");
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testFreedBlocksAreReused);
+    RUN_TEST(testSlabsGrowAndAlignment);
+    RUN_TEST(testPoolAllocatorWithContainers);
+    RUN_TEST(testTasksOutliveClearedBoard);
+    return testResult();
+}
@@ -0,0 +1,153 @@
+#include "TestSupport.h"
+#include "utils/SelectionKernels.h"
+#include <limits>
+#include <random>
+
+using namespace std;
+
+namespace {
+
+const SelectionKernels::Isa ISAS[] = {
+    SelectionKernels::Isa::SCALAR, SelectionKernels::Isa::SSE42, SelectionKernels::Isa::AVX2
+};
+
+struct Table {
+    vector<uint32_t> stateIds;
+    vector<int32_t> priorities;
+    vector<int32_t> assigneeIds;
+    vector<int64_t> dueTicks;
+
+    SelectionKernels::Columns columns() const {
+        SelectionKernels::Columns columns;
+        columns.stateIds = stateIds.data();
+        columns.priorities = priorities.data();
+        columns.assigneeIds = assigneeIds.data();
+        columns.dueTicks = dueTicks.data();
+        columns.count = stateIds.size();
+        return columns;
+    }
+};
+
+// Valores chicos para que cada cláusula acierte y falle; incluye los extremos
+Table randomTable(size_t rows, mt19937& rng) {
+    const int64_t edges[] = {
+        numeric_limits<int64_t>::min(), numeric_limits<int64_t>::min() + 1,
+        numeric_limits<int64_t>::max() - 1, numeric_limits<int64_t>::max()
+    };
+    Table table;
+    for (size_t i = 0; i < rows; ++i) {
+        table.stateIds.push_back(rng() % 4);
+        table.priorities.push_back(static_cast<int32_t>(rng() % 5));
+        table.assigneeIds.push_back(static_cast<int32_t>(rng() % 5) - 1);
+        table.dueTicks.push_back(rng() % 8 == 0 ? edges[rng() % 4]
+                                                : static_cast<int64_t>(rng() % 100) - 50);
+    }
+    return table;
+}
+
+vector<SelectionKernels::Predicate> predicates() {
+    vector<SelectionKernels::Predicate> result(1);  // Sin filtros
+
+    SelectionKernels::Predicate due;
+    due.dueFrom = -10;
+    due.dueTo = 10;
+    result.push_back(due);
+
+    SelectionKernels::Predicate all;
+    all.dueFrom = -20;
+    all.dueTo = numeric_limits<int64_t>::max();
+    all.minPriority = 2;
+    all.excludeState = true;
+    all.excludedStateId = 1;
+    all.assignees = {-1, 2, 3};
+    result.push_back(all);
+
+    SelectionKernels::Predicate single;
+    single.dueTo = numeric_limits<int64_t>::min();
+    single.assignees = {0};
+    result.push_back(single);
+    return result;
+}
+
+// Referencia fila por fila, independiente de los kernels
+vector<uint64_t> reference(const Table& table, const SelectionKernels::Predicate& predicate) {
+    size_t rows = table.stateIds.size();
+    vector<uint64_t> bitmap((rows + 63) / 64, 0);
+    for (size_t i = 0; i < rows; ++i) {
+        bool match = table.dueTicks[i] >= predicate.dueFrom && table.dueTicks[i] <= predicate.dueTo &&
+                     table.priorities[i] >= predicate.minPriority &&
+                     !(predicate.excludeState && table.stateIds[i] == predicate.excludedStateId);
+        if (match && !predicate.assignees.empty()) {
+            match = false;
+            for (int32_t assignee : predicate.assignees) {
+                match = match || table.assigneeIds[i] == assignee;
+            }
+        }
+        if (match) bitmap[i / 64] |= uint64_t(1) << (i % 64);
+    }
+    return bitmap;
+}
+
+// Todas las colas de 0 a 31 filas tras 0, 1 y 2 palabras completas
+void testIsasMatchReferenceOnTails() {
+    mt19937 rng(40);
+    for (size_t words = 0; words <= 2; ++words) {
+        for (size_t tail = 0; tail < 32; ++tail) {
+            Table table = randomTable(words * 64 + tail, rng);
+            for (const auto& predicate : predicates()) {
+                vector<uint64_t> expected = reference(table, predicate);
+                for (auto isa : ISAS) {
+                    vector<uint64_t> bitmap;
+                    SelectionKernels::select(table.columns(), predicate, bitmap, isa);
+                    CHECK(bitmap == expected);
+                }
+            }
+        }
+    }
+}
+
+void testDefaultPredicateMatchesEveryRow() {
+    Table table;
+    const int64_t dues[] = {numeric_limits<int64_t>::min(), 0, numeric_limits<int64_t>::max()};
+    for (size_t i = 0; i < 70; ++i) {
+        table.stateIds.push_back(0);
+        table.priorities.push_back(numeric_limits<int32_t>::min());
+        table.assigneeIds.push_back(-1);
+        table.dueTicks.push_back(dues[i % 3]);
+    }
+
+    for (auto isa : ISAS) {
+        vector<uint64_t> bitmap;
+        SelectionKernels::select(table.columns(), SelectionKernels::Predicate(), bitmap, isa);
+        CHECK(SelectionKernels::countBits(bitmap) == 70);
+    }
+}
+
+void testBoundsAreInclusive() {
+    Table table;
+    for (int64_t due = -3; due <= 3; ++due) {
+        table.stateIds.push_back(0);
+        table.priorities.push_back(0);
+        table.assigneeIds.push_back(0);
+        table.dueTicks.push_back(due);
+    }
+
+    SelectionKernels::Predicate predicate;
+    predicate.dueFrom = -1;
+    predicate.dueTo = 1;
+    for (auto isa : ISAS) {
+        vector<uint64_t> bitmap;
+        SelectionKernels::select(table.columns(), predicate, bitmap, isa);
+        CHECK(SelectionKernels::toRows(bitmap) == vector<uint32_t>({2, 3, 4}));
+    }
+}
+
+} // namespace
+
+int main() {
+    cout << "ISA detectada: " << SelectionKernels::isaName(SelectionKernels::detectIsa()) << endl;
+    RUN_TEST(testIsasMatchReferenceOnTails);
+    RUN_TEST(testDefaultPredicateMatchesEveryRow);
+    RUN_TEST(testBoundsAreInclusive);
+    return testResult();
+}
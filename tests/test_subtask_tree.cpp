@@ -0,0 +1,142 @@
+#include "TestSupport.h"
+#include "models/Task.h"
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+const int DEEP = 100000;
+const int WIDE = 1000000;
+
+// Cadena de DEEP niveles armada desde la hoja: cada alta solo actualiza
+// los contadores del padre nuevo, que todavía no tiene ancestros
+shared_ptr<Subtask> makeChain(int depth) {
+    shared_ptr<Subtask> node = make_shared<Subtask>(depth, "");
+    for (int id = depth - 1; id >= 1; --id) {
+        auto parent = make_shared<Subtask>(id, "");
+        parent->addChildSubtask(node);
+        node = parent;
+    }
+    return node;
+}
+
+shared_ptr<Subtask> makeFan(int children) {
+    auto root = make_shared<Subtask>(1, "");
+    for (int id = 2; id <= children + 1; ++id) {
+        root->addChildSubtask(make_shared<Subtask>(id, ""));
+    }
+    return root;
+}
+
+// Recorre el rango y verifica que cada id aparece exactamente una vez
+template <typename Range>
+bool visitsEachOnce(Range range, int count) {
+    vector<char> seen(static_cast<size_t>(count) + 1, 0);
+    int visited = 0;
+    for (auto& node : range) {
+        int id = node.getId();
+        if (id < 1 || id > count || seen[id]) return false;
+        seen[id] = 1;
+        ++visited;
+    }
+    return visited == count;
+}
+
+void testDeepChainTraversal() {
+    auto root = makeChain(DEEP);
+
+    CHECK(root->countTotalSubtasks() == DEEP);
+    CHECK(visitsEachOnce(root->preOrder(), DEEP));
+    CHECK(visitsEachOnce(root->postOrder(), DEEP));
+
+    // Preorden: de la raíz a la hoja; postorden: de la hoja a la raíz
+    CHECK(root->preOrder().begin()->getId() == 1);
+    CHECK(root->postOrder().begin()->getId() == DEEP);
+
+    auto leaf = root->findSubtaskById(DEEP);
+    CHECK(leaf && leaf->getChildSubtasks().empty());
+    CHECK(root->isAncestorOf(leaf.get()));
+    CHECK(!leaf->isAncestorOf(root.get()));
+}
+
+void testDeepChainBulkComplete() {
+    auto root = makeChain(DEEP);
+
+    CHECK(root->setSubtreeCompleted(true) == DEEP);
+    CHECK(root->countCompletedSubtasks() == DEEP);
+    CHECK(root->getCompletionPercentage() == 100.0);
+
+    // Segunda vez: nada cambia
+    CHECK(root->setSubtreeCompleted(true) == 0);
+
+    // Medio subárbol: los contadores de los ancestros se ajustan una vez
+    auto middle = root->findSubtaskById(DEEP / 2 + 1);
+    CHECK(middle->setSubtreeCompleted(false) == DEEP / 2);
+    CHECK(root->countCompletedSubtasks() == DEEP / 2);
+    CHECK(middle->countCompletedSubtasks() == 0);
+}
+
+void testDeepChainInTask() {
+    Task source(1, "Origen");
+    Task target(2, "Destino");
+    source.addSubtask(makeChain(DEEP));
+
+    const SubtaskIndex& index = source.getSubtaskIndex();
+    CHECK(index.size() == static_cast<size_t>(DEEP));
+    CHECK(index.getTotalCount() == DEEP);
+
+    CHECK(source.setSubtreeCompleted(1, true));
+    CHECK(index.getCompletedCount() == DEEP);
+
+    // Mover la mitad inferior a otra tarea como raíz
+    int middleId = DEEP / 2 + 1;
+    CHECK(source.moveSubtaskTo(middleId, target));
+    CHECK(index.size() == static_cast<size_t>(DEEP / 2));
+    CHECK(index.getCompletedCount() == DEEP / 2);
+    CHECK(source.findSubtaskById(1)->countTotalSubtasks() == DEEP / 2);
+    CHECK(target.getSubtaskIndex().size() == static_cast<size_t>(DEEP / 2));
+    CHECK(target.getSubtaskIndex().getCompletedCount() == DEEP / 2);
+
+    // Un subárbol no puede moverse dentro de sí mismo
+    auto moved = target.getSubtasks().front();
+    int movedLeafId = (*moved->postOrder().begin()).getId();
+    CHECK(!target.moveSubtaskTo(moved->getId(), target, movedLeafId));
+
+    // Y de vuelta, colgado de la hoja actual de la cadena original
+    int sourceLeafId = (*source.getSubtasks().front()->postOrder().begin()).getId();
+    CHECK(target.moveSubtaskTo(moved->getId(), source, sourceLeafId));
+    CHECK(index.size() == static_cast<size_t>(DEEP));
+    CHECK(source.findSubtaskById(1)->countTotalSubtasks() == DEEP);
+    CHECK(target.getSubtaskIndex().size() == 0);
+}
+
+void testWideTree() {
+    auto root = makeFan(WIDE);
+    int total = WIDE + 1;
+
+    CHECK(root->countTotalSubtasks() == total);
+    CHECK(visitsEachOnce(root->preOrder(), total));
+    CHECK(visitsEachOnce(root->postOrder(), total));
+
+    CHECK(root->setSubtreeCompleted(true) == total);
+    CHECK(root->countCompletedSubtasks() == total);
+
+    // Tarea con el árbol ancho: completar un hijo ajusta el índice y la raíz
+    Task task(1, "Ancha");
+    task.addSubtask(root);
+    CHECK(task.getSubtaskIndex().size() == static_cast<size_t>(total));
+    CHECK(task.setSubtreeCompleted(WIDE / 2, false));
+    CHECK(task.getSubtaskIndex().getCompletedCount() == total - 1);
+    CHECK(root->countCompletedSubtasks() == total - 1);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testDeepChainTraversal);
+    RUN_TEST(testDeepChainBulkComplete);
+    RUN_TEST(testDeepChainInTask);
+    RUN_TEST(testWideTree);
+    return testResult();
+}
@@ -0,0 +1,155 @@
+#include "TestSupport.h"
+#include "models/TaskHistory.h"
+#include "models/Board.h"
+#include <random>
+
+using namespace std;
+
+namespace {
+
+// Edición aleatoria: reemplaza un tramo por texto nuevo en cualquier posición
+string randomEdit(const string& text, mt19937& rng) {
+    size_t position = text.empty() ? 0 : rng() % text.size();
+    size_t removed = text.empty() ? 0 : rng() % min<size_t>(40, text.size() - position + 1);
+    string inserted(rng() % 30, static_cast<char>('a' + rng() % 26));
+    return text.substr(0, position) + inserted + text.substr(position + removed);
+}
+
+void testEveryVersionReconstructs() {
+    TaskHistory history(50, 8);
+    mt19937 rng(5);
+
+    vector<string> expected;
+    string description(4000, 'x');
+    for (int i = 0; i < 50; ++i) {
+        description = randomEdit(description, rng);
+        expected.push_back(description);
+        history.record("Título", description, "Pendiente", -1, "ana");
+    }
+
+    CHECK(history.size() == 50);
+    for (size_t k = 0; k < history.size(); ++k) {
+        CHECK(history.getVersion(k)->getDescription() == expected[k]);
+    }
+}
+
+void testEditsAtTheEdges() {
+    TaskHistory history(10, 4);
+    vector<string> descriptions = {
+        "",                       // Vacía
+        "cuerpo",                 // Desde vacía
+        "prefijo cuerpo",         // Solo se agrega al principio
+        "prefijo cuerpo sufijo",  // Solo al final
+        "prefijo cuerpo sufijo",  // Sin cambios
+        "otra cosa",              // Reemplazo completo
+        ""                        // Borrado completo
+    };
+    for (const auto& description : descriptions) {
+        history.record("t", description, "Pendiente", -1, "ana");
+    }
+
+    for (size_t k = 0; k < descriptions.size(); ++k) {
+        CHECK(history.getVersion(k)->getDescription() == descriptions[k]);
+    }
+}
+
+void testEvictionKeepsNewestAndReconstructs() {
+    TaskHistory history(20, 8);
+    mt19937 rng(11);
+
+    vector<string> expected;
+    string description(2000, 'y');
+    for (int i = 0; i < 137; ++i) {
+        description = randomEdit(description, rng);
+        expected.push_back(description);
+        history.record("t" + to_string(i), description, i % 2 ? "Terminado" : "Pendiente",
+                       i, "luis");
+    }
+
+    // Quedan las últimas 20, aunque su keyframe original ya se haya desalojado
+    CHECK(history.size() == 20);
+    for (size_t k = 0; k < history.size(); ++k) {
+        size_t original = expected.size() - history.size() + k;
+        auto version = history.getVersion(k);
+        CHECK(version->getDescription() == expected[original]);
+        CHECK(version->getTitle() == "t" + to_string(original));
+        CHECK(version->getAssignedUserId() == static_cast<int>(original));
+    }
+}
+
+void testDiffsUseLessMemoryThanCopies() {
+    TaskHistory history(50, 8);
+    string description(8000, 'z');
+    for (int i = 0; i < 50; ++i) {
+        description[static_cast<size_t>(i) * 100] = 'a';
+        history.record("Título", description, "Pendiente", -1, "ana");
+    }
+
+    // 7 keyframes de 8 KB y 43 diferencias pequeñas, frente a 50 copias
+    size_t copies = 50 * description.size();
+    CHECK(history.getMemoryUsage() < copies / 4);
+}
+
+void testClear() {
+    TaskHistory history;
+    history.record("t", "d", "Pendiente", -1, "ana");
+    history.clear();
+    CHECK(history.empty());
+    history.record("t2", "d2", "Terminado", 3, "luis");
+    CHECK(history.getVersion(0)->getDescription() == "d2");
+    CHECK(history.getModifiedBy(0) == "luis");
+}
+
+// Restaurar un estado distinto es un movimiento: se publica, se registra
+// y las columnas del tablero quedan al día
+void testRestoreMovesTask() {
+    auto board = make_shared<Board>(1, "Versiones");
+    auto task = board->createTask("Original", "");
+    auto version = task->createMemento("ana");
+    task->setTitle("Editada", "ana");
+    board->moveTask(task->getId(), "En Progreso", "ana");
+
+    vector<string> moves;
+    auto subscription = board->getEventBus()->subscribe<TaskMoved>([&](const TaskMoved& event) {
+        moves.push_back(string(event.fromState) + ">" + string(event.toState));
+    });
+
+    CHECK(board->restoreTaskVersion(task->getId(), version, "luis"));
+    CHECK(task->getTitle() == "Original");
+    CHECK(task->getState() == "Pendiente");
+    CHECK(moves == vector<string>({"En Progreso>Pendiente"}));
+    CHECK(board->getTaskCountByState("Pendiente") == 1);
+    CHECK(board->getTaskCountByState("En Progreso") == 0);
+
+    auto entries = task->getActivityEntries();
+    CHECK(entries.size() >= 2);
+    CHECK(entries[entries.size() - 2].getActionType() == "moved");
+    CHECK(entries.back().getActionType() == "restored");
+
+    // Una tarea suelta también registra el movimiento
+    Task loose(2, "Suelta");
+    auto looseVersion = loose.createMemento("ana");
+    loose.setState("Terminado", "ana");
+    loose.restoreFromMemento(looseVersion);
+    CHECK(loose.getState() == "Pendiente");
+    CHECK(loose.getActivityEntries()[1].getNewValue() == "Pendiente");
+
+    // Un estado que el tablero no tiene no se restaura a medias
+    loose.setState("Archivada", "ana");
+    CHECK(!board->restoreTaskVersion(task->getId(), loose.createMemento("ana"), "ana"));
+    CHECK(task->getTitle() == "Original");
+    CHECK(task->getState() == "Pendiente");
+    board->getEventBus()->unsubscribe(subscription);
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testEveryVersionReconstructs);
+    RUN_TEST(testEditsAtTheEdges);
+    RUN_TEST(testEvictionKeepsNewestAndReconstructs);
+    RUN_TEST(testDiffsUseLessMemoryThanCopies);
+    RUN_TEST(testClear);
+    RUN_TEST(testRestoreMovesTask);
+    return testResult();
+}
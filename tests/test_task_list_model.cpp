@@ -0,0 +1,116 @@
+#include "TestSupport.h"
+#include "ui/TaskListModel.h"
+#include "ui/ColumnWidget.h"
+#include "utils/PerfMonitor.h"
+#include <QApplication>
+#include <QListView>
+#include <QPixmapCache>
+
+using namespace std;
+
+namespace {
+
+vector<shared_ptr<Task>> makeTasks(int count, int firstId = 1) {
+    vector<shared_ptr<Task>> tasks;
+    for (int i = 0; i < count; ++i) {
+        tasks.push_back(make_shared<Task>(firstId + i, "Tarea " + to_string(firstId + i)));
+    }
+    return tasks;
+}
+
+uint64_t renderCount() {
+    for (const auto& operation : PerfMonitor::instance().getSnapshot(100).operations) {
+        if (operation.name == "CardRenderer::renderCard") return operation.count;
+    }
+    return 0;
+}
+
+// setTasks solo inserta y quita el tramo que cambió
+void testSetTasksChangesOnlyTheDifference() {
+    TaskListModel model;
+    int inserted = 0, removed = 0;
+    QObject::connect(&model, &QAbstractItemModel::rowsInserted,
+                     [&](const QModelIndex&, int first, int last) { inserted += last - first + 1; });
+    QObject::connect(&model, &QAbstractItemModel::rowsRemoved,
+                     [&](const QModelIndex&, int first, int last) { removed += last - first + 1; });
+
+    auto tasks = makeTasks(1000);
+    model.setTasks(tasks);
+    CHECK(model.rowCount() == 1000 && inserted == 1000);
+
+    inserted = 0;
+    auto changed = tasks;
+    changed.erase(changed.begin() + 500);
+    changed.insert(changed.begin() + 10, make_shared<Task>(5000, "Nueva"));
+    model.setTasks(changed);
+    CHECK(removed == 491 && inserted == 491);
+    CHECK(model.rowCount() == 1000);
+    for (int row = 0; row < model.rowCount(); ++row) {
+        CHECK(model.getTaskAt(row) == changed[row]);
+    }
+
+    removed = inserted = 0;
+    model.setTasks(changed);
+    CHECK(removed == 0 && inserted == 0);
+}
+
+void testDataAndDragMime() {
+    TaskListModel model;
+    auto tasks = makeTasks(3, 40);
+    model.setTasks(tasks);
+
+    QModelIndex second = model.index(1);
+    CHECK(model.data(second, TaskListModel::TaskIdRole).toInt() == 41);
+    CHECK(model.data(second, TaskListModel::TitleRole).toString() == "Tarea 41");
+    CHECK(model.flags(second) & Qt::ItemIsDragEnabled);
+    CHECK(model.findRow(42) == 2 && model.findRow(7) == -1);
+
+    // El mismo mime que arrastra TaskCard y que aceptan las columnas
+    unique_ptr<QMimeData> mime(model.mimeData({second}));
+    CHECK(mime && mime->hasFormat("application/x-task-id"));
+    CHECK(mime->data("application/x-task-id") == "41");
+
+    int changedRow = -1;
+    QObject::connect(&model, &QAbstractItemModel::dataChanged,
+                     [&](const QModelIndex& first, const QModelIndex&) { changedRow = first.row(); });
+    model.refreshTask(42);
+    CHECK(changedRow == 2);
+}
+
+// Con 100k tareas solo se dibujan las tarjetas visibles
+void testVirtualizedColumnPaintsVisibleRows() {
+    ColumnWidget column("Pendiente");
+    column.setVirtualized(true);
+    column.getTaskModel()->setTasks(makeTasks(100000));
+    column.resize(320, 900);
+    column.show();
+    QApplication::processEvents();
+
+    QListView* view = column.findChild<QListView*>();
+    CHECK(view && view->isVisibleTo(&column));
+
+    PerfMonitor::instance().setEnabled(true);
+    PerfMonitor::instance().reset();
+    QPixmapCache::clear();
+    column.grab();
+    uint64_t firstFrame = renderCount();
+    CHECK(firstFrame > 0 && firstFrame < 40);
+
+    // Bajar hasta el final dibuja las filas nuevas, no las 100k
+    view->scrollToBottom();
+    QApplication::processEvents();
+    column.grab();
+    CHECK(renderCount() - firstFrame < 40);
+    CHECK(view->indexAt(QPoint(10, view->viewport()->height() - 10)).row() > 99000);
+    PerfMonitor::instance().setEnabled(false);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    QApplication app(argc, argv);
+    RUN_TEST(testSetTasksChangesOnlyTheDifference);
+    RUN_TEST(testDataAndDragMime);
+    RUN_TEST(testVirtualizedColumnPaintsVisibleRows);
+    return testResult();
+}
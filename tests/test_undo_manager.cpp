@@ -0,0 +1,243 @@
+#include "TestSupport.h"
+#include "managers/UndoManager.h"
+#include <memory>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+shared_ptr<Board> makeBoard(int tasks) {
+    auto board = make_shared<Board>(1, "Deshacer");
+    for (int i = 0; i < tasks; ++i) {
+        board->createTask("Tarea " + to_string(i + 1), "");
+    }
+    return board;
+}
+
+vector<int> columnIds(const Board& board, const string& state) {
+    vector<int> ids;
+    for (const auto& task : board.getTasksByState(state)) {
+        ids.push_back(task->getId());
+    }
+    return ids;
+}
+
+// Deshacer devuelve la tarjeta a su posición original en la columna
+void testMoveUndoRedo() {
+    auto board = makeBoard(4);
+    UndoManager undo;
+
+    CHECK(undo.moveTask(board, 2, "En Progreso", "ana"));
+    CHECK(columnIds(*board, "Pendiente") == vector<int>({1, 3, 4}));
+    CHECK(undo.getUndoDescription() == "Mover tarea");
+
+    CHECK(undo.undo());
+    CHECK(board->findTaskById(2)->getState() == "Pendiente");
+    CHECK(columnIds(*board, "Pendiente") == vector<int>({1, 2, 3, 4}));
+    CHECK(columnIds(*board, "En Progreso").empty());
+
+    CHECK(undo.redo());
+    CHECK(columnIds(*board, "En Progreso") == vector<int>({2}));
+    CHECK(!undo.canRedo());
+
+    // Un movimiento bloqueado no deja paso
+    board->findTaskById(3)->addDependency(1);
+    CHECK(!undo.moveTask(board, 3, "Terminado", "ana"));
+    CHECK(undo.getUndoCount() == 1);
+}
+
+void testAddRemoveTask() {
+    auto board = makeBoard(2);
+    UndoManager undo;
+
+    auto task = board->allocateTask(10, "Nueva");
+    undo.addTask(board, task, "En Progreso");
+    CHECK(board->findTaskById(10) == task);
+    CHECK(undo.undo());
+    CHECK(!board->findTaskById(10));
+    CHECK(undo.redo());
+    CHECK(board->findTaskById(10) == task);
+
+    CHECK(undo.removeTask(board, 1));
+    CHECK(!board->findTaskById(1));
+    CHECK(undo.undo());
+    CHECK(board->findTaskById(1));
+    CHECK(board->getTotalTaskCount() == 3);
+    CHECK(undo.redo());
+    CHECK(!board->findTaskById(1));
+    CHECK(!undo.removeTask(board, 1));
+}
+
+void testDependenciesAndSubtasks() {
+    auto board = makeBoard(3);
+    auto task = board->findTaskById(1);
+    UndoManager undo;
+
+    undo.addDependency(task, 2);
+    undo.addDependency(task, 2);  // Repetida: no cambia nada
+    CHECK(undo.getUndoCount() == 1);
+    undo.removeDependency(task, 2);
+    CHECK(!task->hasDependency(2));
+    CHECK(undo.undo());
+    CHECK(task->hasDependency(2));
+    CHECK(undo.undo());
+    CHECK(!task->hasDependency(2));
+    CHECK(undo.redo());
+    CHECK(task->hasDependency(2));
+
+    auto first = make_shared<Subtask>(1, "Primera");
+    auto second = make_shared<Subtask>(2, "Segunda");
+    undo.addSubtask(task, first);
+    undo.addSubtask(task, second);
+    CHECK(undo.removeSubtask(task, 1));
+    CHECK(task->getSubtasks().size() == 1);
+
+    // La subtarea vuelve a su posición
+    CHECK(undo.undo());
+    CHECK(task->getSubtasks().size() == 2);
+    CHECK(task->getSubtasks()[0] == first);
+    CHECK(undo.undo());
+    CHECK(task->getSubtasks().size() == 1);
+    CHECK(undo.redo());
+    CHECK(task->getSubtasks()[1] == second);
+}
+
+// La descripción se guarda como delta y se reconstruye en ambos sentidos
+void testTextEditsStoreDeltas() {
+    auto board = makeBoard(1);
+    auto task = board->findTaskById(1);
+    string base(4096, 'x');
+    task->setDescription(base, "ana");
+    UndoManager undo(100, chrono::milliseconds(0));
+
+    undo.setDescription(task, base.substr(0, 2000) + "CAMBIO" + base.substr(2000), "ana");
+    CHECK(undo.undo());
+    CHECK(task->getDescription() == base);
+    CHECK(undo.redo());
+    CHECK(task->getDescription().substr(2000, 6) == "CAMBIO");
+    CHECK(task->getDescription().size() == base.size() + 6);
+
+    undo.setTitle(task, "Tarea uno", "ana");
+    undo.setTitle(task, "Tarea dos", "ana");  // Ventana cero: dos pasos
+    CHECK(undo.undo());
+    CHECK(task->getTitle() == "Tarea uno");
+    CHECK(undo.undo());
+    CHECK(task->getTitle() == "Tarea 1");
+}
+
+void testCoalescing() {
+    auto board = makeBoard(1);
+    auto task = board->findTaskById(1);
+    UndoManager undo;
+
+    // Tecleo dentro de la ventana: un solo paso, vuelve al texto original
+    undo.setDescription(task, "h", "ana");
+    undo.setDescription(task, "ho", "ana");
+    undo.setDescription(task, "hola", "ana");
+    CHECK(undo.getUndoCount() == 1);
+    CHECK(undo.undo());
+    CHECK(task->getDescription() == "");
+    CHECK(undo.redo());
+    CHECK(task->getDescription() == "hola");
+
+    // Otro campo u otro usuario abren un paso nuevo
+    undo.setPriority(task, 2, "ana");
+    undo.setPriority(task, 4, "ana");
+    CHECK(undo.getUndoCount() == 2);
+    undo.setPriority(task, 5, "luis");
+    CHECK(undo.getUndoCount() == 3);
+    CHECK(undo.undo());
+    CHECK(task->getPriority() == 4);
+    CHECK(undo.undo());
+    CHECK(task->getPriority() == 3);
+
+    // Fuera de la ventana no se fusiona
+    UndoManager quick(100, chrono::milliseconds(20));
+    quick.setTitle(task, "A", "ana");
+    this_thread::sleep_for(chrono::milliseconds(40));
+    quick.setTitle(task, "AB", "ana");
+    CHECK(quick.getUndoCount() == 2);
+    CHECK(quick.undo());
+    CHECK(task->getTitle() == "A");
+}
+
+void testGroups() {
+    auto board = makeBoard(2);
+    auto task = board->findTaskById(1);
+    UndoManager undo;
+
+    undo.beginGroup();
+    undo.setTitle(task, "Guardada", "ana");
+    undo.setDescription(task, "detalle", "ana");
+    undo.moveTask(board, 1, "En Progreso", "ana");
+    undo.setPriority(task, 5, "ana");
+    undo.endGroup();
+    CHECK(undo.getUndoCount() == 1);
+
+    CHECK(undo.undo());
+    CHECK(task->getTitle() == "Tarea 1");
+    CHECK(task->getDescription() == "");
+    CHECK(task->getState() == "Pendiente");
+    CHECK(columnIds(*board, "Pendiente") == vector<int>({1, 2}));
+
+    CHECK(undo.redo());
+    CHECK(task->getTitle() == "Guardada");
+    CHECK(task->getState() == "En Progreso");
+    CHECK(task->getPriority() == 5);
+
+    // Un grupo vacío no apila nada
+    undo.beginGroup();
+    undo.endGroup();
+    CHECK(undo.getUndoCount() == 1);
+}
+
+void testDepthAndRedoClearing() {
+    auto board = makeBoard(1);
+    auto task = board->findTaskById(1);
+    UndoManager undo(3, chrono::milliseconds(0));
+
+    for (int i = 0; i < 10; ++i) {
+        undo.addDependency(task, 100 + i);
+    }
+    CHECK(undo.getUndoCount() == 3);
+    CHECK(undo.undo() && undo.undo() && undo.undo());
+    CHECK(!undo.undo());
+    CHECK(task->getDependencies().size() == 7);
+
+    CHECK(undo.redo());
+    CHECK(undo.getRedoCount() == 2);
+    undo.removeDependency(task, 100);
+    CHECK(!undo.canRedo());
+    CHECK(!undo.redo());
+}
+
+// Si el tablero ya no existe, el paso se descarta sin tocar nada
+void testExpiredBoard() {
+    UndoManager undo;
+    shared_ptr<Task> task;
+    {
+        auto board = makeBoard(1);
+        task = board->findTaskById(1);
+        undo.moveTask(board, 1, "En Progreso", "ana");
+    }
+    CHECK(undo.canUndo());
+    CHECK(!undo.undo());
+    CHECK(!undo.canUndo());
+    CHECK(!undo.canRedo());
+    CHECK(task->getState() == "En Progreso");
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testMoveUndoRedo);
+    RUN_TEST(testAddRemoveTask);
+    RUN_TEST(testDependenciesAndSubtasks);
+    RUN_TEST(testTextEditsStoreDeltas);
+    RUN_TEST(testCoalescing);
+    RUN_TEST(testGroups);
+    RUN_TEST(testDepthAndRedoClearing);
+    RUN_TEST(testExpiredBoard);
+    return testResult();
+}
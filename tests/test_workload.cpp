@@ -0,0 +1,98 @@
+#include "TestSupport.h"
+#include "managers/WorkloadManager.h"
+
+using namespace std;
+
+namespace {
+
+// Carga = prioridad + subtareas pendientes; las terminadas no cuentan
+void testLoadWeighting() {
+    auto project = make_shared<Project>(1, "Carga");
+    int ana = project->createUser("Ana", "ana@x", "dev")->getId();
+    int beto = project->createUser("Beto", "beto@x", "dev")->getId();
+    auto board = project->createBoard("Tablero");
+
+    auto withSubtasks = board->createTask("Con subtareas", "");
+    withSubtasks->setPriority(3);
+    withSubtasks->setAssignedUserId(ana, "prueba");
+    auto done = withSubtasks->allocateSubtask("Hecha");
+    withSubtasks->addSubtask(done);
+    withSubtasks->addSubtask(withSubtasks->allocateSubtask("Pendiente"));
+    withSubtasks->setSubtreeCompleted(done->getId(), true);
+    CHECK(WorkloadManager::getTaskWeight(*withSubtasks) == 4.0);
+
+    auto simple = board->createTask("Simple", "");
+    simple->setPriority(2);
+    simple->setAssignedUserId(beto, "prueba");
+
+    auto finished = board->createTask("Terminada", "", "Terminado");
+    finished->setPriority(5);
+    finished->setAssignedUserId(beto, "prueba");
+
+    WorkloadReport report = WorkloadManager().buildReport(project, false);
+    CHECK(report.users.size() == 2);
+    CHECK(report.users[0].userId == ana && report.users[0].load == 4.0);
+    CHECK(report.users[0].openTasks == 1 && report.users[0].pendingSubtasks == 1);
+    CHECK(report.users[1].userId == beto && report.users[1].load == 2.0);
+    CHECK(report.users[1].openTasks == 1);
+    CHECK(report.unassignedTasks == 0);
+    CHECK(report.suggestions.empty());
+}
+
+// LPT: la más pesada primero, siempre al usuario con menos carga
+void testSuggestionsGoToLeastLoaded() {
+    auto project = make_shared<Project>(1, "Balanceo");
+    int ana = project->createUser("Ana", "ana@x", "dev")->getId();
+    int beto = project->createUser("Beto", "beto@x", "dev")->getId();
+    int carla = project->createUser("Carla", "carla@x", "dev")->getId();
+    auto board = project->createBoard("Tablero");
+
+    auto assign = [&](int priority, int userId) {
+        auto task = board->createTask("Tarea", "");
+        task->setPriority(priority);
+        if (userId >= 0) task->setAssignedUserId(userId, "prueba");
+        return task->getId();
+    };
+    assign(4, ana);    // Ana 4
+    assign(1, beto);   // Beto 1, Carla 0
+    int light = assign(1, -1);
+    int heavy = assign(5, -1);
+    int medium = assign(2, -1);
+    int orphan = assign(1, 999);  // Usuario inexistente: cuenta como sin asignar
+
+    WorkloadReport report = WorkloadManager().buildReport(project);
+    CHECK(report.unassignedTasks == 4);
+    CHECK(report.suggestions.size() == 4);
+    if (report.suggestions.size() != 4) return;
+
+    // 5 -> Carla (0), 2 -> Beto (1), 1 -> Beto (3), 1 -> Ana (4, empate por orden)
+    CHECK(report.suggestions[0].taskId == heavy && report.suggestions[0].userId == carla);
+    CHECK(report.suggestions[1].taskId == medium && report.suggestions[1].userId == beto);
+    CHECK(report.suggestions[2].taskId == light && report.suggestions[2].userId == beto);
+    CHECK(report.suggestions[3].taskId == orphan && report.suggestions[3].userId == ana);
+    CHECK(report.suggestions[0].boardId == board->getId());
+
+    // El reporte no modifica las tareas
+    CHECK(board->findTaskById(heavy)->getAssignedUserId() == -1);
+}
+
+void testEmptyInputs() {
+    WorkloadManager manager;
+    CHECK(manager.buildReport(nullptr).users.empty());
+
+    // Sin usuarios no hay a quién sugerir
+    auto project = make_shared<Project>(1, "Vacío");
+    project->createBoard("Tablero")->createTask("Tarea", "");
+    WorkloadReport report = manager.buildReport(project);
+    CHECK(report.unassignedTasks == 1);
+    CHECK(report.suggestions.empty());
+}
+
+} // namespace
+
+int main() {
+    RUN_TEST(testLoadWeighting);
+    RUN_TEST(testSuggestionsGoToLeastLoaded);
+    RUN_TEST(testEmptyInputs);
+    return testResult();
+}